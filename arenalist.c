@@ -0,0 +1,553 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <string.h> 		// For copying arenas
+#include <limits.h> 		// For the largest arena
+#include "../arenalist.h"	// For type declarations and function declarations related to the arena linked list data structure
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to print the contents of an arena linked list, in the same format as PrintList
+ * Input: list (ArenaList)
+ * Return value: none
+ * Assumptions: empty list has headIndex == ARENA_NULL_INDEX
+ * Time complexity: O(list.numNodes)
+ * Space complexity: O(1)
+ */
+void PrintArenaList (ArenaList list) {
+	ArenaIndex currIndex;
+
+	currIndex = list.headIndex;
+
+	while (currIndex != ARENA_NULL_INDEX) {
+		PrintData (list.nodes[currIndex].data);
+		printf (" -> ");
+		currIndex = list.nodes[currIndex].nextIndex;
+	}
+	printf ("NULL\n");
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an empty arena linked list
+ * The arena is allocated when the first node is added (or by ArenaReserve).
+ * Input: none
+ * Return value: list (ArenaList) : arena linked list with no nodes and no arena, list.headIndex = list.tailIndex =
+ * list.freeIndex = ARENA_NULL_INDEX
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+ArenaList InitialiseArenaList (void) {
+	ArenaList list;
+	list.nodes = NULL;
+	list.headIndex = ARENA_NULL_INDEX;
+	list.tailIndex = ARENA_NULL_INDEX;
+	list.freeIndex = ARENA_NULL_INDEX;
+	list.numNodes = 0;
+	list.numSlots = 0;
+	list.capacity = 0;
+	return list;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to make room in the arena of a linked list for a number of nodes
+ * The arena is moved (realloc-ed) if it has to grow; since nodes are linked by index, the list stays valid.
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, numNodes (Length) (int): number of nodes the arena
+ * should be able to hold
+ * Return value: TRUE if listPtr->capacity >= numNodes, FALSE if the arena could not be grown (it is then unchanged)
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numSlots) if the arena is moved, O(1) otherwise
+ * Space complexity: O(numNodes)
+ */
+bool ArenaReserve (ArenaList *listPtr, Length numNodes) {
+	ArenaNode *nodes;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaReserve (ArenaList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (numNodes <= listPtr->capacity) {
+		return TRUE;
+	}
+
+	nodes = (ArenaNode *) realloc (listPtr->nodes, (size_t) numNodes * sizeof (ArenaNode));
+	if (nodes == NULL) {
+		printf ("Error: could not grow the arena of an arena linked list to %d nodes\n", numNodes);
+		return FALSE;
+	}
+
+	listPtr->nodes = nodes;
+	listPtr->capacity = numNodes;
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to take a node for an arena linked list, with given data
+ * A node freed earlier is used again first; otherwise the next unused slot of the arena is taken, doubling the arena
+ * if it is full.
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, data (Data) (int)
+ * Return value: index of node with node.data = data, node.nextIndex = ARENA_NULL_INDEX, or ARENA_NULL_INDEX if the arena
+ * could not be grown
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1) amortised
+ * Space complexity: O(1) amortised
+ */
+static ArenaIndex NewArenaNode (ArenaList *listPtr, Data data) {
+	ArenaIndex newIndex;
+	Length newCapacity;
+
+	if (listPtr->freeIndex != ARENA_NULL_INDEX) {
+		newIndex = listPtr->freeIndex;
+		listPtr->freeIndex = listPtr->nodes[newIndex].nextIndex;
+	}
+	else {
+		if (listPtr->numSlots == listPtr->capacity) {
+			if (listPtr->capacity == INT_MAX) {
+				printf ("Error: the arena of an arena linked list cannot hold more than %d nodes\n", INT_MAX);
+				return ARENA_NULL_INDEX;
+			}
+
+			if (listPtr->capacity == 0) {
+				newCapacity = ARENA_INITIAL_CAPACITY;
+			}
+			else {
+				newCapacity = (listPtr->capacity > INT_MAX/2) ? INT_MAX : 2 * (listPtr->capacity);
+			}
+
+			if (!ArenaReserve (listPtr, newCapacity)) {
+				return ARENA_NULL_INDEX;
+			}
+		}
+
+		newIndex = (ArenaIndex) listPtr->numSlots;
+		(listPtr->numSlots)++;
+	}
+
+	listPtr->nodes[newIndex].data = data;
+	listPtr->nodes[newIndex].nextIndex = ARENA_NULL_INDEX;
+	return newIndex;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to give a node that has been unlinked from an arena linked list back to its arena
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, index (ArenaIndex) (uint32_t): index of the node
+ * Return value: none
+ * Post-condition: the node is at the front of the free list of the arena
+ * Assumptions: listPtr != NULL, the node is not in the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void DeleteArenaNode (ArenaList *listPtr, ArenaIndex index) {
+	listPtr->nodes[index].nextIndex = listPtr->freeIndex;
+	listPtr->freeIndex = index;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to link a new node into an arena linked list after a certain node
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, prevIndex (ArenaIndex) (uint32_t): index of the node after
+ * which the new node is to be inserted (ARENA_NULL_INDEX => at the head), newIndex (ArenaIndex) (uint32_t): the new node
+ * Return value: none
+ * Post-condition: the new node follows prevIndex, listPtr->numNodes is incremented by 1
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void LinkArenaNode (ArenaList *listPtr, ArenaIndex prevIndex, ArenaIndex newIndex) {
+	ArenaNode *nodes = listPtr->nodes;
+
+	if (prevIndex == ARENA_NULL_INDEX) {
+		nodes[newIndex].nextIndex = listPtr->headIndex;
+		listPtr->headIndex = newIndex;
+	}
+	else {
+		nodes[newIndex].nextIndex = nodes[prevIndex].nextIndex;
+		nodes[prevIndex].nextIndex = newIndex;
+	}
+
+	if (nodes[newIndex].nextIndex == ARENA_NULL_INDEX) {
+		listPtr->tailIndex = newIndex;
+	}
+	(listPtr->numNodes)++;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to make an arena linked list a copy of another, with one copy of the arena
+ * The slots of the arena in use are copied as they are, with no need to walk the list or fix up links.
+ * Inputs: dstListPtr (ArenaList *): pointer to arena linked list that receives the copy (its nodes are removed first),
+ * srcListPtr (const ArenaList *): pointer to arena linked list to be copied
+ * Return value: TRUE if the list was copied, FALSE if the arena could not be allocated (dstListPtr is then empty)
+ * Post-condition: dstListPtr holds the same data in the same order as srcListPtr, in an arena of its own
+ * Assumptions: dstListPtr != srcListPtr
+ * Time complexity: O(srcListPtr->numSlots)
+ * Space complexity: O(srcListPtr->numSlots)
+ */
+bool CopyArenaList (ArenaList *dstListPtr, const ArenaList *srcListPtr) {
+	if (dstListPtr == NULL) {
+		printf ("Error: Argument 1 of CopyArenaList (ArenaList *dstListPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (srcListPtr == NULL) {
+		printf ("Error: Argument 2 of CopyArenaList (const ArenaList *srcListPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (dstListPtr == srcListPtr) {
+		return TRUE;
+	}
+
+	ArenaRemoveAllNodes (dstListPtr);
+	if (srcListPtr->numSlots == 0) {
+		return TRUE;
+	}
+
+	if (!ArenaReserve (dstListPtr, srcListPtr->numSlots)) {
+		return FALSE;
+	}
+
+	memcpy (dstListPtr->nodes, srcListPtr->nodes, (size_t) (srcListPtr->numSlots) * sizeof (ArenaNode));
+	dstListPtr->headIndex = srcListPtr->headIndex;
+	dstListPtr->tailIndex = srcListPtr->tailIndex;
+	dstListPtr->freeIndex = srcListPtr->freeIndex;
+	dstListPtr->numNodes = srcListPtr->numNodes;
+	dstListPtr->numSlots = srcListPtr->numSlots;
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the end of an arena linked list
+ * Inputs: listPtr (ArenaList *), data (Data) (int)
+ * Return value: none
+ * Pre-condition: listPtr is an arena linked list, with some (or no) nodes
+ * Post-condition: A node with node.data = data is inserted at the end of the list
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1) amortised
+ * Space complexity: O(1) amortised
+ */
+void ArenaAddDataAtEnd (ArenaList *listPtr, Data data) {
+	ArenaIndex newIndex;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaAddDataAtEnd (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	newIndex = NewArenaNode (listPtr, data);
+	if (newIndex == ARENA_NULL_INDEX) {
+		return;
+	}
+
+	LinkArenaNode (listPtr, listPtr->tailIndex, newIndex);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the beginning of an arena linked list
+ * Inputs: listPtr (ArenaList *), data (Data) (int)
+ * Return value: none
+ * Pre-condition: listPtr is an arena linked list, with some (or no) nodes
+ * Post-condition: A node with node.data = data is inserted at the beginning of the list
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1) amortised
+ * Space complexity: O(1) amortised
+ */
+void ArenaAddDataAtBeginning (ArenaList *listPtr, Data data) {
+	ArenaIndex newIndex;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaAddDataAtBeginning (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	newIndex = NewArenaNode (listPtr, data);
+	if (newIndex == ARENA_NULL_INDEX) {
+		return;
+	}
+
+	LinkArenaNode (listPtr, ARENA_NULL_INDEX, newIndex);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to an arena linked list at a certain position w.r.t. the head of the list
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, data (Data) (int), position (Index) (int)
+ * position is like an array index: should range from 0 (head) to (listPtr->numNodes) (after tail)
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: node containing data is inserted at offset 'position' from the beginning
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
+ * Time complexity: O(position), O(1) for position == listPtr->numNodes
+ * Space complexity: O(1) amortised
+ */
+void ArenaAddDataFromBeginning (ArenaList *listPtr, Data data, Index position) {
+	ArenaIndex prevIndex, newIndex;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaAddDataFromBeginning (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > (listPtr->numNodes)) {
+		printf ("Error:	Argument 3 of ArenaAddDataFromBeginning (Index position) is out of bounds\n");
+		return;
+	}
+
+	newIndex = NewArenaNode (listPtr, data);
+	if (newIndex == ARENA_NULL_INDEX) {
+		return;
+	}
+
+	if (position == listPtr->numNodes) {
+		prevIndex = listPtr->tailIndex;
+	}
+	else {
+		prevIndex = ARENA_NULL_INDEX;
+		for (i = 0; i < position; i++) {
+			prevIndex = (prevIndex == ARENA_NULL_INDEX) ? listPtr->headIndex : listPtr->nodes[prevIndex].nextIndex;
+		}
+	}
+
+	LinkArenaNode (listPtr, prevIndex, newIndex);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to an arena linked list at a certain position w.r.t. the tail of the list
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, data (Data) (int), position (Index) (int).
+ * Position is like an array index: should range from 0 (tail) to (listPtr->numNodes) (before head)
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: node containing data is inserted at offset 'position' from the end
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
+ * Time complexity: O(positionFromBeginning)
+ * Space complexity: O(1) amortised
+ */
+void ArenaAddDataFromEnd (ArenaList *listPtr, Data data, Index position) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaAddDataFromEnd (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > (listPtr->numNodes)) {
+		printf ("Error:	Argument 3 of ArenaAddDataFromEnd (Index position) is out of bounds\n");
+		return;
+	}
+
+	ArenaAddDataFromBeginning (listPtr, data, (listPtr->numNodes)-position);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove a node from an arena linked list
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, prevIndex (ArenaIndex) (uint32_t): index of the node before
+ * the node to be removed (ARENA_NULL_INDEX => it is the head), currIndex (ArenaIndex) (uint32_t): index of the node
+ * to be removed
+ * Return value: none
+ * Pre-condition: list has some nodes
+ * Post-condition: the node is removed from the list and given back to the arena, listPtr->numNodes is decremented by 1
+ * Assumptions: listPtr != NULL, currIndex is in the list and follows prevIndex
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void ArenaRemoveNode (ArenaList *listPtr, ArenaIndex prevIndex, ArenaIndex currIndex) {
+	ArenaNode *nodes;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaRemoveNode (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (currIndex == ARENA_NULL_INDEX || (Length) currIndex >= listPtr->numSlots) {
+		printf ("Error:	Argument 3 of ArenaRemoveNode (ArenaIndex currIndex) is out of bounds\n");
+		return;
+	}
+
+	nodes = listPtr->nodes;
+	if (prevIndex == ARENA_NULL_INDEX) {
+		listPtr->headIndex = nodes[currIndex].nextIndex;
+	}
+	else {
+		nodes[prevIndex].nextIndex = nodes[currIndex].nextIndex;
+	}
+
+	if (listPtr->tailIndex == currIndex) {
+		listPtr->tailIndex = prevIndex;
+	}
+
+	DeleteArenaNode (listPtr, currIndex);
+	(listPtr->numNodes)--;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove given data from an arena linked list
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, data (Data) (int)
+ * Return value: none
+ * Pre-condition: list has some (or no) nodes
+ * Post-condition: All occurrences of data in list are removed, listPtr->numNodes is reduced by number of nodes removed.
+ * The arena does not shrink.
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Space complexity: O(1)
+ */
+void ArenaRemoveData (ArenaList *listPtr, Data data) {
+	ArenaIndex prevIndex, currIndex, nextIndex;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaRemoveData (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	prevIndex = ARENA_NULL_INDEX;
+	currIndex = listPtr->headIndex;
+
+	while (currIndex != ARENA_NULL_INDEX) {
+		nextIndex = listPtr->nodes[currIndex].nextIndex;
+
+		if (listPtr->nodes[currIndex].data == data) {
+			ArenaRemoveNode (listPtr, prevIndex, currIndex);
+		}
+		else {
+			prevIndex = currIndex;
+		}
+		currIndex = nextIndex;
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove all nodes in an arena linked list, and free its arena
+ * Input: listPtr (ArenaList *): pointer to arena linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: list is as returned by InitialiseArenaList
+ * Assumption: listPtr != NULL
+ * Time complexity: O(1), whatever the number of nodes
+ * Space complexity: O(1)
+ */
+void ArenaRemoveAllNodes (ArenaList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaRemoveAllNodes (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	free (listPtr->nodes);
+	*listPtr = InitialiseArenaList ();
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to reverse an arena linked list
+ * Input: listPtr (ArenaList *): pointer to arena linked list
+ * Return value: none
+ * Pre-condition: linked list contains some nodes (n_1)->...(n_numNodes)->NULL
+ * Post-condition: linked list contains the nodes in order (n_numNodes)->...(n_1)->NULL
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+void ArenaReverseList (ArenaList *listPtr) {
+	ArenaIndex prevIndex, currIndex, nextIndex;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaReverseList (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	prevIndex = ARENA_NULL_INDEX;
+	currIndex = listPtr->headIndex;
+
+	while (currIndex != ARENA_NULL_INDEX) {
+		nextIndex = listPtr->nodes[currIndex].nextIndex;
+		listPtr->nodes[currIndex].nextIndex = prevIndex;
+		prevIndex = currIndex;
+		currIndex = nextIndex;
+	}
+
+	listPtr->tailIndex = listPtr->headIndex;
+	listPtr->headIndex = prevIndex;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to rotate an arena linked list by a given amount
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, rotation (Index) (int): amount by which to rotate
+ * rotation > 0 => right rotation, rotation < 0 => left rotation (same meaning as for RotateList)
+ * Return value: none
+ * Assumptions: listPtr != NULL, -numNodes+1 <= rotation <= numNodes-1
+ * Time complexity: O(index) [ = min ( |rotation| , listPtr->numNodes - |rotation| )]
+ * Space complexity: O(1)
+ */
+void ArenaRotateList (ArenaList *listPtr, Index rotation) {
+	ArenaIndex prevIndex, currIndex;
+	Index index, i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaRotateList (ArenaList *listPtr) cannot be NULL\n");
+		return;
+	}
+	if (rotation <= -(listPtr->numNodes) || rotation >= (listPtr->numNodes)) {
+		printf ("Error: Argument 2 of ArenaRotateList (Index rotation) describes rotation that is not supported\n");
+		return;
+	}
+
+	if (rotation == 0) {
+		return;
+	}
+	else if (rotation < 0) {
+		index = -rotation;
+	}
+	else {
+		index = (listPtr->numNodes)-rotation;
+	}
+
+	prevIndex = ARENA_NULL_INDEX;
+	currIndex = listPtr->headIndex;
+
+	for (i = 0; i < index; i++) {
+		prevIndex = currIndex;
+		currIndex = listPtr->nodes[currIndex].nextIndex;
+	}
+
+	listPtr->nodes[listPtr->tailIndex].nextIndex = listPtr->headIndex;
+	listPtr->nodes[prevIndex].nextIndex = ARENA_NULL_INDEX;
+	listPtr->headIndex = currIndex;
+	listPtr->tailIndex = prevIndex;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to copy the contents of an arena linked list into an array
+ * Inputs: listPtr (ArenaList *): pointer to arena linked list, dataArray (Data *): array to copy into,
+ * arrayLength (Length) (int): number of elements dataArray can hold
+ * Return value: number of elements copied (Length) (int) = min(listPtr->numNodes, arrayLength)
+ * Post-condition: dataArray[i] holds the data of the i-th node (from the head), for each element copied. The list is unchanged.
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless arrayLength == 0)
+ * Time complexity: O(min(listPtr->numNodes, arrayLength))
+ * Space complexity: O(1)
+ */
+Length ArenaListToArray (ArenaList *listPtr, Data *dataArray, Length arrayLength) {
+	ArenaIndex currIndex;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ArenaListToArray (ArenaList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	currIndex = listPtr->headIndex;
+
+	for (i = 0; i < arrayLength && currIndex != ARENA_NULL_INDEX; i++) {
+		dataArray[i] = listPtr->nodes[currIndex].data;
+		currIndex = listPtr->nodes[currIndex].nextIndex;
+	}
+
+	return i;
+}
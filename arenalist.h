@@ -0,0 +1,118 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the arena linked list data structure.
+ * An arena linked list keeps all of its nodes in one growable array (the arena), and links them by 32-bit indices into
+ * that array instead of by pointers. A node takes 8 bytes instead of the 16 of a ListNode on 64-bit builds, the nodes of
+ * a list sit together in memory, and, since no node holds an address, the whole list can be moved, copied or written out
+ * as one block of memory (see CopyArenaList).
+ *
+ * The following types are declared in this file:
+ * a) ArenaIndex: For the index of a node in an arena. Another name for uint32_t; ARENA_NULL_INDEX stands for no node
+ * b) struct arenanode (ArenaNode): a structure representing one arena list node. Contains the data and the index of
+ *    the next node
+ * c) struct arenalist (ArenaList): a structure representing an arena linked list. Contains the arena, the indices of
+ *    the head, the tail and the first free node, the number of nodes, and the numbers of arena slots used and allocated
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to printing contents of an arena linked list
+ * a) PrintArenaList: Function to print the contents of an arena linked list
+ *
+ * Related to initialising an arena linked list
+ * b) InitialiseArenaList: Function to create an empty arena linked list
+ * c) ArenaReserve: Function to make room in the arena of a linked list for a number of nodes
+ * d) CopyArenaList: Function to make an arena linked list a copy of another, with one copy of the arena
+ *
+ * Related to adding data (nodes) to an arena linked list
+ * e) ArenaAddDataAtEnd: Function to add data at the end of an arena linked list
+ * f) ArenaAddDataAtBeginning: Function to add data at the beginning of an arena linked list
+ * g) ArenaAddDataFromBeginning: Function to add data at a certain position w.r.t. the head of an arena linked list
+ * h) ArenaAddDataFromEnd: Function to add data at a certain position w.r.t. the tail of an arena linked list
+ *
+ * Related to removing data (nodes) from an arena linked list
+ * i) ArenaRemoveNode: Function to remove a node from an arena linked list
+ * j) ArenaRemoveData: Function to remove all occurrences of given data from an arena linked list
+ * k) ArenaRemoveAllNodes: Function to remove all nodes in an arena linked list, and free its arena
+ *
+ * Related to permutation of an arena linked list
+ * l) ArenaReverseList: Function to reverse an arena linked list
+ * m) ArenaRotateList: Function to rotate an arena linked list by a given amount
+ *
+ * Related to bulk transfer of data from an arena linked list
+ * n) ArenaListToArray: Function to copy the contents of an arena linked list into an array
+ *
+ * All of the above functions are defined in "Linked List/arenalist.c". For more details, see there.
+ */
+
+#ifndef ARENALIST_H
+#define ARENALIST_H
+
+	#include <stdint.h>
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// For the index of a node in an arena
+	typedef uint32_t ArenaIndex;
+	#define ARENA_NULL_INDEX UINT32_MAX
+
+	// Number of nodes the arena of a list first grows to; it doubles whenever it is full
+	#define ARENA_INITIAL_CAPACITY 64
+
+	// For one node in arena linked list
+	struct arenanode {
+		Data data;
+		ArenaIndex nextIndex;
+	};
+	typedef struct arenanode ArenaNode;
+
+	// Wrapper for arena linked list nodes. Slots [0, numSlots) of the arena are either in the list or in the free list.
+	struct arenalist {
+		ArenaNode *nodes;
+		ArenaIndex headIndex;
+		ArenaIndex tailIndex;
+		ArenaIndex freeIndex;
+		Length numNodes;
+		Length numSlots;
+		Length capacity;
+	};
+	typedef struct arenalist ArenaList;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/arenalist.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to printing the contents of the arena linked list
+	void PrintArenaList (ArenaList list);
+
+	// Related to initialising arena linked lists
+	ArenaList InitialiseArenaList (void);
+	bool ArenaReserve (ArenaList *listPtr, Length numNodes);
+	bool CopyArenaList (ArenaList *dstListPtr, const ArenaList *srcListPtr);
+
+	// Related to adding data (nodes) to an arena linked list
+	void ArenaAddDataAtEnd (ArenaList *listPtr, Data data);
+	void ArenaAddDataAtBeginning (ArenaList *listPtr, Data data);
+	void ArenaAddDataFromBeginning (ArenaList *listPtr, Data data, Index position);
+	void ArenaAddDataFromEnd (ArenaList *listPtr, Data data, Index position);
+
+	// Related to removing data (nodes) from an arena linked list
+	void ArenaRemoveNode (ArenaList *listPtr, ArenaIndex prevIndex, ArenaIndex currIndex);
+	void ArenaRemoveData (ArenaList *listPtr, Data data);
+	void ArenaRemoveAllNodes (ArenaList *listPtr);
+
+	// Related to permutation of an arena linked list
+	void ArenaReverseList (ArenaList *listPtr);
+	void ArenaRotateList (ArenaList *listPtr, Index rotation);
+
+	// Related to bulk transfer of data from an arena linked list
+	Length ArenaListToArray (ArenaList *listPtr, Data *dataArray, Length arrayLength);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
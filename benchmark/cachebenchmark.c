@@ -0,0 +1,148 @@
+#include <stdio.h>  			// For input/output
+#include <stdlib.h> 			// For dynamic memory allocation and de-allocation
+#include <time.h>   			// For the monotonic clock
+#include <sched.h>  			// For yielding while a list is empty
+#include <pthread.h>			// For the producer and consumer threads
+#include "../nodecache.h"		// For the node cache being timed
+#include "cachebenchmark.h"		// For function declarations of this file
+
+// For one producer and consumer pair, and the list under a lock between them
+struct churnpair {
+	LinkedList list;
+	pthread_mutex_t lock;
+	Length numData;
+	long long sum;
+};
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function run by each producer thread: adds its data at the end of its pair's list (AddDataAtEnd), one value
+ * at a time under the lock
+ * Input: argPtr (void *): pointer to the struct churnpair of the thread
+ * Return value: NULL
+ * Time complexity: O(numData)
+ * Space complexity: O(numData) nodes, freed by the consumer
+ */
+static void *ProduceNodes (void *argPtr) {
+	struct churnpair *pairPtr;
+	Index i;
+
+	pairPtr = (struct churnpair *) argPtr;
+	for (i = 0; i < pairPtr->numData; i++) {
+		pthread_mutex_lock (&(pairPtr->lock));
+		AddDataAtEnd (&(pairPtr->list), i);
+		pthread_mutex_unlock (&(pairPtr->lock));
+	}
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function run by each consumer thread: removes the head of its pair's list (RemoveNode) until all the data of
+ * the producer has come through, yielding whenever the list is empty
+ * Input: argPtr (void *): pointer to the struct churnpair of the thread
+ * Return value: NULL
+ * Time complexity: O(numData)
+ * Space complexity: O(1)
+ */
+static void *ConsumeNodes (void *argPtr) {
+	struct churnpair *pairPtr;
+	Length numReceived = 0;
+	bool isReceived;
+
+	pairPtr = (struct churnpair *) argPtr;
+	while (numReceived < pairPtr->numData) {
+		pthread_mutex_lock (&(pairPtr->lock));
+		isReceived = (pairPtr->list.headPtr != NULL);
+		if (isReceived) {
+			pairPtr->sum += pairPtr->list.headPtr->data;
+			RemoveNode (&(pairPtr->list), NULL, pairPtr->list.headPtr);
+		}
+		pthread_mutex_unlock (&(pairPtr->lock));
+
+		if (isReceived) {
+			numReceived++;
+		}
+		else {
+			sched_yield ();
+		}
+	}
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to time pairs of threads passing nodes from producer to consumer through linked lists
+ * Each pair has a list of its own under a lock, so the pairs share nothing but the allocator: every node is allocated
+ * on the producer thread and freed on the consumer thread. The lists malloc their nodes, or all share one node cache.
+ * Inputs: numPairs (Length) (int): number of producer and consumer pairs, numDataPerPair (Length) (int): number of nodes
+ * each pair passes along, isCached (bool): TRUE => the lists take their nodes from a node cache
+ * Return value: seconds from starting the threads to the last consumer finishing, or -1 if the threads or the cache
+ * could not be set up
+ * Assumptions: numPairs >= 1, numDataPerPair >= 0
+ * Time complexity: O(numPairs * numDataPerPair)
+ * Space complexity: O(numPairs), plus the nodes in the lists at any one time
+ */
+double TimeNodeChurn (Length numPairs, Length numDataPerPair, bool isCached) {
+	struct churnpair *pairs;
+	pthread_t *threads;
+	NodeCache cache;
+	struct timespec startTime, stopTime;
+	Length numStarted;
+	Index i;
+
+	pairs = (struct churnpair *) malloc (numPairs * sizeof (struct churnpair));
+	threads = (pthread_t *) malloc (2 * numPairs * sizeof (pthread_t));
+	if (pairs == NULL || threads == NULL || (isCached && !InitialiseNodeCache (&cache, 0, 0))) {
+		printf ("Error: could not set up the threads of TimeNodeChurn\n");
+		free (pairs);
+		free (threads);
+		return -1;
+	}
+
+	for (i = 0; i < numPairs; i++) {
+		pairs[i].list = InitialiseList ();
+		if (isCached) {
+			AttachNodeCache (&(pairs[i].list), &cache);
+		}
+		pthread_mutex_init (&(pairs[i].lock), NULL);
+		pairs[i].numData = numDataPerPair;
+		pairs[i].sum = 0;
+	}
+
+	clock_gettime (CLOCK_MONOTONIC, &startTime);
+
+	// a consumer is only started once its producer is
+	numStarted = 0;
+	for (i = 0; i < numPairs; i++) {
+		if (pthread_create (&threads[2*i], NULL, ProduceNodes, &pairs[i]) != 0) {
+			break;
+		}
+		if (pthread_create (&threads[2*i+1], NULL, ConsumeNodes, &pairs[i]) != 0) {
+			pthread_join (threads[2*i], NULL);
+			RemoveAllNodes (&(pairs[i].list));
+			break;
+		}
+		numStarted++;
+	}
+
+	for (i = 0; i < 2 * numStarted; i++) {
+		pthread_join (threads[i], NULL);
+	}
+	clock_gettime (CLOCK_MONOTONIC, &stopTime);
+
+	for (i = 0; i < numPairs; i++) {
+		pthread_mutex_destroy (&(pairs[i].lock));
+	}
+	if (isCached) {
+		DestroyNodeCache (&cache);
+	}
+	free (pairs);
+	free (threads);
+
+	if (numStarted < numPairs) {
+		printf ("Error: could only start %d of %d thread pairs in TimeNodeChurn\n", numStarted, numPairs);
+		return -1;
+	}
+	return (stopTime.tv_sec - startTime.tv_sec) + (stopTime.tv_nsec - startTime.tv_nsec) * 1e-9;
+}
@@ -0,0 +1,32 @@
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Header file containing function declarations of the node cache part of the benchmark (see "listbenchmark.cpp").
+ * "nodecache.h" uses C11 atomics, which C++ cannot include, so the threads allocating and freeing nodes live in a C file.
+ *
+ * The following functions are declared in this file:
+ * a) TimeNodeChurn: Function to time pairs of threads passing nodes from producer to consumer through linked lists
+ *
+ * All of the above functions are defined in "Linked List/benchmark/cachebenchmark.c". For more details, see there.
+ */
+
+#ifndef CACHEBENCHMARK_H
+#define CACHEBENCHMARK_H
+
+	#include "../linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/benchmark/cachebenchmark.c".
+	 * For more details, refer to this file.
+	 */
+
+	double TimeNodeChurn (Length numPairs, Length numDataPerPair, bool isCached);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
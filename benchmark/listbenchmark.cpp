@@ -0,0 +1,2038 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Benchmark of the linked list functions against std::forward_list, std::list and std::vector.
+ *
+ * Every function declared in "linkedlist.h" is timed in at least one scenario. Each scenario runs the same operations
+ * on every container that can do them: LinkedList with malloc-ed nodes, LinkedList taking its nodes from a node pool,
+ * LinkedList with a positional index (where positions matter), UnrolledList, and the three standard containers.
+ * The concurrent queue (1 to 64 producers) and the text and binary input/output of "listio.h" are timed as well, and
+ * the parallel operations of "listparallel.h" on 1, 2, 4, ... threads against the plain loop doing the same, and
+ * pairs of producer and consumer threads allocating and freeing nodes with malloc against a node cache.
+ *
+ * Each scenario runs at sizes 1K, 10K, ... 100M (up to the size given on the command line), with the nodes of the
+ * list laid out in memory in list order ("sequential") or in random order ("scattered": node-sized blocks are freed in
+ * random order just before the list is built, so the allocator hands them back shuffled). Each row reports:
+ *   ns/op:      time per operation. For operations over the whole list (sorting, reversing, ...) an op is one element.
+ *   bytes/elem: heap in use by the container after the operation, divided by its number of elements
+ *   misses/op:  hardware cache misses per operation, if perf_event_open is allowed ("-" otherwise)
+ * Short runs are repeated (each time on a freshly built container) until they add up to MIN_MEASURED_SECONDS.
+ * Operations that walk the list (O(size) each) are run at most about MAX_WALK_STEPS / size times per repetition.
+ * Sizes that would not fit in half the physical memory are skipped.
+ *
+ * Building (from "Linked List"; the C files are compiled as C, this file as C++17; -Ibenchmark lets the "../xxx.h"
+ * includes of the C files find the headers; needs glibc 2.33 or later, for mallinfo2):
+ *   gcc -std=gnu11 -O2 -Ibenchmark -c *.c benchmark/queuebenchmark.c benchmark/parallelbenchmark.c \
+ *     benchmark/cachebenchmark.c
+ *   g++ -std=c++17 -O2 -c benchmark/listbenchmark.cpp
+ *   g++ *.o -o listbenchmark -lpthread
+ *
+ * Running:
+ *   ./listbenchmark [maxSize [scenario]]
+ * maxSize defaults to 100000000; scenario restricts the run to one scenario (first column of the output).
+ */
+
+#include <cstdio>   		// For input/output
+#include <cstdlib>  		// For dynamic memory allocation and de-allocation
+#include <cstring>  		// For comparing scenario names
+#include <algorithm>		// For the standard algorithms the standard containers are compared with
+#include <chrono>   		// For the monotonic clock
+#include <deque>    		// For the queue the concurrent queue is compared with
+#include <forward_list>		// For the singly linked list LinkedList is compared with
+#include <list>     		// For the doubly linked list LinkedList is compared with
+#include <mutex>    		// For the lock of the queue the concurrent queue is compared with
+#include <numeric>  		// For summing the data of a container
+#include <random>   		// For data values, positions and memory layouts
+#include <string>   		// For the text read back in by the ingest scenario
+#include <thread>   		// For the producers of the queue the concurrent queue is compared with
+#include <vector>   		// For the array LinkedList is compared with
+#include <fcntl.h>  		// For opening files
+#include <malloc.h> 		// For the heap in use, and for trimming the heap between runs
+#include <unistd.h> 		// For file descriptors and system calls
+#include <sys/ioctl.h>		// For controlling the cache-miss counter
+#include <sys/mman.h>		// For scratch memory that does not go through malloc
+#include <sys/syscall.h>	// For perf_event_open
+#include <linux/perf_event.h>	// For the cache-miss counter
+#include "../linkedlist.hpp"	// For the C++ wrapper of LinkedList (and LinkedList itself)
+#include "../nodepool.h"	// For node pools
+#include "../positionindex.h"	// For positional indexes
+#include "../unrolledlist.h"	// For unrolled linked lists
+#include "../listio.h"		// For text and binary input/output of linked lists
+#include "queuebenchmark.h"	// For the concurrent queue part of the benchmark
+#include "parallelbenchmark.h"	// For the parallel traversal part of the benchmark
+#include "cachebenchmark.h"	// For the node cache part of the benchmark
+
+namespace {
+
+	// Sizes run, from smallest to largest
+	const Length benchmarkSizes[] = {1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+	// Short runs are repeated until they add up to this many seconds (or MAX_REPETITIONS runs)
+	const double MIN_MEASURED_SECONDS = 0.05;
+	const Length MAX_REPETITIONS = 1000;
+
+	// Operations that walk the list are run about this many steps' worth per repetition
+	const double MAX_WALK_STEPS = 2e7;
+
+	// Generous estimate of the memory needed per element (largest container, plus inputs), to skip sizes that do not fit
+	const double BYTES_PER_ELEMENT_ESTIMATE = 96;
+
+	// Numbers of producer threads for the concurrent queue, and the data sent through it
+	const Length queueProducerCounts[] = {1, 2, 4, 8, 16, 32, 64};
+	const Length MAX_QUEUE_DATA = 4000000;
+
+	// Largest list the parallel operations are timed on
+	const Length MAX_PARALLEL_NODES = 10000000;
+
+	// Most nodes passed from producers to consumers in the node churn scenario, over all thread pairs
+	const Length MAX_CHURN_DATA = 4000000;
+
+	// Results are folded into this, so that the compiler cannot drop the work
+	volatile long long sink;
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to find the number of operations that walk the list (O(size) each) to run per repetition
+	 * Input: size (Length) (int): size of the list
+	 * Return value: MAX_WALK_STEPS / size, but at least 1 and at most size
+	 * Time complexity: O(1)
+	 */
+	Length WalkOps (Length size) {
+		return (Length) std::max (1.0, std::min ((double) size, MAX_WALK_STEPS / size));
+	}
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to find the number of bytes the heap has handed out (including large blocks mapped separately)
+	 * Return value: bytes in use
+	 * Time complexity: O(number of arenas)
+	 */
+	size_t HeapInUse () {
+		struct mallinfo2 info;
+
+		info = mallinfo2 ();
+		return info.uordblks + info.hblkhd;
+	}
+
+	// For the hardware cache-miss counter of this thread and the threads it starts (fileDescriptor < 0 => not available)
+	class MissCounter {
+	public:
+		MissCounter () {
+			struct perf_event_attr attributes;
+
+			memset (&attributes, 0, sizeof (attributes));
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.size = sizeof (attributes);
+			attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+			attributes.disabled = 1;
+			attributes.inherit = 1;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			fileDescriptor = (int) syscall (SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+		}
+
+		~MissCounter () {
+			if (fileDescriptor >= 0) {
+				close (fileDescriptor);
+			}
+		}
+
+		bool IsAvailable () const { return fileDescriptor >= 0; }
+
+		void Start () {
+			if (fileDescriptor >= 0) {
+				ioctl (fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+				ioctl (fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+			}
+		}
+
+		long long Stop () {
+			long long count;
+
+			count = 0;
+			if (fileDescriptor >= 0) {
+				ioctl (fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+				if (read (fileDescriptor, &count, sizeof (count)) != sizeof (count)) {
+					count = 0;
+				}
+			}
+			return count;
+		}
+
+	private:
+		int fileDescriptor;
+	};
+
+	MissCounter missCounter;
+
+	// For sending stdout to /dev/null while a list is printed (the results themselves go to stdout as well)
+	class SilencedStdout {
+	public:
+		SilencedStdout () {
+			int nullDescriptor;
+
+			fflush (stdout);
+			savedDescriptor = dup (STDOUT_FILENO);
+			nullDescriptor = open ("/dev/null", O_WRONLY);
+			dup2 (nullDescriptor, STDOUT_FILENO);
+			close (nullDescriptor);
+		}
+
+		~SilencedStdout () {
+			fflush (stdout);
+			dup2 (savedDescriptor, STDOUT_FILENO);
+			close (savedDescriptor);
+		}
+
+	private:
+		int savedDescriptor;
+	};
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to print one row of results
+	 * Inputs: scenario, container, pattern (const char *): what was measured, size (Length) (int): size of the list,
+	 * nsPerOp (double), bytesPerElement (double) (< 0 => not meaningful), missesPerOp (double) (< 0 => not available)
+	 * Return value: none
+	 */
+	void PrintRow (const char *scenario, const char *container, const char *pattern, Length size,
+		double nsPerOp, double bytesPerElement, double missesPerOp) {
+		char bytesText[32], missesText[32];
+
+		snprintf (bytesText, sizeof (bytesText), (bytesPerElement < 0) ? "-" : "%.1f", bytesPerElement);
+		snprintf (missesText, sizeof (missesText), (missesPerOp < 0) ? "-" : "%.3f", missesPerOp);
+		printf ("%-16s %-32s %-14s %10d %12.2f %11s %10s\n", scenario, container, pattern, size, nsPerOp,
+			bytesText, missesText);
+		fflush (stdout);
+	}
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to time an operation on a container, and print one row of results
+	 * Each repetition default-constructs a State, prepares it with setup (not timed), and times work on it.
+	 * The heap is trimmed before each repetition, so that one run's freed nodes do not decide the next run's layout.
+	 * Inputs: scenario, container, pattern (const char *): what is measured, size (Length) (int): size of the list,
+	 * setup (callable taking State &), work (callable taking State & and returning the number of operations done)
+	 * Return value: none
+	 */
+	template <typename State, typename Setup, typename Work>
+	void Measure (const char *scenario, const char *container, const char *pattern, Length size, Setup setup, Work work) {
+		std::chrono::steady_clock::time_point startTime, stopTime;
+		double totalSeconds, bytesPerElement;
+		long long totalOps, totalMisses;
+		size_t heapBefore;
+		Length numRepetitions;
+
+		totalSeconds = 0;
+		totalOps = 0;
+		totalMisses = 0;
+		bytesPerElement = -1;
+		numRepetitions = 0;
+
+		do {
+			malloc_trim (0);
+			heapBefore = HeapInUse ();
+			{
+				State state;
+
+				setup (state);
+				missCounter.Start ();
+				startTime = std::chrono::steady_clock::now ();
+				totalOps += work (state);
+				stopTime = std::chrono::steady_clock::now ();
+				totalMisses += missCounter.Stop ();
+				totalSeconds += std::chrono::duration<double> (stopTime - startTime).count ();
+				if (state.Size () > 0) {
+					bytesPerElement = (double) (HeapInUse () - heapBefore) / state.Size ();
+				}
+			}
+			numRepetitions++;
+		} while (totalSeconds < MIN_MEASURED_SECONDS && numRepetitions < MAX_REPETITIONS);
+
+		PrintRow (scenario, container, pattern, size, totalSeconds * 1e9 / std::max (totalOps, 1LL), bytesPerElement,
+			missCounter.IsAvailable () ? (double) totalMisses / std::max (totalOps, 1LL) : -1);
+	}
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to make the next numBlocks allocations come back in random order
+	 * numBlocks blocks are allocated and then freed in random order; the allocator reuses freed blocks last in, first out.
+	 * The list of blocks is kept in memory mapped separately, so that no large heap allocation in between merges them.
+	 * Inputs: numBlocks (Length) (int), allocate (callable returning void *), release (callable taking void *)
+	 * Return value: none
+	 * Time complexity: O(numBlocks)
+	 * Space complexity: O(numBlocks)
+	 */
+	template <typename Allocate, typename Release>
+	void ScatterBlocks (Length numBlocks, Allocate allocate, Release release) {
+		std::mt19937 generator (numBlocks);
+		void **blocks;
+		Index i;
+
+		blocks = (void **) mmap (NULL, numBlocks * sizeof (void *), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (blocks == MAP_FAILED) {
+			return;
+		}
+
+		for (i = 0; i < numBlocks; i++) {
+			blocks[i] = allocate ();
+		}
+		std::shuffle (blocks, blocks + numBlocks, generator);
+		for (i = 0; i < numBlocks; i++) {
+			release (blocks[i]);
+		}
+		munmap (blocks, numBlocks * sizeof (void *));
+	}
+
+	// Same as ScatterBlocks, for blocks from malloc
+	void ScatterHeap (Length numBlocks, size_t blockSize) {
+		ScatterBlocks (numBlocks, [blockSize] () { return malloc (blockSize); }, [] (void *blockPtr) { free (blockPtr); });
+	}
+
+	// Predicate for RemoveIf
+	bool IsEven (Data data, void *contextPtr) {
+		(void) contextPtr;
+		return data % 2 == 0;
+	}
+
+	// Ways of running a LinkedList
+	enum ListVariant { MALLOC_NODES, POOLED_NODES, INDEXED_NODES, VALUE_INDEXED_NODES };
+
+	// For a LinkedList under test: every operation is the function of "linkedlist.h" doing it
+	template <ListVariant variant>
+	class LinkedListAdapter {
+	public:
+		static const bool isContiguous = false;
+		static const bool canScatter = true;
+
+		NodePool pool;
+		ll::List list;
+
+		LinkedListAdapter () : pool (InitialisePool (0)) {
+			if (variant == POOLED_NODES) {
+				AttachPool (list.get (), &pool);
+			}
+			else if (variant == INDEXED_NODES) {
+				AttachPositionIndex (list.get ());
+			}
+			else if (variant == VALUE_INDEXED_NODES) {
+				AttachValueIndex (list.get ());
+			}
+		}
+
+		~LinkedListAdapter () {
+			list.clear ();
+			ReleaseAllSlabs (&pool);
+		}
+
+		static const char *Name () {
+			return (variant == POOLED_NODES) ? "LinkedList+pool" : (variant == INDEXED_NODES) ? "LinkedList+index" :
+				(variant == VALUE_INDEXED_NODES) ? "LinkedList+valueindex" : "LinkedList";
+		}
+
+		Length Size () const { return list.size (); }
+
+		void Scatter (Length numNodes) {
+			if (variant == POOLED_NODES) {
+				ScatterBlocks (numNodes, [this] () { return (void *) AllocateNode (&pool); },
+					[this] (void *nodePtr) { FreeNode (&pool, (ListNode *) nodePtr); });
+			}
+			else {
+				ScatterHeap (numNodes, sizeof (ListNode));
+			}
+		}
+
+		void PushBack (Data data) { AddDataAtEnd (list.get (), data); }
+		void PushFront (Data data) { AddDataAtBeginning (list.get (), data); }
+		void PopFront () { RemoveNode (list.get (), NULL, list.get ()->headPtr); }
+		void InsertAt (Index position, Data data) { AddDataFromBeginning (list.get (), data, position); }
+		void InsertFromEnd (Index position, Data data) { AddDataFromEnd (list.get (), data, position); }
+		void AppendArray (const Data *dataArray, Length numData) { AddArrayAtEnd (list.get (), dataArray, numData); }
+		void PrependArray (const Data *dataArray, Length numData) { AddArrayAtBeginning (list.get (), dataArray, numData); }
+		void CopyToArray (Data *dataArray) { ListToArray (list.get (), dataArray, list.size ()); }
+
+		// Walks an iterator up to the end of the list seen as const, to keep mixed iterator comparisons compiled
+		long long Sum () {
+			const ll::List &constList = list;
+			ll::List::iterator it;
+			long long sum = 0;
+
+			for (it = list.begin (); it != constList.end (); ++it) {
+				sum += *it;
+			}
+			return sum;
+		}
+		Data At (Index position) { return GetNodeAtPosition (list.get (), position)->data; }
+		bool Contains (Data data) { return ContainsData (list.get (), data); }
+		Length Count (Data data) { return CountData (list.get (), data); }
+		void RemoveValue (Data data) { RemoveData (list.get (), data); }
+		void RemoveEven () { RemoveIf (list.get (), IsEven, NULL); }
+		void RemoveSet (const Data *dataArray, Length numData) { RemoveDataSet (list.get (), dataArray, numData); }
+		void Clear () { RemoveAllNodes (list.get ()); }
+		void Reverse () { ReverseList (list.get ()); }
+		void Rotate (Index rotation) { RotateList (list.get (), rotation); }
+		void Sort () { SortList (list.get ()); }
+		void InsertSorted (Data data) { AddDataInOrder (list.get (), data); }
+		void Merge (LinkedListAdapter &other) { MergeSortedLists (list.get (), other.list.get ()); }
+		void SplitOff (Index position, LinkedListAdapter &other) { SplitList (list.get (), position, other.list.get ()); }
+		void Append (LinkedListAdapter &other) { ConcatLists (list.get (), other.list.get ()); }
+		void Print () { PrintList (*list.get ()); }
+
+		// Walks the list once with a cursor: removes values divisible by 4, and adds a copy before values 1 modulo 4
+		void EditPass () {
+			ListCursor cursor;
+			Data data;
+
+			AttachCursor (list.get (), &cursor);
+			while (cursor.currNodePtr != NULL) {
+				data = cursor.currNodePtr->data;
+				if (data % 4 == 0) {
+					CursorRemove (&cursor);
+				}
+				else {
+					if (data % 4 == 1) {
+						CursorInsertBefore (&cursor, data);
+					}
+					CursorAdvance (&cursor);
+				}
+			}
+			DetachCursor (&cursor);
+		}
+
+		// Adds data after each of the given positions (ascending), moving one cursor forward
+		void SeekInsert (const Index *positions, Length numPositions) {
+			ListCursor cursor;
+			Index i;
+
+			AttachCursor (list.get (), &cursor);
+			for (i = 0; i < numPositions; i++) {
+				CursorSeek (&cursor, positions[i]);
+				CursorInsertAfter (&cursor, i);
+			}
+			sink += CursorPosition (&cursor);
+			DetachCursor (&cursor);
+		}
+	};
+
+	typedef LinkedListAdapter<MALLOC_NODES> PlainListAdapter;
+	typedef LinkedListAdapter<POOLED_NODES> PooledListAdapter;
+	typedef LinkedListAdapter<INDEXED_NODES> IndexedListAdapter;
+	typedef LinkedListAdapter<VALUE_INDEXED_NODES> ValueIndexedListAdapter;
+
+	// For an UnrolledList under test (only the operations "unrolledlist.h" has)
+	class UnrolledListAdapter {
+	public:
+		static const bool isContiguous = false;
+		static const bool canScatter = false;	// its nodes come from aligned_alloc, which does not reuse freed blocks in order
+
+		UnrolledList list;
+
+		UnrolledListAdapter () : list (InitialiseUnrolledList ()) {}
+		~UnrolledListAdapter () { UnrolledRemoveAllNodes (&list); }
+
+		static const char *Name () { return "UnrolledList"; }
+		Length Size () const { return list.numData; }
+		void Scatter (Length numNodes) { (void) numNodes; }
+
+		void PushBack (Data data) { UnrolledAddDataAtEnd (&list, data); }
+		void PushFront (Data data) { UnrolledAddDataAtBeginning (&list, data); }
+		void InsertAt (Index position, Data data) { UnrolledAddDataFromBeginning (&list, data, position); }
+		void InsertFromEnd (Index position, Data data) { UnrolledAddDataFromEnd (&list, data, position); }
+		void RemoveValue (Data data) { UnrolledRemoveData (&list, data); }
+		void Clear () { UnrolledRemoveAllNodes (&list); }
+		void Reverse () { UnrolledReverseList (&list); }
+		void Rotate (Index rotation) { UnrolledRotateList (&list, rotation); }
+		void Print () { PrintUnrolledList (list); }
+
+		long long Sum () const {
+			const UnrolledNode *nodePtr;
+			long long sum;
+			Index i;
+
+			sum = 0;
+			for (nodePtr = list.headPtr; nodePtr != NULL; nodePtr = nodePtr->nextNodePtr) {
+				for (i = 0; i < nodePtr->numData; i++) {
+					sum += nodePtr->data[i];
+				}
+			}
+			return sum;
+		}
+	};
+
+	// Helper for the standard containers: the data set of RemoveDataSet, sorted for binary search (as RemoveDataSet does)
+	std::vector<Data> SortedSet (const Data *dataArray, Length numData) {
+		std::vector<Data> dataSet (dataArray, dataArray + numData);
+
+		std::sort (dataSet.begin (), dataSet.end ());
+		return dataSet;
+	}
+
+	// Helper for the standard containers: prints the data in the format of PrintList, one printf call per value
+	template <typename Container>
+	void PrintEach (const Container &container) {
+		for (Data data : container) {
+			printf ("%d -> ", data);
+		}
+		printf ("NULL\n");
+	}
+
+	// For a std::forward_list under test. It keeps an iterator to its last node, as LinkedList keeps tailPtr.
+	class ForwardListAdapter {
+	public:
+		static const bool isContiguous = false;
+		static const bool canScatter = true;
+
+		std::forward_list<Data> list;
+		std::forward_list<Data>::iterator tail;
+		Length numData;
+
+		ForwardListAdapter () : tail (list.before_begin ()), numData (0) {}
+
+		static const char *Name () { return "std::forward_list"; }
+		Length Size () const { return numData; }
+		void Scatter (Length numNodes) { ScatterHeap (numNodes, sizeof (Data) + sizeof (void *)); }
+
+		// Finds the last node again, after an operation that relinks the list
+		void ResetTail () {
+			std::forward_list<Data>::iterator it;
+
+			tail = list.before_begin ();
+			numData = 0;
+			for (it = list.begin (); it != list.end (); ++it) {
+				tail = it;
+				numData++;
+			}
+		}
+
+		void PushBack (Data data) {
+			tail = list.insert_after (tail, data);
+			numData++;
+		}
+
+		void PushFront (Data data) {
+			list.push_front (data);
+			if (numData++ == 0) {
+				tail = list.begin ();
+			}
+		}
+
+		void PopFront () {
+			list.pop_front ();
+			if (--numData == 0) {
+				tail = list.before_begin ();
+			}
+		}
+
+		void InsertAt (Index position, Data data) {
+			std::forward_list<Data>::iterator newIt;
+
+			newIt = list.insert_after (std::next (list.before_begin (), position), data);
+			if (position == numData++) {
+				tail = newIt;
+			}
+		}
+
+		void InsertFromEnd (Index position, Data data) { InsertAt (numData - position, data); }
+
+		void AppendArray (const Data *dataArray, Length numData) {
+			tail = list.insert_after (tail, dataArray, dataArray + numData);
+			this->numData += numData;
+		}
+
+		void PrependArray (const Data *dataArray, Length numData) {
+			std::forward_list<Data>::iterator lastIt;
+
+			lastIt = list.insert_after (list.before_begin (), dataArray, dataArray + numData);
+			if (this->numData == 0) {
+				tail = lastIt;
+			}
+			this->numData += numData;
+		}
+
+		void CopyToArray (Data *dataArray) { std::copy (list.begin (), list.end (), dataArray); }
+		long long Sum () const { return std::accumulate (list.begin (), list.end (), 0LL); }
+		Data At (Index position) { return *std::next (list.begin (), position); }
+		bool Contains (Data data) { return std::find (list.begin (), list.end (), data) != list.end (); }
+		Length Count (Data data) { return std::count (list.begin (), list.end (), data); }
+		void RemoveValue (Data data) { list.remove (data); ResetTail (); }
+		void RemoveEven () { list.remove_if ([] (Data data) { return data % 2 == 0; }); ResetTail (); }
+
+		void RemoveSet (const Data *dataArray, Length numData) {
+			std::vector<Data> dataSet (SortedSet (dataArray, numData));
+
+			list.remove_if ([&dataSet] (Data data) { return std::binary_search (dataSet.begin (), dataSet.end (), data); });
+			ResetTail ();
+		}
+
+		void Clear () {
+			list.clear ();
+			tail = list.before_begin ();
+			numData = 0;
+		}
+
+		void Reverse () {
+			std::forward_list<Data>::iterator oldFirstIt;
+
+			if (numData > 0) {
+				oldFirstIt = list.begin ();
+				list.reverse ();
+				tail = oldFirstIt;
+			}
+		}
+
+		// Right rotation, as RotateList: the first numData-rotation nodes are moved after the last one
+		void Rotate (Index rotation) {
+			std::forward_list<Data>::iterator newTailIt;
+
+			rotation = ((rotation % numData) + numData) % numData;
+			if (rotation != 0) {
+				newTailIt = std::next (list.before_begin (), numData - rotation);
+				list.splice_after (tail, list, list.before_begin (), std::next (newTailIt));
+				tail = newTailIt;
+			}
+		}
+
+		void Sort () { list.sort (); ResetTail (); }
+
+		void InsertSorted (Data data) {
+			std::forward_list<Data>::iterator prevIt, newIt;
+
+			prevIt = list.before_begin ();
+			while (std::next (prevIt) != list.end () && *std::next (prevIt) <= data) {
+				++prevIt;
+			}
+			newIt = list.insert_after (prevIt, data);
+			if (prevIt == tail) {
+				tail = newIt;
+			}
+			numData++;
+		}
+
+		void Merge (ForwardListAdapter &other) {
+			list.merge (other.list);
+			other.Clear ();
+			ResetTail ();
+		}
+
+		// Moves the data from position onwards to the end of other
+		void SplitOff (Index position, ForwardListAdapter &other) {
+			std::forward_list<Data>::iterator prevIt;
+
+			if (position < numData) {
+				prevIt = std::next (list.before_begin (), position);
+				other.list.splice_after (other.tail, list, prevIt, list.end ());
+				other.tail = tail;
+				other.numData += numData - position;
+				tail = prevIt;
+				numData = position;
+			}
+		}
+
+		void Append (ForwardListAdapter &other) {
+			if (other.numData > 0) {
+				list.splice_after (tail, other.list);
+				tail = other.tail;
+				numData += other.numData;
+				other.tail = other.list.before_begin ();
+				other.numData = 0;
+			}
+		}
+
+		void Print () { PrintEach (list); }
+
+		void EditPass () {
+			std::forward_list<Data>::iterator prevIt, it;
+			Data data;
+
+			prevIt = list.before_begin ();
+			it = list.begin ();
+			while (it != list.end ()) {
+				data = *it;
+				if (data % 4 == 0) {
+					it = list.erase_after (prevIt);
+				}
+				else {
+					if (data % 4 == 1) {
+						list.insert_after (prevIt, data);
+					}
+					prevIt = it;
+					++it;
+				}
+			}
+			ResetTail ();
+		}
+
+		void SeekInsert (const Index *positions, Length numPositions) {
+			std::forward_list<Data>::iterator it;
+			Index index, i;
+
+			it = list.begin ();
+			index = 0;
+			for (i = 0; i < numPositions; i++) {
+				std::advance (it, positions[i] - index);
+				index = positions[i];
+				list.insert_after (it, i);
+			}
+			numData += numPositions;
+			ResetTail ();
+		}
+	};
+
+	// For a std::list under test. Positions are walked to from whichever end is nearer.
+	class ListAdapter {
+	public:
+		static const bool isContiguous = false;
+		static const bool canScatter = true;
+
+		std::list<Data> list;
+
+		static const char *Name () { return "std::list"; }
+		Length Size () const { return list.size (); }
+		void Scatter (Length numNodes) { ScatterHeap (numNodes, sizeof (Data) + 2 * sizeof (void *)); }
+
+		std::list<Data>::iterator Position (Index position) {
+			Length size = list.size ();
+
+			return (position <= size / 2) ? std::next (list.begin (), position) : std::prev (list.end (), size - position);
+		}
+
+		void PushBack (Data data) { list.push_back (data); }
+		void PushFront (Data data) { list.push_front (data); }
+		void PopFront () { list.pop_front (); }
+		void InsertAt (Index position, Data data) { list.insert (Position (position), data); }
+		void InsertFromEnd (Index position, Data data) { list.insert (Position (list.size () - position), data); }
+		void AppendArray (const Data *dataArray, Length numData) { list.insert (list.end (), dataArray, dataArray + numData); }
+		void PrependArray (const Data *dataArray, Length numData) { list.insert (list.begin (), dataArray, dataArray + numData); }
+		void CopyToArray (Data *dataArray) { std::copy (list.begin (), list.end (), dataArray); }
+		long long Sum () const { return std::accumulate (list.begin (), list.end (), 0LL); }
+		Data At (Index position) { return *Position (position); }
+		bool Contains (Data data) { return std::find (list.begin (), list.end (), data) != list.end (); }
+		Length Count (Data data) { return std::count (list.begin (), list.end (), data); }
+		void RemoveValue (Data data) { list.remove (data); }
+		void RemoveEven () { list.remove_if ([] (Data data) { return data % 2 == 0; }); }
+
+		void RemoveSet (const Data *dataArray, Length numData) {
+			std::vector<Data> dataSet (SortedSet (dataArray, numData));
+
+			list.remove_if ([&dataSet] (Data data) { return std::binary_search (dataSet.begin (), dataSet.end (), data); });
+		}
+
+		void Clear () { list.clear (); }
+		void Reverse () { list.reverse (); }
+
+		void Rotate (Index rotation) {
+			Length size = list.size ();
+
+			rotation = ((rotation % size) + size) % size;
+			if (rotation != 0) {
+				list.splice (list.end (), list, list.begin (), Position (size - rotation));
+			}
+		}
+
+		void Sort () { list.sort (); }
+
+		void InsertSorted (Data data) {
+			list.insert (std::find_if (list.begin (), list.end (), [data] (Data other) { return other > data; }), data);
+		}
+
+		void Merge (ListAdapter &other) { list.merge (other.list); }
+		void SplitOff (Index position, ListAdapter &other) { other.list.splice (other.list.end (), list, Position (position), list.end ()); }
+		void Append (ListAdapter &other) { list.splice (list.end (), other.list); }
+		void Print () { PrintEach (list); }
+
+		void EditPass () {
+			std::list<Data>::iterator it;
+			Data data;
+
+			it = list.begin ();
+			while (it != list.end ()) {
+				data = *it;
+				if (data % 4 == 0) {
+					it = list.erase (it);
+				}
+				else {
+					if (data % 4 == 1) {
+						list.insert (it, data);
+					}
+					++it;
+				}
+			}
+		}
+
+		void SeekInsert (const Index *positions, Length numPositions) {
+			std::list<Data>::iterator it;
+			Index index, i;
+
+			it = list.begin ();
+			index = 0;
+			for (i = 0; i < numPositions; i++) {
+				std::advance (it, positions[i] - index);
+				index = positions[i];
+				list.insert (std::next (it), i);
+			}
+		}
+	};
+
+	// For a std::vector under test. Inserting and removing away from the end moves the rest of the array.
+	// Its one block is the same in both memory layouts, so its "scattered" rows repeat the "sequential" ones.
+	class VectorAdapter {
+	public:
+		static const bool isContiguous = true;
+		static const bool canScatter = true;
+
+		std::vector<Data> array;
+
+		static const char *Name () { return "std::vector"; }
+		Length Size () const { return array.size (); }
+		void Scatter (Length numNodes) { (void) numNodes; }
+
+		void PushBack (Data data) { array.push_back (data); }
+		void PushFront (Data data) { array.insert (array.begin (), data); }
+		void PopFront () { array.erase (array.begin ()); }
+		void InsertAt (Index position, Data data) { array.insert (array.begin () + position, data); }
+		void InsertFromEnd (Index position, Data data) { array.insert (array.end () - position, data); }
+		void AppendArray (const Data *dataArray, Length numData) { array.insert (array.end (), dataArray, dataArray + numData); }
+		void PrependArray (const Data *dataArray, Length numData) { array.insert (array.begin (), dataArray, dataArray + numData); }
+		void CopyToArray (Data *dataArray) { std::copy (array.begin (), array.end (), dataArray); }
+		long long Sum () const { return std::accumulate (array.begin (), array.end (), 0LL); }
+		Data At (Index position) { return array[position]; }
+		bool Contains (Data data) { return std::find (array.begin (), array.end (), data) != array.end (); }
+		Length Count (Data data) { return std::count (array.begin (), array.end (), data); }
+		void RemoveValue (Data data) { array.erase (std::remove (array.begin (), array.end (), data), array.end ()); }
+
+		void RemoveEven () {
+			array.erase (std::remove_if (array.begin (), array.end (), [] (Data data) { return data % 2 == 0; }), array.end ());
+		}
+
+		void RemoveSet (const Data *dataArray, Length numData) {
+			std::vector<Data> dataSet (SortedSet (dataArray, numData));
+
+			array.erase (std::remove_if (array.begin (), array.end (),
+				[&dataSet] (Data data) { return std::binary_search (dataSet.begin (), dataSet.end (), data); }), array.end ());
+		}
+
+		void Clear () { array.clear (); }
+		void Reverse () { std::reverse (array.begin (), array.end ()); }
+
+		void Rotate (Index rotation) {
+			Length size = array.size ();
+
+			rotation = ((rotation % size) + size) % size;
+			std::rotate (array.begin (), array.begin () + (size - rotation), array.end ());
+		}
+
+		void Sort () { std::sort (array.begin (), array.end ()); }
+		void InsertSorted (Data data) { array.insert (std::upper_bound (array.begin (), array.end (), data), data); }
+
+		void Merge (VectorAdapter &other) {
+			Length firstSize = array.size ();
+
+			array.insert (array.end (), other.array.begin (), other.array.end ());
+			std::inplace_merge (array.begin (), array.begin () + firstSize, array.end ());
+			other.array.clear ();
+		}
+
+		void SplitOff (Index position, VectorAdapter &other) {
+			other.array.insert (other.array.end (), array.begin () + position, array.end ());
+			array.resize (position);
+		}
+
+		void Append (VectorAdapter &other) {
+			array.insert (array.end (), other.array.begin (), other.array.end ());
+			other.array.clear ();
+		}
+
+		void Print () { PrintEach (array); }
+
+		// Edits are made while copying into a new array, the usual way with arrays
+		void EditPass () {
+			std::vector<Data> newArray;
+
+			newArray.reserve (array.size () + array.size () / 4);
+			for (Data data : array) {
+				if (data % 4 != 0) {
+					if (data % 4 == 1) {
+						newArray.push_back (data);
+					}
+					newArray.push_back (data);
+				}
+			}
+			array.swap (newArray);
+		}
+
+		void SeekInsert (const Index *positions, Length numPositions) {
+			Index i;
+
+			for (i = 0; i < numPositions; i++) {
+				array.insert (array.begin () + positions[i] + 1, i);
+			}
+		}
+	};
+
+	// For two lists merged by the merge scenario
+	template <typename Adapter>
+	struct MergeState {
+		Adapter first, second;
+		Length Size () const { return first.Size (); }
+	};
+
+	// Number of times the pool_reuse scenario fills and empties its list
+	const Length NUM_POOL_CYCLES = 10;
+
+	// For the pool_reuse scenario: a list taking its nodes from a node pool, and a second list keeping one node of the
+	// same pool in use, so that emptying the first list returns its nodes to the free list rather than freeing the slabs
+	struct PoolReuseState {
+		PooledListAdapter adapter;
+		LinkedList pinList;
+
+		PoolReuseState () : pinList (InitialiseList ()) {
+			AttachPool (&pinList, &(adapter.pool));
+			AddDataAtEnd (&pinList, 0);
+		}
+		~PoolReuseState () { RemoveAllNodes (&pinList); }
+		Length Size () const { return adapter.Size (); }
+	};
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.0
+	 * Helper function to find the number of nodes in all slabs of a node pool
+	 * Input: pool (const NodePool &)
+	 * Return value: number of nodes, in use or not
+	 * Time complexity: O(number of slabs)
+	 */
+	Length PoolSlabNodes (const NodePool &pool) {
+		const NodeSlab *slabPtr;
+		Length numNodes = 0;
+
+		for (slabPtr = pool.slabListPtr; slabPtr != NULL; slabPtr = slabPtr->nextSlabPtr) {
+			numNodes += slabPtr->numNodes;
+		}
+		return numNodes;
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.0
+	 * Helper function to check that a node pool has not grown since an earlier count, and to say so if it has
+	 * Inputs: scenario, container (const char *): what is checked, state (const PoolReuseState &),
+	 * firstSlabNodes (Length) (int): PoolSlabNodes after the first cycle
+	 * Return value: none
+	 */
+	void CheckPoolReuse (const char *scenario, const char *container, const PoolReuseState &state, Length firstSlabNodes) {
+		Length lastSlabNodes = PoolSlabNodes (state.adapter.pool);
+
+		if (lastSlabNodes > firstSlabNodes) {
+			printf ("Error: %s, %s: the node pool grew from %d to %d nodes over %d cycles, with %d nodes in use\n",
+				scenario, container, firstSlabNodes, lastSlabNodes, NUM_POOL_CYCLES, state.adapter.pool.numNodesInUse);
+		}
+	}
+
+	// Number of pieces a list is cut into by the reshard scenario
+	const Length NUM_SHARDS = 16;
+
+	// For a list and the pieces it is cut into by the reshard scenario (shards[0] is not used: the list keeps one piece)
+	template <typename Adapter>
+	struct ShardState {
+		Adapter whole;
+		Adapter shards[NUM_SHARDS];
+		Length Size () const { return whole.Size (); }
+	};
+
+	// For the inputs of all scenarios at one size, made once so that every container gets the same ones
+	struct Inputs {
+		Length size;
+		std::vector<Data> values;		// random, in [0, size)
+		std::vector<Data> firstHalf, secondHalf;	// the two halves of values, each sorted
+		std::vector<Index> randomPositions;	// for inserting at random positions (WalkOps (size) of them)
+		std::vector<Index> nearTailPositions;	// for inserting near the tail, counted from the tail
+		std::vector<Index> lookupPositions;	// for looking up random positions
+		std::vector<Index> seekPositions;	// ascending, for a cursor moving forward
+		std::vector<Index> rotations;		// for rotating the list
+		std::vector<Data> removeSet;		// for RemoveDataSet
+		mutable std::vector<Data> copyBuffer;	// for ListToArray
+		std::string textFileName, snapshotFileName, copyFileName;
+		std::string text;			// contents of textFileName
+	};
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to make the inputs of all scenarios at one size, and the files for the input/output scenarios
+	 * Input: size (Length) (int)
+	 * Return value: the inputs; file names are empty if the files could not be made
+	 * Time complexity: O(size log size)
+	 * Space complexity: O(size)
+	 */
+	Inputs MakeInputs (Length size) {
+		std::mt19937 generator (size);
+		std::uniform_int_distribution<Data> valueDistribution (0, size - 1);
+		Inputs inputs;
+		LinkedList list;
+		char fileName[64];
+		int fileDescriptor;
+		Length numOps;
+		Index i;
+
+		inputs.size = size;
+		inputs.values.resize (size);
+		for (i = 0; i < size; i++) {
+			inputs.values[i] = valueDistribution (generator);
+		}
+		inputs.firstHalf.assign (inputs.values.begin (), inputs.values.begin () + size / 2);
+		inputs.secondHalf.assign (inputs.values.begin () + size / 2, inputs.values.end ());
+		std::sort (inputs.firstHalf.begin (), inputs.firstHalf.end ());
+		std::sort (inputs.secondHalf.begin (), inputs.secondHalf.end ());
+
+		numOps = WalkOps (size);
+		for (i = 0; i < numOps; i++) {
+			inputs.randomPositions.push_back (std::uniform_int_distribution<Index> (0, size + i) (generator));
+			inputs.nearTailPositions.push_back (std::uniform_int_distribution<Index> (0, 16) (generator));
+			inputs.lookupPositions.push_back (valueDistribution (generator));
+		}
+
+		// one position in every 16; the i-th is shifted by the i nodes added before it
+		for (i = 0; i < size / 16; i++) {
+			inputs.seekPositions.push_back (16 * i + std::uniform_int_distribution<Index> (0, 15) (generator) + i);
+		}
+
+		for (i = 0; i < 16; i++) {
+			inputs.rotations.push_back (std::uniform_int_distribution<Index> (1, size - 1) (generator));
+		}
+		for (i = 0; i < 64; i++) {
+			inputs.removeSet.push_back (valueDistribution (generator));
+		}
+		inputs.copyBuffer.resize (size);
+
+		// the files read back by the input/output scenarios
+		list = InitialiseList ();
+		AddArrayAtEnd (&list, inputs.values.data (), size);
+
+		strcpy (fileName, "/tmp/listbenchmarkXXXXXX");
+		fileDescriptor = mkstemp (fileName);
+		if (fileDescriptor >= 0) {
+			if (SerialiseListToFile (&list, fileDescriptor, LIST_FORMAT_LINES)) {
+				inputs.textFileName = fileName;
+				inputs.text.resize (lseek (fileDescriptor, 0, SEEK_END));
+				if (pread (fileDescriptor, &inputs.text[0], inputs.text.size (), 0) != (ssize_t) inputs.text.size ()) {
+					inputs.text.clear ();
+				}
+			}
+			close (fileDescriptor);
+		}
+
+		strcpy (fileName, "/tmp/listbenchmarkXXXXXX");
+		fileDescriptor = mkstemp (fileName);
+		if (fileDescriptor >= 0) {
+			close (fileDescriptor);
+			if (SaveList (&list, fileName)) {
+				inputs.snapshotFileName = fileName;
+			}
+		}
+
+		strcpy (fileName, "/tmp/listbenchmarkXXXXXX");
+		fileDescriptor = mkstemp (fileName);
+		if (fileDescriptor >= 0) {
+			close (fileDescriptor);
+			inputs.copyFileName = fileName;
+		}
+
+		RemoveAllNodes (&list);
+		return inputs;
+	}
+
+	// Helper to build a container from the values of the inputs, with its nodes scattered in memory if asked to
+	template <typename Adapter>
+	void Build (Adapter &adapter, const std::vector<Data> &values, bool isScattered) {
+		if (isScattered) {
+			adapter.Scatter (values.size ());
+		}
+		for (Data data : values) {
+			adapter.PushBack (data);
+		}
+	}
+
+	// For calling a generic lambda once per container type
+	template <typename Adapter>
+	struct AdapterTag {
+		typedef Adapter Type;
+	};
+
+	template <typename... Adapters, typename Scenario>
+	void ForEachAdapter (Scenario scenario) {
+		(scenario (AdapterTag<Adapters> ()), ...);
+	}
+
+	const char *scenarioFilter;
+
+	// Whether a scenario is to be run
+	bool IsSelected (const char *scenario) {
+		return scenarioFilter == NULL || strcmp (scenario, scenarioFilter) == 0;
+	}
+
+	const char *PatternName (bool isScattered) {
+		return isScattered ? "scattered" : "sequential";
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.1
+	 * Function to run the scenarios that add data to a list
+	 * (AddDataAtEnd, MakeNode and AddNode, AddDataAtBeginning, AddDataFromBeginning, AddDataFromEnd, AddArrayAtEnd,
+	 * AddArrayAtBeginning, AddDataInOrder), and the check that bulk additions and compaction reuse the freed nodes of a
+	 * node pool
+	 * Input: inputs (const Inputs &): inputs at one size
+	 * Return value: none
+	 */
+	void RunAddScenarios (const Inputs &inputs) {
+		Length size = inputs.size;
+
+		if (IsSelected ("push_back")) {
+			ForEachAdapter<PlainListAdapter, PooledListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter,
+				VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("push_back", Adapter::Name (), "sequential", size, [] (Adapter &) {},
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); return size; });
+			});
+
+			// nodes made by the caller (malloc and MakeNode), added with AddNode
+			Measure<PlainListAdapter> ("push_back", "LinkedList (MakeNode+AddNode)", "sequential", size,
+				[] (PlainListAdapter &) {},
+				[&] (PlainListAdapter &adapter) {
+					LinkedList *listPtr = adapter.list.get ();
+					ListNode *nodePtr;
+
+					for (Data data : inputs.values) {
+						nodePtr = (ListNode *) malloc (sizeof (ListNode));
+						*nodePtr = MakeNode (data);
+						AddNode (listPtr, listPtr->tailPtr, nodePtr);
+					}
+					return size;
+				});
+		}
+
+		if (IsSelected ("push_front")) {
+			ForEachAdapter<PlainListAdapter, PooledListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter,
+				VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Length numOps = Adapter::isContiguous ? WalkOps (size) : size;
+				Measure<Adapter> ("push_front", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); },
+					[&] (Adapter &adapter) {
+						Index i;
+
+						for (i = 0; i < numOps; i++) {
+							adapter.PushFront (inputs.values[i]);
+						}
+						return numOps;
+					});
+			});
+		}
+
+		if (IsSelected ("insert_random")) {
+			ForEachAdapter<PlainListAdapter, PooledListAdapter, IndexedListAdapter, UnrolledListAdapter, ForwardListAdapter,
+				ListAdapter, VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("insert_random", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); },
+					[&] (Adapter &adapter) {
+						Length numOps = inputs.randomPositions.size ();
+						Index i;
+
+						for (i = 0; i < numOps; i++) {
+							adapter.InsertAt (inputs.randomPositions[i], inputs.values[i]);
+						}
+						return numOps;
+					});
+			});
+		}
+
+		if (IsSelected ("insert_near_tail")) {
+			ForEachAdapter<PlainListAdapter, IndexedListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter,
+				VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("insert_near_tail", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); },
+					[&] (Adapter &adapter) {
+						Length numOps = inputs.nearTailPositions.size ();
+						Index i;
+
+						for (i = 0; i < numOps; i++) {
+							adapter.InsertFromEnd (inputs.nearTailPositions[i], inputs.values[i]);
+						}
+						return numOps;
+					});
+			});
+		}
+
+		if (IsSelected ("append_array")) {
+			ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("append_array", Adapter::Name (), "sequential", size, [] (Adapter &) {},
+					[&] (Adapter &adapter) { adapter.AppendArray (inputs.values.data (), size); return size; });
+			});
+		}
+
+		// the nodes freed to the pool by each cycle must be reused by the next, so the pool stays the same size
+		if (IsSelected ("pool_reuse")) {
+			Measure<PoolReuseState> ("pool_reuse", "LinkedList+pool (array+clear)", "sequential", size,
+				[] (PoolReuseState &) {},
+				[&] (PoolReuseState &state) {
+					Length firstSlabNodes = 0;
+					Index i;
+
+					for (i = 0; i < NUM_POOL_CYCLES; i++) {
+						state.adapter.Clear ();
+						state.adapter.AppendArray (inputs.values.data (), size);
+						if (i == 0) {
+							firstSlabNodes = PoolSlabNodes (state.adapter.pool);
+						}
+					}
+					CheckPoolReuse ("pool_reuse", "LinkedList+pool (array+clear)", state, firstSlabNodes);
+					return NUM_POOL_CYCLES * size;
+				});
+
+			// each sort scatters the nodes, and the list compacts itself straight after
+			Measure<PoolReuseState> ("pool_reuse", "LinkedList+pool (sort+compact)", "sequential", size,
+				[&] (PoolReuseState &state) {
+					state.adapter.AppendArray (inputs.values.data (), size);
+					SetAutoCompact (state.adapter.list.get (), 0.5);
+				},
+				[&] (PoolReuseState &state) {
+					Length firstSlabNodes = 0;
+					ListNode *nodePtr;
+					Index i, j;
+
+					for (i = 0; i < NUM_POOL_CYCLES; i++) {
+						nodePtr = state.adapter.list.get ()->headPtr;
+						for (j = 0; j < size; j++) {
+							nodePtr->data = inputs.values[(i + j) % size];
+							nodePtr = nodePtr->nextNodePtr;
+						}
+						state.adapter.Sort ();
+						if (i == 0) {
+							firstSlabNodes = PoolSlabNodes (state.adapter.pool);
+						}
+					}
+					CheckPoolReuse ("pool_reuse", "LinkedList+pool (sort+compact)", state, firstSlabNodes);
+					return NUM_POOL_CYCLES * size;
+				});
+		}
+
+		if (IsSelected ("prepend_array")) {
+			ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("prepend_array", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); },
+					[&] (Adapter &adapter) { adapter.PrependArray (inputs.values.data (), size); return size; });
+			});
+		}
+
+		if (IsSelected ("insert_sorted")) {
+			ForEachAdapter<PlainListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("insert_sorted", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { adapter.AppendArray (inputs.firstHalf.data (), inputs.firstHalf.size ()); },
+					[&] (Adapter &adapter) {
+						Length numOps = WalkOps (size);
+						Index i;
+
+						for (i = 0; i < numOps; i++) {
+							adapter.InsertSorted (inputs.values[i]);
+						}
+						return numOps;
+					});
+			});
+		}
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.2
+	 * Function to run the scenarios that read a list without changing it
+	 * (traversal, before and after CompactList, ListToArray, GetNodeAtPosition, PrintList, PrintData, ListFragmentation,
+	 * and ContainsData and CountData, with and without a value index)
+	 * Input: inputs (const Inputs &): inputs at one size
+	 * Return value: none
+	 */
+	void RunReadScenarios (const Inputs &inputs) {
+		Length size = inputs.size;
+
+		for (bool isScattered : {false, true}) {
+			if (IsSelected ("traverse")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("traverse", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { sink += adapter.Sum (); return size; });
+				});
+			}
+
+			// the same walk after CompactList, to compare with the rows of "traverse"
+			if (IsSelected ("traverse_compacted")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					Measure<Adapter> ("traverse_compacted", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) {
+							Build (adapter, inputs.values, isScattered);
+							adapter.list.compact ();
+						},
+						[&] (Adapter &adapter) { sink += adapter.Sum (); return size; });
+				});
+			}
+
+			if (IsSelected ("fragmentation")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					Measure<Adapter> ("fragmentation", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { sink += (long long) (1000 * ListFragmentation (adapter.list.get ())); return size; });
+				});
+			}
+
+			if (IsSelected ("to_array")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("to_array", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) {
+							adapter.CopyToArray (inputs.copyBuffer.data ());
+							return size;
+						});
+				});
+			}
+
+			if (IsSelected ("lookup_random")) {
+				ForEachAdapter<PlainListAdapter, IndexedListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("lookup_random", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) {
+							Length numOps = inputs.lookupPositions.size ();
+							Index i;
+
+							for (i = 0; i < numOps; i++) {
+								sink += adapter.At (inputs.lookupPositions[i]);
+							}
+							return numOps;
+						});
+				});
+			}
+
+			// the lookup positions double as random values, about two thirds of which are in the list
+			for (const char *scenario : {"contains", "count"}) {
+				bool isCount = (std::string (scenario) == "count");
+
+				if (!IsSelected (scenario)) {
+					continue;
+				}
+				ForEachAdapter<PlainListAdapter, ValueIndexedListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> (scenario, Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) {
+							Length numOps = inputs.lookupPositions.size ();
+							Index i;
+
+							for (i = 0; i < numOps; i++) {
+								sink += isCount ? adapter.Count (inputs.lookupPositions[i]) : adapter.Contains (inputs.lookupPositions[i]);
+							}
+							return numOps;
+						});
+				});
+			}
+		}
+
+		if (IsSelected ("print")) {
+			ForEachAdapter<PlainListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Measure<Adapter> ("print", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); },
+					[&] (Adapter &adapter) { SilencedStdout silenced; adapter.Print (); return size; });
+			});
+
+			// one PrintData and one printf call per node, as PrintList used to do
+			Measure<PlainListAdapter> ("print", "LinkedList (PrintData)", "sequential", size,
+				[&] (PlainListAdapter &adapter) { Build (adapter, inputs.values, false); },
+				[&] (PlainListAdapter &adapter) {
+					SilencedStdout silenced;
+
+					for (Data data : adapter.list) {
+						PrintData (data);
+						printf (" -> ");
+					}
+					printf ("NULL\n");
+					return size;
+				});
+		}
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.1
+	 * Function to run the scenarios that remove data from a list
+	 * (RemoveNode, RemoveData with and without a value index, RemoveIf, RemoveDataSet, RemoveAllNodes)
+	 * Input: inputs (const Inputs &): inputs at one size
+	 * Return value: none
+	 */
+	void RunRemoveScenarios (const Inputs &inputs) {
+		Length size = inputs.size;
+
+		if (IsSelected ("pop_front")) {
+			ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+				typedef typename decltype (tag)::Type Adapter;
+				Length numOps = Adapter::isContiguous ? WalkOps (size) : size;
+				Measure<Adapter> ("pop_front", Adapter::Name (), "sequential", size,
+					[&] (Adapter &adapter) { Build (adapter, inputs.values, false); },
+					[&] (Adapter &adapter) {
+						Index i;
+
+						for (i = 0; i < numOps; i++) {
+							adapter.PopFront ();
+						}
+						return numOps;
+					});
+			});
+		}
+
+		for (bool isScattered : {false, true}) {
+			if (IsSelected ("remove_value")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ValueIndexedListAdapter, UnrolledListAdapter, ForwardListAdapter,
+					ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("remove_value", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.RemoveValue (inputs.values[size / 2]); return size; });
+				});
+			}
+
+			if (IsSelected ("remove_if")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("remove_if", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.RemoveEven (); return size; });
+				});
+			}
+
+			if (IsSelected ("remove_set")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("remove_set", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) {
+							adapter.RemoveSet (inputs.removeSet.data (), inputs.removeSet.size ());
+							return size;
+						});
+				});
+			}
+
+			if (IsSelected ("clear")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("clear", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.Clear (); return size; });
+				});
+			}
+		}
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.3
+	 * Function to run the scenarios that reorder a list or edit it through a cursor
+	 * (ReverseList, RotateList, SortList, SortListParallel, SortList with SetAutoCompact, CompactList, MergeSortedLists,
+	 * SplitList, SpliceRange and ConcatLists, and the cursor functions)
+	 * Input: inputs (const Inputs &): inputs at one size
+	 * Return value: none
+	 */
+	void RunReorderScenarios (const Inputs &inputs) {
+		Length size = inputs.size;
+		Length numThreads = std::max (2u, std::thread::hardware_concurrency ());
+		char containerName[64];
+
+		for (bool isScattered : {false, true}) {
+			if (IsSelected ("reverse")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("reverse", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.Reverse (); return size; });
+				});
+			}
+
+			if (IsSelected ("rotate")) {
+				ForEachAdapter<PlainListAdapter, IndexedListAdapter, UnrolledListAdapter, ForwardListAdapter, ListAdapter,
+					VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("rotate", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) {
+							for (Index rotation : inputs.rotations) {
+								adapter.Rotate (rotation);
+							}
+							return (Length) inputs.rotations.size ();
+						});
+				});
+			}
+
+			if (IsSelected ("sort")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("sort", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.Sort (); return size; });
+				});
+
+				snprintf (containerName, sizeof (containerName), "LinkedList (%d threads)", numThreads);
+				Measure<PlainListAdapter> ("sort", containerName, PatternName (isScattered), size,
+					[&] (PlainListAdapter &adapter) { Build (adapter, inputs.values, isScattered); },
+					[&] (PlainListAdapter &adapter) { SortListParallel (adapter.list.get (), numThreads); return size; });
+
+				// sorting scatters the nodes; this list compacts itself straight after
+				Measure<PlainListAdapter> ("sort", "LinkedList (auto-compact)", PatternName (isScattered), size,
+					[&] (PlainListAdapter &adapter) {
+						Build (adapter, inputs.values, isScattered);
+						SetAutoCompact (adapter.list.get (), 0.5);
+					},
+					[&] (PlainListAdapter &adapter) { adapter.Sort (); return size; });
+			}
+
+			if (IsSelected ("compact")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					Measure<Adapter> ("compact", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.list.compact (); return size; });
+				});
+			}
+
+			if (IsSelected ("merge")) {
+				ForEachAdapter<PlainListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<MergeState<Adapter>> ("merge", Adapter::Name (), PatternName (isScattered), size,
+						[&] (MergeState<Adapter> &state) {
+							// each list is built straight after its own scatter, so that both take scattered nodes
+							if (isScattered) {
+								state.first.Scatter (size / 2);
+							}
+							for (Index i = 0; i < size / 2; i++) {
+								state.first.PushBack (inputs.firstHalf[i]);
+							}
+							if (isScattered) {
+								state.second.Scatter (size / 2);
+							}
+							for (Index i = 0; i < size / 2; i++) {
+								state.second.PushBack (inputs.secondHalf[i]);
+							}
+						},
+						[&] (MergeState<Adapter> &state) { state.first.Merge (state.second); return size; });
+				});
+			}
+
+			if (IsSelected ("reshard")) {
+				ForEachAdapter<PlainListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<ShardState<Adapter>> ("reshard", Adapter::Name (), PatternName (isScattered), size,
+						[&] (ShardState<Adapter> &state) { Build (state.whole, inputs.values, isScattered); },
+						[&] (ShardState<Adapter> &state) {
+							Index i;
+
+							// each cut keeps one piece and passes the rest on to the next shard
+							state.whole.SplitOff (size / NUM_SHARDS, state.shards[1]);
+							for (i = 1; i < NUM_SHARDS-1; i++) {
+								state.shards[i].SplitOff (size / NUM_SHARDS, state.shards[i+1]);
+							}
+							for (i = 1; i < NUM_SHARDS; i++) {
+								state.whole.Append (state.shards[i]);
+							}
+							return 2 * (NUM_SHARDS-1);
+						});
+				});
+
+				// pieces moved off the front of the list with SpliceRange (the list ends up rotated)
+				Measure<ShardState<PlainListAdapter>> ("reshard", "LinkedList (SpliceRange)", PatternName (isScattered), size,
+					[&] (ShardState<PlainListAdapter> &state) { Build (state.whole, inputs.values, isScattered); },
+					[&] (ShardState<PlainListAdapter> &state) {
+						Index i;
+
+						for (i = 1; i < NUM_SHARDS; i++) {
+							SpliceRange (state.shards[i].list.get (), NULL, state.whole.list.get (), NULL, size / NUM_SHARDS);
+						}
+						for (i = 1; i < NUM_SHARDS; i++) {
+							state.whole.Append (state.shards[i]);
+						}
+						return 2 * (NUM_SHARDS-1);
+					});
+			}
+
+			if (IsSelected ("cursor_edit")) {
+				ForEachAdapter<PlainListAdapter, PooledListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Measure<Adapter> ("cursor_edit", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.EditPass (); return size; });
+				});
+			}
+
+			if (IsSelected ("cursor_seek")) {
+				ForEachAdapter<PlainListAdapter, IndexedListAdapter, ForwardListAdapter, ListAdapter, VectorAdapter> ([&] (auto tag) {
+					typedef typename decltype (tag)::Type Adapter;
+					if (isScattered && !Adapter::canScatter) {
+						return;
+					}
+					Length numOps = inputs.seekPositions.size ();
+					if (Adapter::isContiguous) {
+						numOps = std::min (numOps, WalkOps (size));
+					}
+					Measure<Adapter> ("cursor_seek", Adapter::Name (), PatternName (isScattered), size,
+						[&] (Adapter &adapter) { Build (adapter, inputs.values, isScattered); },
+						[&] (Adapter &adapter) { adapter.SeekInsert (inputs.seekPositions.data (), numOps); return numOps; });
+				});
+			}
+		}
+	}
+
+	// For a container in the input/output scenarios
+	struct DataVector {
+		std::vector<Data> array;
+		Length Size () const { return array.size (); }
+	};
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.0
+	 * Helper function to check that a file of the input/output scenarios can be opened, and to say so if it cannot
+	 * Inputs: scenario (const char *): the scenario the file is for, fileName, mode (const char *): as for fopen
+	 * Return value: true if the file could be opened (it is closed again)
+	 */
+	bool CanOpenFile (const char *scenario, const char *fileName, const char *mode) {
+		FILE *filePtr = fopen (fileName, mode);
+
+		if (filePtr == NULL) {
+			printf ("Note: could not open %s for the %s scenario, skipping\n", fileName, scenario);
+			return false;
+		}
+		fclose (filePtr);
+		return true;
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.1
+	 * Function to run the scenarios that read a list in from text or a binary snapshot, or save it
+	 * (ReadListFromFile and ParseListFromBuffer against fscanf; SaveList, LoadList and MapList against fwrite and fread)
+	 * Input: inputs (const Inputs &): inputs at one size
+	 * Return value: none
+	 */
+	void RunInputOutputScenarios (const Inputs &inputs) {
+		Length size = inputs.size;
+		const char *textFileName = inputs.textFileName.c_str ();
+		const char *snapshotFileName = inputs.snapshotFileName.c_str ();
+		const char *copyFileName = inputs.copyFileName.c_str ();
+
+		if (IsSelected ("ingest") && !inputs.text.empty () && CanOpenFile ("ingest", textFileName, "r")) {
+			Measure<PlainListAdapter> ("ingest", "LinkedList (ReadListFromFile)", "text", size, [] (PlainListAdapter &) {},
+				[&] (PlainListAdapter &adapter) {
+					int fileDescriptor = open (textFileName, O_RDONLY);
+
+					ReadListFromFile (adapter.list.get (), fileDescriptor);
+					close (fileDescriptor);
+					return size;
+				});
+
+			Measure<PlainListAdapter> ("ingest", "LinkedList (ParseListFromBuffer)", "text", size, [] (PlainListAdapter &) {},
+				[&] (PlainListAdapter &adapter) {
+					ParseListFromBuffer (adapter.list.get (), inputs.text.data (), inputs.text.size ());
+					return size;
+				});
+
+			Measure<PlainListAdapter> ("ingest", "LinkedList (fscanf)", "text", size, [] (PlainListAdapter &) {},
+				[&] (PlainListAdapter &adapter) {
+					FILE *filePtr = fopen (textFileName, "r");
+					Data data;
+
+					if (filePtr == NULL) {
+						return 0;
+					}
+					while (fscanf (filePtr, "%d", &data) == 1) {
+						adapter.PushBack (data);
+					}
+					fclose (filePtr);
+					return size;
+				});
+
+			Measure<DataVector> ("ingest", "std::vector (fscanf)", "text", size, [] (DataVector &) {},
+				[&] (DataVector &state) {
+					FILE *filePtr = fopen (textFileName, "r");
+					Data data;
+
+					if (filePtr == NULL) {
+						return 0;
+					}
+					while (fscanf (filePtr, "%d", &data) == 1) {
+						state.array.push_back (data);
+					}
+					fclose (filePtr);
+					return size;
+				});
+		}
+
+		if (IsSelected ("snapshot_save") && !inputs.copyFileName.empty ()
+			&& CanOpenFile ("snapshot_save", copyFileName, "wb")) {
+			Measure<PlainListAdapter> ("snapshot_save", "LinkedList (SaveList)", "binary", size,
+				[&] (PlainListAdapter &adapter) { Build (adapter, inputs.values, false); },
+				[&] (PlainListAdapter &adapter) { SaveList (adapter.list.get (), copyFileName); return size; });
+
+			Measure<DataVector> ("snapshot_save", "std::vector (fwrite)", "binary", size,
+				[&] (DataVector &state) { state.array = inputs.values; },
+				[&] (DataVector &state) {
+					FILE *filePtr = fopen (copyFileName, "wb");
+
+					if (filePtr == NULL) {
+						return 0;
+					}
+					fwrite (state.array.data (), sizeof (Data), state.array.size (), filePtr);
+					fclose (filePtr);
+					return size;
+				});
+		}
+
+		if (IsSelected ("snapshot_load") && !inputs.snapshotFileName.empty ()
+			&& CanOpenFile ("snapshot_load", snapshotFileName, "rb")) {
+			Measure<PlainListAdapter> ("snapshot_load", "LinkedList (LoadList)", "binary", size, [] (PlainListAdapter &) {},
+				[&] (PlainListAdapter &adapter) { LoadList (adapter.list.get (), snapshotFileName); return size; });
+
+			Measure<PlainListAdapter> ("snapshot_load", "LinkedList (MapList)", "binary", size, [] (PlainListAdapter &) {},
+				[&] (PlainListAdapter &adapter) { MapList (adapter.list.get (), snapshotFileName); return size; });
+
+			Measure<PooledListAdapter> ("snapshot_load", "LinkedList+pool (MapList)", "binary", size, [] (PooledListAdapter &) {},
+				[&] (PooledListAdapter &adapter) { MapList (adapter.list.get (), snapshotFileName); return size; });
+
+			Measure<DataVector> ("snapshot_load", "std::vector (fread)", "binary", size, [] (DataVector &) {},
+				[&] (DataVector &state) {
+					FILE *filePtr = fopen (snapshotFileName, "rb");
+					ListFileHeader header;
+
+					if (filePtr == NULL) {
+						return 0;
+					}
+					if (fread (&header, sizeof (header), 1, filePtr) == 1) {
+						state.array.resize (header.numData);
+						if (fread (state.array.data (), sizeof (Data), header.numData, filePtr) != header.numData) {
+							state.array.clear ();
+						}
+					}
+					fclose (filePtr);
+					return size;
+				});
+		}
+	}
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Helper function to time several producer threads feeding one consumer through a std::deque under a std::mutex,
+	 * in the same way as TimeConcurrentQueue
+	 * Inputs: numProducers (Length) (int): number of producer threads, numData (Length) (int): total number of data values
+	 * Return value: seconds from starting the producers to dequeuing the last value
+	 */
+	double TimeMutexQueue (Length numProducers, Length numData) {
+		std::deque<Data> queue;
+		std::mutex queueLock;
+		std::vector<std::thread> producers;
+		std::chrono::steady_clock::time_point startTime, stopTime;
+		Length numReceived;
+		bool isReceived;
+		Index i;
+
+		startTime = std::chrono::steady_clock::now ();
+		for (i = 0; i < numProducers; i++) {
+			Data firstData = i * (numData / numProducers);
+			Length numToSend = (i == numProducers-1) ? numData - firstData : numData / numProducers;
+
+			producers.emplace_back ([&queue, &queueLock, firstData, numToSend] () {
+				Index j;
+
+				for (j = 0; j < numToSend; j++) {
+					std::lock_guard<std::mutex> guard (queueLock);
+					queue.push_back (firstData + j);
+				}
+			});
+		}
+
+		numReceived = 0;
+		while (numReceived < numData) {
+			{
+				std::lock_guard<std::mutex> guard (queueLock);
+				isReceived = !queue.empty ();
+				if (isReceived) {
+					sink += queue.front ();
+					queue.pop_front ();
+				}
+			}
+			if (isReceived) {
+				numReceived++;
+			}
+			else {
+				std::this_thread::yield ();
+			}
+		}
+
+		stopTime = std::chrono::steady_clock::now ();
+		for (std::thread &producer : producers) {
+			producer.join ();
+		}
+		return std::chrono::duration<double> (stopTime - startTime).count ();
+	}
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Function to run the concurrent queue scenario: 1 to 64 producers, one consumer
+	 * Input: maxSize (Length) (int): the largest size run; at most this many values are sent through the queue
+	 * Return value: none
+	 */
+	void RunQueueScenarios (Length maxSize) {
+		Length numData = std::min (maxSize, MAX_QUEUE_DATA);
+		char patternName[32];
+		double seconds;
+
+		if (!IsSelected ("queue_mpsc")) {
+			return;
+		}
+
+		for (Length numProducers : queueProducerCounts) {
+			snprintf (patternName, sizeof (patternName), "%d producers", numProducers);
+
+			missCounter.Start ();
+			seconds = TimeConcurrentQueue (numProducers, numData);
+			PrintRow ("queue_mpsc", "ConcurrentQueue", patternName, numData, seconds * 1e9 / numData, -1,
+				missCounter.IsAvailable () ? (double) missCounter.Stop () / numData : -1);
+
+			missCounter.Start ();
+			seconds = TimeMutexQueue (numProducers, numData);
+			PrintRow ("queue_mpsc", "std::deque+std::mutex", patternName, numData, seconds * 1e9 / numData, -1,
+				missCounter.IsAvailable () ? (double) missCounter.Stop () / numData : -1);
+		}
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.0
+	 * Function to run the parallel traversal scenarios: each operation of "listparallel.h" on 1, 2, 4, ... threads (up to
+	 * the number of hardware threads), against the plain loop on one thread ("loop" rows)
+	 * They run once, on the largest size up to maxSize (and MAX_PARALLEL_NODES) that fits in memory, with the nodes in
+	 * list order (from a node pool) and scattered over the heap. An op is one node visited.
+	 * Inputs: maxSize (Length) (int): the largest size run, physicalBytes (double): bytes of physical memory
+	 * Return value: none
+	 */
+	void RunParallelScenarios (Length maxSize, double physicalBytes) {
+		const struct { const char *scenario; ParallelScan scan; } scans[] = {
+			{"parallel_count", PARALLEL_SCAN_COUNT}, {"parallel_sum", PARALLEL_SCAN_SUM},
+			{"parallel_minmax", PARALLEL_SCAN_MIN_MAX}, {"parallel_find", PARALLEL_SCAN_FIND},
+			{"parallel_map", PARALLEL_SCAN_MAP}
+		};
+		std::vector<Length> threadCounts;
+		Length size = 0, numRepetitions, maxThreads;
+		char patternName[32];
+		double seconds;
+		bool isAnySelected = false;
+		Index i;
+
+		for (const auto &entry : scans) {
+			isAnySelected = isAnySelected || IsSelected (entry.scenario);
+		}
+		for (Length candidateSize : benchmarkSizes) {
+			if (candidateSize <= std::min (maxSize, MAX_PARALLEL_NODES)
+				&& candidateSize * BYTES_PER_ELEMENT_ESTIMATE <= physicalBytes / 2) {
+				size = candidateSize;
+			}
+		}
+		if (!isAnySelected || size == 0) {
+			return;
+		}
+
+		maxThreads = std::max (1, (int) std::thread::hardware_concurrency ());
+		for (Length numThreads = 1; numThreads < maxThreads; numThreads *= 2) {
+			threadCounts.push_back (numThreads);
+		}
+		threadCounts.push_back (maxThreads);
+		numRepetitions = WalkOps (size);
+
+		for (bool isScattered : {false, true}) {
+			PooledListAdapter pooledList;
+			PlainListAdapter plainList;
+			LinkedList *listPtr;
+
+			if (isScattered) {
+				plainList.Scatter (size);
+			}
+			for (i = 0; i < size; i++) {
+				if (isScattered) {
+					plainList.PushBack (i);
+				}
+				else {
+					pooledList.PushBack (i);
+				}
+			}
+			listPtr = isScattered ? plainList.list.get () : pooledList.list.get ();
+
+			for (const auto &entry : scans) {
+				if (!IsSelected (entry.scenario)) {
+					continue;
+				}
+
+				missCounter.Start ();
+				seconds = TimeParallelScan (listPtr, 0, entry.scan, numRepetitions);
+				PrintRow (entry.scenario, "loop", PatternName (isScattered), size,
+					seconds * 1e9 / ((double) numRepetitions * size), -1,
+					missCounter.IsAvailable () ? (double) missCounter.Stop () / ((double) numRepetitions * size) : -1);
+
+				for (Length numThreads : threadCounts) {
+					snprintf (patternName, sizeof (patternName), "%s, %d thr", isScattered ? "scat" : "seq", numThreads);
+
+					missCounter.Start ();
+					seconds = TimeParallelScan (listPtr, numThreads, entry.scan, numRepetitions);
+					if (seconds < 0) {
+						missCounter.Stop ();
+						printf ("Note: could not start %d threads, skipping\n", numThreads);
+						break;
+					}
+					PrintRow (entry.scenario, "LinkedList (listparallel)", patternName, size,
+						seconds * 1e9 / ((double) numRepetitions * size), -1,
+						missCounter.IsAvailable () ? (double) missCounter.Stop () / ((double) numRepetitions * size) : -1);
+				}
+			}
+		}
+	}
+
+	/*
+	 * G V Vishwanath, 18th October 2026, v1.0
+	 * Function to run the node churn scenario: 1, 2, 4, ... pairs of producer and consumer threads (up to half the number
+	 * of hardware threads), each pair passing nodes through a list of its own, with the nodes malloc-ed and free-d
+	 * ("malloc" rows) or recycled through one node cache shared by all lists. An op is one node passed along; the pairs
+	 * split the data between them, so ns/op falls as far as allocation scales with the number of threads.
+	 * Input: maxSize (Length) (int): the largest size run; at most this many nodes are passed along
+	 * Return value: none
+	 */
+	void RunCacheScenarios (Length maxSize) {
+		Length numData = std::min (maxSize, MAX_CHURN_DATA), maxPairs;
+		std::vector<Length> pairCounts;
+		char patternName[32];
+		double seconds;
+
+		if (!IsSelected ("node_churn")) {
+			return;
+		}
+
+		maxPairs = std::max (1, (int) std::thread::hardware_concurrency () / 2);
+		for (Length numPairs = 1; numPairs < maxPairs; numPairs *= 2) {
+			pairCounts.push_back (numPairs);
+		}
+		pairCounts.push_back (maxPairs);
+
+		for (Length numPairs : pairCounts) {
+			snprintf (patternName, sizeof (patternName), "%d pairs", numPairs);
+
+			for (bool isCached : {false, true}) {
+				missCounter.Start ();
+				seconds = TimeNodeChurn (numPairs, numData / numPairs, isCached);
+				if (seconds < 0) {
+					missCounter.Stop ();
+					printf ("Note: could not start %d thread pairs, skipping\n", numPairs);
+					return;
+				}
+				PrintRow ("node_churn", isCached ? "LinkedList (NodeCache)" : "LinkedList (malloc)", patternName, numData,
+					seconds * 1e9 / numData, -1,
+					missCounter.IsAvailable () ? (double) missCounter.Stop () / numData : -1);
+			}
+		}
+	}
+
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Driver program: runs every scenario at every size up to maxSize, then the concurrent queue, parallel traversal and
+ * node churn scenarios
+ * Usage: listbenchmark [maxSize [scenario]]
+ */
+int main (int argc, char *argv[]) {
+	Length maxSize;
+	double physicalBytes;
+
+	maxSize = (argc > 1) ? atoi (argv[1]) : benchmarkSizes[sizeof (benchmarkSizes) / sizeof (benchmarkSizes[0]) - 1];
+	scenarioFilter = (argc > 2) ? argv[2] : NULL;
+	physicalBytes = (double) sysconf (_SC_PHYS_PAGES) * sysconf (_SC_PAGESIZE);
+
+	if (maxSize < benchmarkSizes[0]) {
+		printf ("Usage: %s [maxSize (at least %d) [scenario]]\n", argv[0], benchmarkSizes[0]);
+		return 1;
+	}
+	if (!missCounter.IsAvailable ()) {
+		printf ("Note: perf_event_open is not available, cache misses are not counted\n");
+	}
+
+	printf ("%-16s %-32s %-14s %10s %12s %11s %10s\n", "scenario", "container", "pattern", "size", "ns/op",
+		"bytes/elem", "misses/op");
+
+	for (Length size : benchmarkSizes) {
+		if (size > maxSize) {
+			break;
+		}
+		if (size * BYTES_PER_ELEMENT_ESTIMATE > physicalBytes / 2) {
+			printf ("Note: skipping size %d, which needs more than half of the physical memory\n", size);
+			continue;
+		}
+
+		Inputs inputs (MakeInputs (size));
+
+		RunAddScenarios (inputs);
+		RunReadScenarios (inputs);
+		RunRemoveScenarios (inputs);
+		RunReorderScenarios (inputs);
+		RunInputOutputScenarios (inputs);
+
+		for (const std::string &fileName : {inputs.textFileName, inputs.snapshotFileName, inputs.copyFileName}) {
+			if (!fileName.empty ()) {
+				unlink (fileName.c_str ());
+			}
+		}
+	}
+
+	RunQueueScenarios (maxSize);
+	RunParallelScenarios (maxSize, physicalBytes);
+	RunCacheScenarios (maxSize);
+	return 0;
+}
@@ -0,0 +1,157 @@
+#include <stdio.h>  			// For input/output
+#include <limits.h> 			// For data that is not in the list
+#include <time.h>   			// For the monotonic clock
+#include "../listparallel.h"		// For the parallel operations being timed
+#include "parallelbenchmark.h"		// For type declarations and function declarations of this file
+
+// Segments per thread: enough for a thread that finishes early to have something to steal
+#define SEGMENTS_PER_THREAD 8
+
+// Results are folded into this, so that the compiler cannot drop the work
+static volatile long long sink;
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function for ParallelMap: adds 1 to a data value
+ * Inputs: data (Data) (int), contextPtr (void *): not used
+ * Return value: data + 1
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static Data AddOne (Data data, void *contextPtr) {
+	(void) contextPtr;
+	return data + 1;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to do a parallel operation over a linked list with one plain loop on the calling thread, as a
+ * program without "listparallel.h" would
+ * Inputs: listPtr (LinkedList *): pointer to linked list, scan (ParallelScan) (int): the operation
+ * Return value: none
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+static void ScanSequentially (LinkedList *listPtr, ParallelScan scan) {
+	ListNode *currNodePtr;
+	long long result = 0;
+	Data minData = INT_MAX, maxData = INT_MIN;
+
+	if (scan == PARALLEL_SCAN_COUNT) {
+		for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+			result += (currNodePtr->data == 0);
+		}
+	}
+	else if (scan == PARALLEL_SCAN_SUM) {
+		for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+			result += currNodePtr->data;
+		}
+	}
+	else if (scan == PARALLEL_SCAN_MIN_MAX) {
+		for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+			if (currNodePtr->data < minData) {
+				minData = currNodePtr->data;
+			}
+			if (currNodePtr->data > maxData) {
+				maxData = currNodePtr->data;
+			}
+		}
+		result = (long long) minData + maxData;
+	}
+	else if (scan == PARALLEL_SCAN_FIND) {
+		for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+			if (currNodePtr->data == INT_MIN) {
+				break;
+			}
+		}
+		result = (currNodePtr != NULL);
+	}
+	else {
+		for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+			currNodePtr->data = AddOne (currNodePtr->data, NULL);
+		}
+	}
+
+	sink += result;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to do a parallel operation over a linked list using a worker pool
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list,
+ * scan (ParallelScan) (int): the operation
+ * Return value: none
+ * Time complexity: O(numNodes / numThreads + numSegments)
+ * Space complexity: O(1)
+ */
+static void ScanInParallel (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, ParallelScan scan) {
+	Data minData, maxData;
+
+	if (scan == PARALLEL_SCAN_COUNT) {
+		sink += ParallelCountData (poolPtr, segmentsPtr, 0);
+	}
+	else if (scan == PARALLEL_SCAN_SUM) {
+		sink += ParallelSum (poolPtr, segmentsPtr);
+	}
+	else if (scan == PARALLEL_SCAN_MIN_MAX) {
+		if (ParallelMinMax (poolPtr, segmentsPtr, &minData, &maxData)) {
+			sink += (long long) minData + maxData;
+		}
+	}
+	else if (scan == PARALLEL_SCAN_FIND) {
+		sink += (ParallelFindData (poolPtr, segmentsPtr, INT_MIN, NULL) != NULL);
+	}
+	else {
+		ParallelMap (poolPtr, segmentsPtr, AddOne, NULL);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to time a parallel operation over a linked list, or the sequential loop doing the same
+ * The worker pool is started and the segments attached before timing starts, and both are removed after it stops.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, numThreads (Length) (int): threads of the worker pool
+ * (0 => a plain loop on the calling thread), scan (ParallelScan) (int): the operation,
+ * numRepetitions (Length) (int): number of times the operation is done
+ * Return value: seconds taken by all repetitions, or -1 if the pool or the segments could not be made
+ * Assumptions: listPtr != NULL, numThreads >= 0, numRepetitions >= 1
+ * Time complexity: O(numRepetitions * listPtr->numNodes / numThreads)
+ * Space complexity: O(numThreads)
+ */
+double TimeParallelScan (LinkedList *listPtr, Length numThreads, ParallelScan scan, Length numRepetitions) {
+	ListWorkerPool pool;
+	ListSegments segments;
+	struct timespec startTime, stopTime;
+	Index i;
+
+	if (numThreads == 0) {
+		clock_gettime (CLOCK_MONOTONIC, &startTime);
+		for (i = 0; i < numRepetitions; i++) {
+			ScanSequentially (listPtr, scan);
+		}
+		clock_gettime (CLOCK_MONOTONIC, &stopTime);
+		return (stopTime.tv_sec - startTime.tv_sec) + (stopTime.tv_nsec - startTime.tv_nsec) * 1e-9;
+	}
+
+	if (!InitialiseWorkerPool (&pool, numThreads)) {
+		return -1;
+	}
+	if (pool.numThreads < numThreads) {
+		DestroyWorkerPool (&pool);
+		return -1;
+	}
+	if (!AttachSegments (listPtr, &segments, numThreads * SEGMENTS_PER_THREAD)) {
+		DestroyWorkerPool (&pool);
+		return -1;
+	}
+
+	clock_gettime (CLOCK_MONOTONIC, &startTime);
+	for (i = 0; i < numRepetitions; i++) {
+		ScanInParallel (&pool, &segments, scan);
+	}
+	clock_gettime (CLOCK_MONOTONIC, &stopTime);
+
+	DetachSegments (&segments);
+	DestroyWorkerPool (&pool);
+	return (stopTime.tv_sec - startTime.tv_sec) + (stopTime.tv_nsec - startTime.tv_nsec) * 1e-9;
+}
@@ -0,0 +1,44 @@
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Header file containing type declarations and function declarations of the parallel traversal part of the benchmark
+ * (see "listbenchmark.cpp"). "listparallel.h" uses C11 atomics, which C++ cannot include, so the parallel operations
+ * are driven from a C file.
+ *
+ * The following types are declared in this file:
+ * a) ParallelScan: the parallel operation timed (one of the PARALLEL_SCAN_ constants)
+ *
+ * The following functions are declared in this file:
+ * a) TimeParallelScan: Function to time a parallel operation over a linked list, or the sequential loop doing the same
+ *
+ * All of the above functions are defined in "Linked List/benchmark/parallelbenchmark.c". For more details, see there.
+ */
+
+#ifndef PARALLELBENCHMARK_H
+#define PARALLELBENCHMARK_H
+
+	#include "../linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// For the parallel operation timed
+	typedef int ParallelScan;
+	#define PARALLEL_SCAN_COUNT 0		// ParallelCountData
+	#define PARALLEL_SCAN_SUM 1		// ParallelSum
+	#define PARALLEL_SCAN_MIN_MAX 2		// ParallelMinMax
+	#define PARALLEL_SCAN_FIND 3		// ParallelFindData, of data not in the list (so every node is visited)
+	#define PARALLEL_SCAN_MAP 4		// ParallelMap, adding 1 to every data value
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/benchmark/parallelbenchmark.c".
+	 * For more details, refer to this file.
+	 */
+
+	double TimeParallelScan (LinkedList *listPtr, Length numThreads, ParallelScan scan, Length numRepetitions);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
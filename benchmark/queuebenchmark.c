@@ -0,0 +1,109 @@
+#include <stdio.h>  			// For input/output
+#include <stdlib.h> 			// For dynamic memory allocation and de-allocation
+#include <time.h>   			// For the monotonic clock
+#include <sched.h>  			// For yielding while the queue is empty
+#include <pthread.h>			// For the producer threads
+#include "../concurrentqueue.h"		// For the concurrent queue being timed
+#include "queuebenchmark.h"		// For function declarations of this file
+
+// For the work of one producer thread
+struct producertask {
+	ConcurrentQueue *queuePtr;
+	Data firstData;
+	Length numData;
+};
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function run by each producer thread: enqueues its share of the data
+ * Input: argPtr (void *): pointer to the struct producertask of the thread
+ * Return value: NULL
+ * Time complexity: O(numData)
+ * Space complexity: O(numData) nodes, freed by the consumer
+ */
+static void *ProduceData (void *argPtr) {
+	struct producertask *taskPtr;
+	Index i;
+
+	taskPtr = (struct producertask *) argPtr;
+	for (i = 0; i < taskPtr->numData; i++) {
+		EnqueueData (taskPtr->queuePtr, taskPtr->firstData + i);
+	}
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to time several producer threads feeding one consumer through a concurrent queue
+ * The calling thread is the consumer: it dequeues (DequeueData) until all data has come through, yielding whenever
+ * the queue is empty. The producers split numData between them and enqueue (EnqueueData) as fast as they can.
+ * Inputs: numProducers (Length) (int): number of producer threads, numData (Length) (int): total number of data values
+ * Return value: seconds from starting the producers to dequeuing the last value, or -1 if a thread could not be started
+ * Assumptions: numProducers >= 1, numData >= 0
+ * Time complexity: O(numData)
+ * Space complexity: O(numProducers), plus the nodes in the queue at any one time
+ */
+double TimeConcurrentQueue (Length numProducers, Length numData) {
+	ConcurrentQueue queue;
+	struct producertask *tasks;
+	pthread_t *threads;
+	struct timespec startTime, stopTime;
+	Length numStarted, numReceived;
+	Data data;
+	Index i;
+
+	tasks = (struct producertask *) malloc (numProducers * sizeof (struct producertask));
+	threads = (pthread_t *) malloc (numProducers * sizeof (pthread_t));
+	if (tasks == NULL || threads == NULL) {
+		printf ("Error: could not allocate the producer threads of TimeConcurrentQueue\n");
+		free (tasks);
+		free (threads);
+		return -1;
+	}
+
+	InitialiseConcurrentQueue (&queue);
+	clock_gettime (CLOCK_MONOTONIC, &startTime);
+
+	// the last producer takes the remainder
+	numStarted = 0;
+	for (i = 0; i < numProducers; i++) {
+		tasks[i].queuePtr = &queue;
+		tasks[i].firstData = i * (numData / numProducers);
+		tasks[i].numData = (i == numProducers-1) ? numData - tasks[i].firstData : numData / numProducers;
+		if (pthread_create (&threads[i], NULL, ProduceData, &tasks[i]) != 0) {
+			break;
+		}
+		numStarted++;
+	}
+
+	// only the data of the producers that did start will come through
+	numData = 0;
+	for (i = 0; i < numStarted; i++) {
+		numData += tasks[i].numData;
+	}
+
+	numReceived = 0;
+	while (numReceived < numData) {
+		if (DequeueData (&queue, &data)) {
+			numReceived++;
+		}
+		else {
+			sched_yield ();
+		}
+	}
+
+	clock_gettime (CLOCK_MONOTONIC, &stopTime);
+	for (i = 0; i < numStarted; i++) {
+		pthread_join (threads[i], NULL);
+	}
+
+	RemoveAllConcurrentNodes (&queue);
+	free (tasks);
+	free (threads);
+
+	if (numStarted < numProducers) {
+		printf ("Error: could only start %d of %d producer threads in TimeConcurrentQueue\n", numStarted, numProducers);
+		return -1;
+	}
+	return (stopTime.tv_sec - startTime.tv_sec) + (stopTime.tv_nsec - startTime.tv_nsec) * 1e-9;
+}
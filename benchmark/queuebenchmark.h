@@ -0,0 +1,32 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing function declarations of the concurrent queue part of the benchmark (see "listbenchmark.cpp").
+ * "concurrentqueue.h" uses C11 atomics, which C++ cannot include, so the threads driving the queue live in a C file.
+ *
+ * The following functions are declared in this file:
+ * a) TimeConcurrentQueue: Function to time several producer threads feeding one consumer through a concurrent queue
+ *
+ * All of the above functions are defined in "Linked List/benchmark/queuebenchmark.c". For more details, see there.
+ */
+
+#ifndef QUEUEBENCHMARK_H
+#define QUEUEBENCHMARK_H
+
+	#include "../linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/benchmark/queuebenchmark.c".
+	 * For more details, refer to this file.
+	 */
+
+	double TimeConcurrentQueue (Length numProducers, Length numData);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
@@ -0,0 +1,545 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <sched.h>  		// For yielding before a retry
+#include <stddef.h> 		// For finding a node from its epoch entry
+#include "../concurrentlist.h"	// For type declarations and function declarations related to the concurrent linked list
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to read the pointer to the next node
+ * The load pairs with SetNextNode, so a node reached without locks (in a scan) is seen fully initialised.
+ * Input: nodePtr (ConcurrentListNode *)
+ * Return value: nodePtr->nextNodePtr
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static inline ConcurrentListNode *NextNode (ConcurrentListNode *nodePtr) {
+	return atomic_load_explicit (&(nodePtr->nextNodePtr), memory_order_acquire);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to set the pointer to the next node
+ * Input: nodePtr (ConcurrentListNode *), nextNodePtr (ConcurrentListNode *)
+ * Return value: none
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static inline void SetNextNode (ConcurrentListNode *nodePtr, ConcurrentListNode *nextNodePtr) {
+	atomic_store_explicit (&(nodePtr->nextNodePtr), nextNodePtr, memory_order_release);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to print the contents of a concurrent linked list
+ * The list is walked hand-over-hand, so the output is a consistent snapshot of every node at the moment it is passed.
+ * Input: listPtr (ConcurrentList *): pointer to concurrent linked list
+ * Return value: none
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+void PrintConcurrentList (ConcurrentList *listPtr) {
+	ConcurrentListNode *prevNodePtr, *currNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PrintConcurrentList (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	prevNodePtr = &(listPtr->sentinelNode);
+	pthread_mutex_lock (&(prevNodePtr->lock));
+	currNodePtr = NextNode (prevNodePtr);
+
+	while (currNodePtr != NULL) {
+		pthread_mutex_lock (&(currNodePtr->lock));
+		pthread_mutex_unlock (&(prevNodePtr->lock));
+		PrintData (currNodePtr->data);
+		printf (" -> ");
+		prevNodePtr = currNodePtr;
+		currNodePtr = NextNode (currNodePtr);
+	}
+
+	pthread_mutex_unlock (&(prevNodePtr->lock));
+	printf ("NULL\n");
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an empty concurrent linked list
+ * The list is initialised in place (not returned by value, like InitialiseList), because its tail points to
+ * its own sentinel node and its locks cannot be copied.
+ * Input: listPtr (ConcurrentList *): pointer to the list to initialise
+ * Return value: none
+ * Post-condition: list has no nodes, listPtr->tailPtr = &(listPtr->sentinelNode), listPtr->numNodes = 0
+ * Assumptions: no other thread uses the list until this function returns
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void InitialiseConcurrentList (ConcurrentList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of InitialiseConcurrentList (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	listPtr->sentinelNode.data = 0;
+	atomic_init (&(listPtr->sentinelNode.nextNodePtr), NULL);
+	pthread_mutex_init (&(listPtr->sentinelNode.lock), NULL);
+	listPtr->tailPtr = &(listPtr->sentinelNode);
+	pthread_mutex_init (&(listPtr->tailLock), NULL);
+	atomic_init (&(listPtr->numNodes), 0);
+	listPtr->domainPtr = NULL;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to make a concurrent linked list retire removed nodes to an epoch domain, instead of freeing them at once
+ * With a domain attached, ConcurrentScanContainsData and ConcurrentScanToArray can walk the list without locks,
+ * alongside inserts and removals.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, domainPtr (EpochDomain *): pointer to epoch domain
+ * (NULL => nodes are freed at once again)
+ * Return value: none
+ * Assumptions: no other thread uses the list while the domain is changed
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void ConcurrentAttachEpochDomain (ConcurrentList *listPtr, EpochDomain *domainPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentAttachEpochDomain (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	listPtr->domainPtr = domainPtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to allocate a concurrent linked list node with given data
+ * Input: data (Data) (int)
+ * Return value: pointer to a node with an initialised lock, or NULL if it could not be allocated
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static ConcurrentListNode *NewConcurrentListNode (Data data) {
+	ConcurrentListNode *newNodePtr;
+
+	newNodePtr = (ConcurrentListNode *) malloc (sizeof (ConcurrentListNode));
+	if (newNodePtr == NULL) {
+		printf ("Error: could not allocate a new node\n");
+		return NULL;
+	}
+
+	newNodePtr->data = data;
+	atomic_init (&(newNodePtr->nextNodePtr), NULL);
+	pthread_mutex_init (&(newNodePtr->lock), NULL);
+	return newNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to free a concurrent linked list node once its epoch domain finds no reader can see it
+ * Input: entryPtr (EpochEntry *): entry embedded in the node
+ * Return value: none
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void FreeRetiredNode (EpochEntry *entryPtr) {
+	ConcurrentListNode *nodePtr;
+
+	nodePtr = (ConcurrentListNode *) ((char *) entryPtr - offsetof (ConcurrentListNode, retireEntry));
+	pthread_mutex_destroy (&(nodePtr->lock));
+	free (nodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to free a concurrent linked list node that is no longer in the list
+ * With an epoch domain attached, the node is retired instead, since a scan may still be on it.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, nodePtr (ConcurrentListNode *): unlinked, unlocked node
+ * Return value: none
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void DeleteConcurrentListNode (ConcurrentList *listPtr, ConcurrentListNode *nodePtr) {
+	if (listPtr->domainPtr != NULL) {
+		EpochRetire (listPtr->domainPtr, &(nodePtr->retireEntry), FreeRetiredNode);
+		return;
+	}
+
+	pthread_mutex_destroy (&(nodePtr->lock));
+	free (nodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to link a new node after a locked node
+ * If the locked node is the tail, the tail lock is needed as well. It is only tried (the caller already holds a node lock),
+ * and on failure nothing is changed.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, prevNodePtr (ConcurrentListNode *): locked node,
+ * newNodePtr (ConcurrentListNode *): node to link after it
+ * Return value: TRUE if the node was linked, FALSE if the tail lock was busy (the caller must let go and retry)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static bool LinkAfter (ConcurrentList *listPtr, ConcurrentListNode *prevNodePtr, ConcurrentListNode *newNodePtr) {
+	if (NextNode (prevNodePtr) == NULL) {
+		if (pthread_mutex_trylock (&(listPtr->tailLock)) != 0) {
+			return FALSE;
+		}
+		SetNextNode (newNodePtr, NULL);
+		SetNextNode (prevNodePtr, newNodePtr);
+		listPtr->tailPtr = newNodePtr;
+		pthread_mutex_unlock (&(listPtr->tailLock));
+	}
+	else {
+		SetNextNode (newNodePtr, NextNode (prevNodePtr));
+		SetNextNode (prevNodePtr, newNodePtr);
+	}
+
+	atomic_fetch_add_explicit (&(listPtr->numNodes), 1, memory_order_relaxed);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to unlink a locked node from after its locked predecessor
+ * If the node is the tail, the tail lock is needed as well. It is only tried, and on failure nothing is changed.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, prevNodePtr (ConcurrentListNode *): locked node,
+ * currNodePtr (ConcurrentListNode *): locked node after it
+ * Return value: TRUE if the node was unlinked, FALSE if the tail lock was busy (the caller must let go and retry)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static bool UnlinkAfter (ConcurrentList *listPtr, ConcurrentListNode *prevNodePtr, ConcurrentListNode *currNodePtr) {
+	if (NextNode (currNodePtr) == NULL) {
+		if (pthread_mutex_trylock (&(listPtr->tailLock)) != 0) {
+			return FALSE;
+		}
+		SetNextNode (prevNodePtr, NULL);
+		listPtr->tailPtr = prevNodePtr;
+		pthread_mutex_unlock (&(listPtr->tailLock));
+	}
+	else {
+		SetNextNode (prevNodePtr, NextNode (currNodePtr));
+	}
+
+	atomic_fetch_sub_explicit (&(listPtr->numNodes), 1, memory_order_relaxed);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data at the end of a concurrent linked list
+ * Appends take the tail lock and then the lock of the tail node only, so they never walk the list.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, data (Data) (int)
+ * Return value: none
+ * Post-condition: node containing data is the tail of the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void ConcurrentAddDataAtEnd (ConcurrentList *listPtr, Data data) {
+	ConcurrentListNode *tailNodePtr, *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentAddDataAtEnd (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	newNodePtr = NewConcurrentListNode (data);
+	if (newNodePtr == NULL) {
+		return;
+	}
+
+	// the tail node cannot be removed (or followed by a new node) while the tail lock is held
+	pthread_mutex_lock (&(listPtr->tailLock));
+	tailNodePtr = listPtr->tailPtr;
+	pthread_mutex_lock (&(tailNodePtr->lock));
+
+	SetNextNode (tailNodePtr, newNodePtr);
+	listPtr->tailPtr = newNodePtr;
+	atomic_fetch_add_explicit (&(listPtr->numNodes), 1, memory_order_relaxed);
+
+	pthread_mutex_unlock (&(tailNodePtr->lock));
+	pthread_mutex_unlock (&(listPtr->tailLock));
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data at the beginning of a concurrent linked list
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, data (Data) (int)
+ * Return value: none
+ * Post-condition: node containing data is the head of the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void ConcurrentAddDataAtBeginning (ConcurrentList *listPtr, Data data) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentAddDataAtBeginning (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	ConcurrentAddDataFromBeginning (listPtr, data, 0);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to a concurrent linked list at a certain position w.r.t. the head of the list
+ * The list is walked hand-over-hand up to the node before the position, which stays locked while the new node is linked.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, data (Data) (int), position (Index) (int)
+ * position is like an array index: 0 (head) to number of nodes (after tail)
+ * Return value: none
+ * Post-condition: node containing data is inserted at offset 'position' from the beginning. Since other threads may
+ * shorten the list meanwhile, data is added at the end if the list has fewer than 'position' nodes when it is walked.
+ * Assumptions: listPtr != NULL, position >= 0
+ * Time complexity: O(position)
+ * Space complexity: O(1)
+ */
+void ConcurrentAddDataFromBeginning (ConcurrentList *listPtr, Data data, Index position) {
+	ConcurrentListNode *prevNodePtr, *nextNodePtr, *newNodePtr;
+	bool isLinked;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentAddDataFromBeginning (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0) {
+		printf ("Error:	Argument 3 of ConcurrentAddDataFromBeginning (Index position) is out of bounds\n");
+		return;
+	}
+
+	newNodePtr = NewConcurrentListNode (data);
+	if (newNodePtr == NULL) {
+		return;
+	}
+
+	isLinked = FALSE;
+	while (!isLinked) {
+		prevNodePtr = &(listPtr->sentinelNode);
+		pthread_mutex_lock (&(prevNodePtr->lock));
+
+		for (i = 0; i < position && NextNode (prevNodePtr) != NULL; i++) {
+			nextNodePtr = NextNode (prevNodePtr);
+			pthread_mutex_lock (&(nextNodePtr->lock));
+			pthread_mutex_unlock (&(prevNodePtr->lock));
+			prevNodePtr = nextNodePtr;
+		}
+
+		isLinked = LinkAfter (listPtr, prevNodePtr, newNodePtr);
+		pthread_mutex_unlock (&(prevNodePtr->lock));
+
+		if (!isLinked) {
+			sched_yield ();
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove given data from a concurrent linked list
+ * The list is walked hand-over-hand; each matching node is unlinked while it and its predecessor are locked.
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, data (Data) (int)
+ * Return value: number of nodes removed
+ * Post-condition: all occurrences of data that were in the list when the walk passed them are removed (and freed)
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+Length ConcurrentRemoveData (ConcurrentList *listPtr, Data data) {
+	ConcurrentListNode *prevNodePtr, *currNodePtr;
+	Length numRemoved;
+	bool isDone;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentRemoveData (ConcurrentList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	numRemoved = 0;
+	isDone = FALSE;
+
+	// a walk is started again from the head only if the tail lock was busy when removing the tail
+	while (!isDone) {
+		prevNodePtr = &(listPtr->sentinelNode);
+		pthread_mutex_lock (&(prevNodePtr->lock));
+		currNodePtr = NextNode (prevNodePtr);
+		isDone = TRUE;
+
+		while (currNodePtr != NULL) {
+			pthread_mutex_lock (&(currNodePtr->lock));
+
+			if (currNodePtr->data != data) {
+				pthread_mutex_unlock (&(prevNodePtr->lock));
+				prevNodePtr = currNodePtr;
+				currNodePtr = NextNode (currNodePtr);
+			}
+			else if (UnlinkAfter (listPtr, prevNodePtr, currNodePtr)) {
+				pthread_mutex_unlock (&(currNodePtr->lock));
+				DeleteConcurrentListNode (listPtr, currNodePtr);
+				numRemoved++;
+				currNodePtr = NextNode (prevNodePtr);
+			}
+			else {
+				pthread_mutex_unlock (&(currNodePtr->lock));
+				isDone = FALSE;
+				break;
+			}
+		}
+
+		pthread_mutex_unlock (&(prevNodePtr->lock));
+
+		if (!isDone) {
+			sched_yield ();
+		}
+	}
+
+	return numRemoved;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove (and free, or retire to the epoch domain) all nodes in a concurrent linked list
+ * The tail lock and the sentinel stay locked while the first node is removed repeatedly, so other threads already
+ * further down the list finish before their nodes are reached, and no other thread can enter behind.
+ * Input: listPtr (ConcurrentList *): pointer to concurrent linked list
+ * Return value: none
+ * Post-condition: list has no nodes
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+void ConcurrentRemoveAllNodes (ConcurrentList *listPtr) {
+	ConcurrentListNode *sentinelNodePtr, *currNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentRemoveAllNodes (ConcurrentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	sentinelNodePtr = &(listPtr->sentinelNode);
+	pthread_mutex_lock (&(listPtr->tailLock));
+	pthread_mutex_lock (&(sentinelNodePtr->lock));
+
+	while (NextNode (sentinelNodePtr) != NULL) {
+		currNodePtr = NextNode (sentinelNodePtr);
+		pthread_mutex_lock (&(currNodePtr->lock));
+		SetNextNode (sentinelNodePtr, NextNode (currNodePtr));
+		pthread_mutex_unlock (&(currNodePtr->lock));
+		DeleteConcurrentListNode (listPtr, currNodePtr);
+		atomic_fetch_sub_explicit (&(listPtr->numNodes), 1, memory_order_relaxed);
+	}
+
+	listPtr->tailPtr = sentinelNodePtr;
+	pthread_mutex_unlock (&(sentinelNodePtr->lock));
+	pthread_mutex_unlock (&(listPtr->tailLock));
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to check whether a concurrent linked list contains given data
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, data (Data) (int)
+ * Return value: TRUE if a node containing data was passed during the walk, FALSE otherwise
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+bool ConcurrentContainsData (ConcurrentList *listPtr, Data data) {
+	ConcurrentListNode *prevNodePtr, *currNodePtr;
+	bool isFound;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentContainsData (ConcurrentList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	isFound = FALSE;
+	prevNodePtr = &(listPtr->sentinelNode);
+	pthread_mutex_lock (&(prevNodePtr->lock));
+	currNodePtr = NextNode (prevNodePtr);
+
+	while (currNodePtr != NULL && !isFound) {
+		pthread_mutex_lock (&(currNodePtr->lock));
+		pthread_mutex_unlock (&(prevNodePtr->lock));
+		isFound = (currNodePtr->data == data);
+		prevNodePtr = currNodePtr;
+		currNodePtr = NextNode (currNodePtr);
+	}
+
+	pthread_mutex_unlock (&(prevNodePtr->lock));
+	return isFound;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to check whether a concurrent linked list contains given data, without taking any lock
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, data (Data) (int)
+ * Return value: TRUE if a node containing data was passed during the walk, FALSE otherwise
+ * Pre-condition: an epoch domain is attached to the list, and the calling thread is inside a read section of it
+ * (between EpochEnter and EpochExit)
+ * Time complexity: O(listPtr->numNodes), never waits for other threads
+ * Space complexity: O(1)
+ */
+bool ConcurrentScanContainsData (ConcurrentList *listPtr, Data data) {
+	ConcurrentListNode *currNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentScanContainsData (ConcurrentList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	for (currNodePtr = NextNode (&(listPtr->sentinelNode)); currNodePtr != NULL; currNodePtr = NextNode (currNodePtr)) {
+		if (currNodePtr->data == data) {
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to copy the data of a concurrent linked list into an array, without taking any lock
+ * Inputs: listPtr (ConcurrentList *): pointer to concurrent linked list, dataArray (Data *): array to fill,
+ * maxData (Length) (int): capacity of dataArray
+ * Return value: number of data values copied (at most maxData)
+ * Pre-condition: as for ConcurrentScanContainsData
+ * Post-condition: dataArray holds the data of the nodes passed during the walk, in list order
+ * Time complexity: O(number of data values copied), never waits for other threads
+ * Space complexity: O(1)
+ */
+Length ConcurrentScanToArray (ConcurrentList *listPtr, Data *dataArray, Length maxData) {
+	ConcurrentListNode *currNodePtr;
+	Length numData;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentScanToArray (ConcurrentList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	if (dataArray == NULL && maxData > 0) {
+		printf ("Error: Argument 2 of ConcurrentScanToArray (Data *dataArray) cannot be NULL\n");
+		return 0;
+	}
+
+	numData = 0;
+	for (currNodePtr = NextNode (&(listPtr->sentinelNode)); currNodePtr != NULL && numData < maxData;
+		currNodePtr = NextNode (currNodePtr)) {
+		dataArray[numData++] = currNodePtr->data;
+	}
+
+	return numData;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find the number of nodes in a concurrent linked list
+ * Input: listPtr (ConcurrentList *): pointer to concurrent linked list
+ * Return value: number of nodes at the moment of the call
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+Length ConcurrentListLength (ConcurrentList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ConcurrentListLength (ConcurrentList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	return atomic_load_explicit (&(listPtr->numNodes), memory_order_relaxed);
+}
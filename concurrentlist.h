@@ -0,0 +1,103 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the concurrent linked list.
+ * The concurrent linked list can be used by many threads at once. Every node has its own lock, and a thread walking the
+ * list holds at most two of them: it locks the next node before unlocking the current one (hand-over-hand locking).
+ * So threads working on disjoint parts of the list proceed in parallel, and a thread can never overtake another.
+ * A sentinel node before the first node gives inserts and removals at the head a node to lock, like any other.
+ *
+ * Readers that only look can skip the locks altogether: with an epoch domain attached (see "epoch.h"), removed nodes are
+ * retired rather than freed, and the Scan functions walk the list inside a read section while writers carry on.
+ *
+ * Locking order: the tail lock is taken before any node lock. A thread that reaches the tail while holding node locks
+ * (to insert after it or remove it) only tries the tail lock; if it is held, the thread lets go of everything and retries.
+ *
+ * The following types are declared in this file:
+ * a) struct concurrentlistnode (ConcurrentListNode): a structure representing one list node. Contains data,
+ *    a pointer to the next node, the lock of the node and the entry used to retire it
+ * b) struct concurrentlist (ConcurrentList): a structure representing a concurrent linked list. Contains the sentinel node,
+ *    a tail pointer with its lock, the number of nodes (kept atomically) and the epoch domain removed nodes are
+ *    retired to (NULL => they are freed at once)
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to printing contents of a concurrent linked list
+ * a) PrintConcurrentList: Function to print the contents of a concurrent linked list
+ *
+ * Related to initialising a concurrent linked list
+ * b) InitialiseConcurrentList: Function to create an empty concurrent linked list
+ * c) ConcurrentAttachEpochDomain: Function to make a concurrent linked list retire removed nodes to an epoch domain
+ *
+ * Related to adding data to a concurrent linked list
+ * d) ConcurrentAddDataAtEnd: Function to add data at the end of a concurrent linked list
+ * e) ConcurrentAddDataAtBeginning: Function to add data at the beginning of a concurrent linked list
+ * f) ConcurrentAddDataFromBeginning: Function to add data at a certain position w.r.t. the head of a concurrent linked list
+ *
+ * Related to removing data from a concurrent linked list
+ * g) ConcurrentRemoveData: Function to remove all occurrences of given data from a concurrent linked list
+ * h) ConcurrentRemoveAllNodes: Function to remove (and free, or retire) all nodes in a concurrent linked list
+ *
+ * Related to looking up data in a concurrent linked list
+ * i) ConcurrentContainsData: Function to check whether a concurrent linked list contains given data
+ * j) ConcurrentScanContainsData: Function to check whether a concurrent linked list contains given data, without locks
+ * k) ConcurrentScanToArray: Function to copy the data of a concurrent linked list into an array, without locks
+ * l) ConcurrentListLength: Function to find the number of nodes in a concurrent linked list
+ *
+ * All of the above functions are defined in "Linked List/concurrentlist.c". For more details, see there.
+ */
+
+#ifndef CONCURRENTLIST_H
+#define CONCURRENTLIST_H
+
+	#include <pthread.h>
+	#include <stdatomic.h>
+	#include "linkedlist.h"
+	#include "epoch.h"
+
+	// For one node in concurrent linked list
+	struct concurrentlistnode {
+		Data data;
+		_Atomic (struct concurrentlistnode *) nextNodePtr;
+		pthread_mutex_t lock;
+		EpochEntry retireEntry;
+	};
+	typedef struct concurrentlistnode ConcurrentListNode;
+
+	// For a concurrent linked list. tailPtr is the sentinel node when the list is empty.
+	struct concurrentlist {
+		ConcurrentListNode sentinelNode;
+		ConcurrentListNode *tailPtr;
+		pthread_mutex_t tailLock;
+		_Atomic Length numNodes;
+		EpochDomain *domainPtr;
+	};
+	typedef struct concurrentlist ConcurrentList;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/concurrentlist.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to printing the contents of the concurrent linked list
+	void PrintConcurrentList (ConcurrentList *listPtr);
+
+	// Related to initialising concurrent linked lists
+	void InitialiseConcurrentList (ConcurrentList *listPtr);
+	void ConcurrentAttachEpochDomain (ConcurrentList *listPtr, EpochDomain *domainPtr);
+
+	// Related to adding data to a concurrent linked list
+	void ConcurrentAddDataAtEnd (ConcurrentList *listPtr, Data data);
+	void ConcurrentAddDataAtBeginning (ConcurrentList *listPtr, Data data);
+	void ConcurrentAddDataFromBeginning (ConcurrentList *listPtr, Data data, Index position);
+
+	// Related to removing data from a concurrent linked list
+	Length ConcurrentRemoveData (ConcurrentList *listPtr, Data data);
+	void ConcurrentRemoveAllNodes (ConcurrentList *listPtr);
+
+	// Related to looking up data in a concurrent linked list
+	bool ConcurrentContainsData (ConcurrentList *listPtr, Data data);
+	bool ConcurrentScanContainsData (ConcurrentList *listPtr, Data data);
+	Length ConcurrentScanToArray (ConcurrentList *listPtr, Data *dataArray, Length maxData);
+	Length ConcurrentListLength (ConcurrentList *listPtr);
+
+#endif
@@ -0,0 +1,284 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <sched.h>  		// For yielding while another consumer holds the queue
+#include "../concurrentqueue.h"	// For type declarations and function declarations related to the concurrent queue
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an empty concurrent queue
+ * The queue is initialised in place (not returned by value, like InitialiseList), because its head and tail point to
+ * its own stub node.
+ * Input: queuePtr (ConcurrentQueue *): pointer to the queue to initialise
+ * Return value: none
+ * Post-condition: queue holds only its stub node, queuePtr->headPtr = queuePtr->tailPtr = &(queuePtr->stubNode)
+ * Assumptions: no other thread uses the queue until this function returns
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void InitialiseConcurrentQueue (ConcurrentQueue *queuePtr) {
+	if (queuePtr == NULL) {
+		printf ("Error: Argument 1 of InitialiseConcurrentQueue (ConcurrentQueue *queuePtr) cannot be NULL\n");
+		return;
+	}
+
+	queuePtr->stubNode.data = 0;
+	atomic_init (&(queuePtr->stubNode.nextNodePtr), NULL);
+	atomic_init (&(queuePtr->tailPtr), &(queuePtr->stubNode));
+	queuePtr->headPtr = &(queuePtr->stubNode);
+	atomic_flag_clear (&(queuePtr->consumerLock));
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to allocate a concurrent queue node with given data
+ * Input: data (Data) (int)
+ * Return value: pointer to a node with node->data = data, node->nextNodePtr = NULL, or NULL if it could not be allocated
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+ConcurrentNode *MakeConcurrentNode (Data data) {
+	ConcurrentNode *nodePtr;
+
+	nodePtr = (ConcurrentNode *) malloc (sizeof (ConcurrentNode));
+	if (nodePtr == NULL) {
+		printf ("Error: could not allocate a new node\n");
+		return NULL;
+	}
+
+	nodePtr->data = data;
+	atomic_init (&(nodePtr->nextNodePtr), NULL);
+	return nodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add a node at the tail of a concurrent queue
+ * Safe to call from any number of threads at once. The node becomes the tail with one atomic exchange; the old tail
+ * is then linked to it. Between these two steps the node is not yet visible to the consumer.
+ * Inputs: queuePtr (ConcurrentQueue *): pointer to queue, nodePtr (ConcurrentNode *): node to add
+ * Return value: none
+ * Post-condition: node is the last node of the queue, and belongs to the queue until it is dequeued
+ * Assumptions: queuePtr != NULL, nodePtr != NULL, and nodePtr is not in any queue
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void EnqueueNode (ConcurrentQueue *queuePtr, ConcurrentNode *nodePtr) {
+	ConcurrentNode *prevNodePtr;
+
+	atomic_store_explicit (&(nodePtr->nextNodePtr), NULL, memory_order_relaxed);
+	prevNodePtr = atomic_exchange_explicit (&(queuePtr->tailPtr), nodePtr, memory_order_acq_rel);
+	atomic_store_explicit (&(prevNodePtr->nextNodePtr), nodePtr, memory_order_release);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove the node at the head of a concurrent queue
+ * The stub node is skipped over, and put back at the tail when the last node is removed, so that the queue
+ * never becomes empty of nodes. A node is only returned once its successor is linked in.
+ * Input: queuePtr (ConcurrentQueue *): pointer to queue
+ * Return value: pointer to the removed node (now owned by the caller), or NULL if the queue is empty
+ * or the only node is still being added by a producer
+ * Assumptions: queuePtr != NULL, and only one thread at a time removes nodes (use DequeueNodeShared otherwise)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+ConcurrentNode *DequeueNode (ConcurrentQueue *queuePtr) {
+	ConcurrentNode *headNodePtr, *nextNodePtr, *stubNodePtr;
+
+	stubNodePtr = &(queuePtr->stubNode);
+	headNodePtr = queuePtr->headPtr;
+	nextNodePtr = atomic_load_explicit (&(headNodePtr->nextNodePtr), memory_order_acquire);
+
+	// skip over the stub node
+	if (headNodePtr == stubNodePtr) {
+		if (nextNodePtr == NULL) {
+			return NULL;
+		}
+		queuePtr->headPtr = nextNodePtr;
+		headNodePtr = nextNodePtr;
+		nextNodePtr = atomic_load_explicit (&(headNodePtr->nextNodePtr), memory_order_acquire);
+	}
+
+	if (nextNodePtr != NULL) {
+		queuePtr->headPtr = nextNodePtr;
+		return headNodePtr;
+	}
+
+	// head is the last node linked in. If it is not the tail, a producer has swapped in a new tail
+	// but not yet linked it, so the queue is momentarily blocked.
+	if (headNodePtr != atomic_load_explicit (&(queuePtr->tailPtr), memory_order_acquire)) {
+		return NULL;
+	}
+
+	// put the stub node back behind the last node, so that the last node can be removed
+	EnqueueNode (queuePtr, stubNodePtr);
+	nextNodePtr = atomic_load_explicit (&(headNodePtr->nextNodePtr), memory_order_acquire);
+	if (nextNodePtr != NULL) {
+		queuePtr->headPtr = nextNodePtr;
+		return headNodePtr;
+	}
+
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove the node at the head of a concurrent queue, when several threads remove nodes
+ * Consumers take turns through a spin lock; producers never take it, so adding stays lock-free.
+ * Input: queuePtr (ConcurrentQueue *): pointer to queue
+ * Return value: as for DequeueNode
+ * Assumptions: queuePtr != NULL. Every consumer of the queue uses this function (not DequeueNode).
+ * Time complexity: O(1), apart from waiting for other consumers
+ * Space complexity: O(1)
+ */
+ConcurrentNode *DequeueNodeShared (ConcurrentQueue *queuePtr) {
+	ConcurrentNode *nodePtr;
+
+	while (atomic_flag_test_and_set_explicit (&(queuePtr->consumerLock), memory_order_acquire)) {
+		sched_yield ();
+	}
+
+	nodePtr = DequeueNode (queuePtr);
+
+	atomic_flag_clear_explicit (&(queuePtr->consumerLock), memory_order_release);
+	return nodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the tail of a concurrent queue
+ * Inputs: queuePtr (ConcurrentQueue *): pointer to queue, data (Data) (int)
+ * Return value: TRUE if data was added, FALSE if a node could not be allocated
+ * Assumptions: queuePtr != NULL. Safe to call from any number of threads at once.
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool EnqueueData (ConcurrentQueue *queuePtr, Data data) {
+	ConcurrentNode *nodePtr;
+
+	if (queuePtr == NULL) {
+		printf ("Error: Argument 1 of EnqueueData (ConcurrentQueue *queuePtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	nodePtr = MakeConcurrentNode (data);
+	if (nodePtr == NULL) {
+		return FALSE;
+	}
+
+	EnqueueNode (queuePtr, nodePtr);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove the data at the head of a concurrent queue
+ * Inputs: queuePtr (ConcurrentQueue *): pointer to queue, dataPtr (Data *): receives the data
+ * Return value: TRUE if data was removed, FALSE if the queue is (momentarily) empty
+ * Post-condition: the node that held the data is freed
+ * Assumptions: queuePtr != NULL, dataPtr != NULL, nodes were added with EnqueueData (or MakeConcurrentNode),
+ * and only one thread at a time removes data
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool DequeueData (ConcurrentQueue *queuePtr, Data *dataPtr) {
+	ConcurrentNode *nodePtr;
+
+	if (queuePtr == NULL) {
+		printf ("Error: Argument 1 of DequeueData (ConcurrentQueue *queuePtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	nodePtr = DequeueNode (queuePtr);
+	if (nodePtr == NULL) {
+		return FALSE;
+	}
+
+	*dataPtr = nodePtr->data;
+	free (nodePtr);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove the data at the head of a concurrent queue, when several threads remove data
+ * Inputs: queuePtr (ConcurrentQueue *): pointer to queue, dataPtr (Data *): receives the data
+ * Return value: as for DequeueData
+ * Assumptions: as for DequeueData, except that any number of threads may remove data through this function
+ * Time complexity: O(1), apart from waiting for other consumers
+ * Space complexity: O(1)
+ */
+bool DequeueDataShared (ConcurrentQueue *queuePtr, Data *dataPtr) {
+	ConcurrentNode *nodePtr;
+
+	if (queuePtr == NULL) {
+		printf ("Error: Argument 1 of DequeueDataShared (ConcurrentQueue *queuePtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	nodePtr = DequeueNodeShared (queuePtr);
+	if (nodePtr == NULL) {
+		return FALSE;
+	}
+
+	*dataPtr = nodePtr->data;
+	free (nodePtr);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.1
+ * Function to check whether a concurrent queue has no nodes
+ * The head pointer it reads belongs to the consumer, so only the consumer may ask (or, with several consumers, a
+ * thread holding their lock): from any other thread the read would race with DequeueNode moving the head on.
+ * Input: queuePtr (ConcurrentQueue *): pointer to queue
+ * Return value: TRUE if the queue holds no nodes other than its stub node, FALSE otherwise.
+ * With producers running, the answer may be out of date as soon as it is returned.
+ * Assumptions: queuePtr != NULL, called by the single consumer of the queue (as for DequeueNode), or while no consumer
+ * is removing nodes
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool IsConcurrentQueueEmpty (ConcurrentQueue *queuePtr) {
+	ConcurrentNode *headNodePtr;
+
+	if (queuePtr == NULL) {
+		printf ("Error: Argument 1 of IsConcurrentQueueEmpty (ConcurrentQueue *queuePtr) cannot be NULL\n");
+		return TRUE;
+	}
+
+	headNodePtr = queuePtr->headPtr;
+	return headNodePtr == &(queuePtr->stubNode)
+		&& atomic_load_explicit (&(headNodePtr->nextNodePtr), memory_order_acquire) == NULL;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove (and free) all nodes in a concurrent queue
+ * Input: queuePtr (ConcurrentQueue *): pointer to queue
+ * Return value: none
+ * Post-condition: queue is empty, as after InitialiseConcurrentQueue
+ * Assumptions: queuePtr != NULL, no other thread uses the queue, and all nodes were allocated with malloc
+ * (EnqueueData or MakeConcurrentNode)
+ * Time complexity: O(number of nodes)
+ * Space complexity: O(1)
+ */
+void RemoveAllConcurrentNodes (ConcurrentQueue *queuePtr) {
+	ConcurrentNode *currNodePtr, *nextNodePtr;
+
+	if (queuePtr == NULL) {
+		printf ("Error: Argument 1 of RemoveAllConcurrentNodes (ConcurrentQueue *queuePtr) cannot be NULL\n");
+		return;
+	}
+
+	currNodePtr = queuePtr->headPtr;
+	while (currNodePtr != NULL) {
+		nextNodePtr = atomic_load_explicit (&(currNodePtr->nextNodePtr), memory_order_relaxed);
+		if (currNodePtr != &(queuePtr->stubNode)) {
+			free (currNodePtr);
+		}
+		currNodePtr = nextNodePtr;
+	}
+
+	InitialiseConcurrentQueue (queuePtr);
+}
@@ -0,0 +1,92 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the concurrent queue.
+ * The concurrent queue is a linked list of nodes shaped like ListNode (data followed by a next pointer, here atomic),
+ * which any number of threads may add to at the tail while other threads remove from the head, without a global lock.
+ * Adding is lock-free (wait-free apart from the allocation of the node): a producer swaps itself in as the tail with a
+ * single atomic exchange, then links the old tail to the new node (intrusive MPSC queue of D. Vyukov).
+ * A permanent stub node keeps the queue non-empty, so producers and the consumer never touch the same pointer.
+ *
+ * The following types are declared in this file:
+ * a) struct concurrentnode (ConcurrentNode): a structure representing one queue node. Same shape as ListNode,
+ *    with an atomic next pointer
+ * b) struct concurrentqueue (ConcurrentQueue): a structure representing a concurrent queue. Contains the tail pointer
+ *    (shared by producers) and the head pointer (owned by the consumer) on separate cache lines, the stub node,
+ *    and a lock taken only by consumers that share the queue
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to initialising a concurrent queue
+ * a) InitialiseConcurrentQueue: Function to create an empty concurrent queue
+ * b) MakeConcurrentNode: Function to allocate a concurrent queue node with given data
+ *
+ * Related to adding to and removing from a concurrent queue (intrusive, the caller owns the nodes)
+ * c) EnqueueNode: Function to add a node at the tail of a concurrent queue
+ * d) DequeueNode: Function to remove the node at the head of a concurrent queue (single consumer)
+ * e) DequeueNodeShared: Function to remove the node at the head of a concurrent queue (several consumers)
+ *
+ * Related to adding data to and removing data from a concurrent queue (the queue allocates and frees the nodes)
+ * f) EnqueueData: Function to add data at the tail of a concurrent queue
+ * g) DequeueData: Function to remove the data at the head of a concurrent queue (single consumer)
+ * h) DequeueDataShared: Function to remove the data at the head of a concurrent queue (several consumers)
+ *
+ * Related to the state of a concurrent queue
+ * i) IsConcurrentQueueEmpty: Function to check whether a concurrent queue has no nodes (single consumer)
+ * j) RemoveAllConcurrentNodes: Function to remove (and free) all nodes in a concurrent queue
+ *
+ * Memory reclamation: a node is only ever read by the producer that linked it in and by the consumer that removes it,
+ * and the consumer returns a node only once its successor is linked. So a removed node belongs to the consumer alone and
+ * can be freed (or reused) at once; no hazard pointers or epochs are needed.
+ *
+ * All of the above functions are defined in "Linked List/concurrentqueue.c". For more details, see there.
+ */
+
+#ifndef CONCURRENTQUEUE_H
+#define CONCURRENTQUEUE_H
+
+	#include <stdatomic.h>
+	#include "linkedlist.h"
+
+	// Size of a cache line in bytes, to keep the producers' and the consumer's pointers apart
+	#define CONCURRENT_QUEUE_CACHE_LINE_SIZE 64
+
+	// For one node in concurrent queue
+	struct concurrentnode {
+		Data data;
+		_Atomic (struct concurrentnode *) nextNodePtr;
+	};
+	typedef struct concurrentnode ConcurrentNode;
+
+	// For a concurrent queue
+	struct concurrentqueue {
+		_Alignas (CONCURRENT_QUEUE_CACHE_LINE_SIZE) _Atomic (ConcurrentNode *) tailPtr;
+		_Alignas (CONCURRENT_QUEUE_CACHE_LINE_SIZE) ConcurrentNode *headPtr;
+		ConcurrentNode stubNode;
+		atomic_flag consumerLock;
+	};
+	typedef struct concurrentqueue ConcurrentQueue;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/concurrentqueue.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to initialising concurrent queues
+	void InitialiseConcurrentQueue (ConcurrentQueue *queuePtr);
+	ConcurrentNode *MakeConcurrentNode (Data data);
+
+	// Related to adding to and removing from a concurrent queue
+	void EnqueueNode (ConcurrentQueue *queuePtr, ConcurrentNode *nodePtr);
+	ConcurrentNode *DequeueNode (ConcurrentQueue *queuePtr);
+	ConcurrentNode *DequeueNodeShared (ConcurrentQueue *queuePtr);
+
+	// Related to adding data to and removing data from a concurrent queue
+	bool EnqueueData (ConcurrentQueue *queuePtr, Data data);
+	bool DequeueData (ConcurrentQueue *queuePtr, Data *dataPtr);
+	bool DequeueDataShared (ConcurrentQueue *queuePtr, Data *dataPtr);
+
+	// Related to the state of a concurrent queue
+	bool IsConcurrentQueueEmpty (ConcurrentQueue *queuePtr);
+	void RemoveAllConcurrentNodes (ConcurrentQueue *queuePtr);
+
+#endif
@@ -0,0 +1,721 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <stddef.h> 		// For the size of XOR linked nodes
+#include "../doublylist.h"	// For type declarations and function declarations related to the doubly linked list data structure
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to step forward in a doubly linked list
+ * Inputs: kind (DoublyListKind) (int): kind of the list, prevNodePtr (DoublyListNode *): the node before currNodePtr
+ * (NULL => currNodePtr is the head), currNodePtr (DoublyListNode *)
+ * Return value: pointer to the node after currNodePtr (NULL if currNodePtr is the tail)
+ * Assumptions: currNodePtr != NULL. prevNodePtr is only read for XOR_LINKED lists.
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static DoublyListNode *StepForward (DoublyListKind kind, DoublyListNode *prevNodePtr, DoublyListNode *currNodePtr) {
+	if (kind == XOR_LINKED) {
+		return (DoublyListNode *) (currNodePtr->link ^ (uintptr_t) prevNodePtr);
+	}
+	return currNodePtr->nextNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to step backward in a doubly linked list
+ * Inputs: kind (DoublyListKind) (int): kind of the list, currNodePtr (DoublyListNode *), nextNodePtr (DoublyListNode *):
+ * the node after currNodePtr (NULL => currNodePtr is the tail)
+ * Return value: pointer to the node before currNodePtr (NULL if currNodePtr is the head)
+ * Assumptions: currNodePtr != NULL. nextNodePtr is only read for XOR_LINKED lists.
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static DoublyListNode *StepBackward (DoublyListKind kind, DoublyListNode *currNodePtr, DoublyListNode *nextNodePtr) {
+	if (kind == XOR_LINKED) {
+		return (DoublyListNode *) (currNodePtr->link ^ (uintptr_t) nextNodePtr);
+	}
+	return (DoublyListNode *) currNodePtr->link;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to print the contents of a doubly linked list, in the same format as PrintList
+ * Input: list (DoublyList)
+ * Return value: none
+ * Assumptions: empty list has headPtr == NULL
+ * Time complexity: O(list.numNodes)
+ * Space complexity: O(1)
+ */
+void PrintDoublyList (DoublyList list) {
+	DoublyListNode *prevNodePtr, *currNodePtr, *nextNodePtr;
+
+	prevNodePtr = NULL;
+	currNodePtr = list.headPtr;
+
+	while (currNodePtr != NULL) {
+		PrintData (currNodePtr->data);
+		printf (" -> ");
+
+		nextNodePtr = StepForward (list.kind, prevNodePtr, currNodePtr);
+		prevNodePtr = currNodePtr;
+		currNodePtr = nextNodePtr;
+	}
+	printf ("NULL\n");
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an empty doubly linked list of a given kind
+ * Input: kind (DoublyListKind) (int): DOUBLY_LINKED or XOR_LINKED
+ * Return value: list (DoublyList) : doubly linked list with list.numNodes = 0, list.headPtr = list.tailPtr = NULL,
+ * list.kind = kind (DOUBLY_LINKED if kind is not a kind of doubly linked list)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+DoublyList InitialiseDoublyList (DoublyListKind kind) {
+	DoublyList list;
+
+	if (kind != DOUBLY_LINKED && kind != XOR_LINKED) {
+		printf ("Error: Argument 1 of InitialiseDoublyList (DoublyListKind kind) is not a kind of doubly linked list\n");
+		kind = DOUBLY_LINKED;
+	}
+
+	list.headPtr = NULL;
+	list.tailPtr = NULL;
+	list.numNodes = 0;
+	list.kind = kind;
+	return list;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to allocate a new node for a doubly linked list, with given data
+ * XOR_LINKED nodes are allocated without their nextNodePtr, which they never use.
+ * Inputs: kind (DoublyListKind) (int): kind of the list, data (Data) (int)
+ * Return value: pointer to node with node->data = data (links not set), or NULL if allocation failed
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static DoublyListNode *NewDoublyNode (DoublyListKind kind, Data data) {
+	DoublyListNode *newNodePtr;
+
+	newNodePtr = (DoublyListNode *) malloc ((kind == XOR_LINKED) ? offsetof (DoublyListNode, nextNodePtr) : sizeof (DoublyListNode));
+	if (newNodePtr == NULL) {
+		printf ("Error: could not allocate a new doubly linked list node\n");
+		return NULL;
+	}
+
+	newNodePtr->data = data;
+	return newNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to link a new node in between two adjacent nodes of a doubly linked list
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, prevNodePtr (DoublyListNode *),
+ * nextNodePtr (DoublyListNode *): adjacent nodes (NULL => the new node becomes the head or the tail),
+ * newNodePtr (DoublyListNode *): node to be inserted
+ * Return value: none
+ * Post-condition: newNodePtr is between prevNodePtr and nextNodePtr, listPtr->numNodes is incremented by 1
+ * Assumptions: listPtr != NULL, newNodePtr != NULL, nextNodePtr is the node after prevNodePtr
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void LinkBetween (DoublyList *listPtr, DoublyListNode *prevNodePtr, DoublyListNode *nextNodePtr, DoublyListNode *newNodePtr) {
+	if (listPtr->kind == XOR_LINKED) {
+		newNodePtr->link = (uintptr_t) prevNodePtr ^ (uintptr_t) nextNodePtr;
+		if (prevNodePtr != NULL) {
+			prevNodePtr->link ^= (uintptr_t) nextNodePtr ^ (uintptr_t) newNodePtr;
+		}
+		if (nextNodePtr != NULL) {
+			nextNodePtr->link ^= (uintptr_t) prevNodePtr ^ (uintptr_t) newNodePtr;
+		}
+	}
+	else {
+		newNodePtr->link = (uintptr_t) prevNodePtr;
+		newNodePtr->nextNodePtr = nextNodePtr;
+		if (prevNodePtr != NULL) {
+			prevNodePtr->nextNodePtr = newNodePtr;
+		}
+		if (nextNodePtr != NULL) {
+			nextNodePtr->link = (uintptr_t) newNodePtr;
+		}
+	}
+
+	if (prevNodePtr == NULL) {
+		listPtr->headPtr = newNodePtr;
+	}
+	if (nextNodePtr == NULL) {
+		listPtr->tailPtr = newNodePtr;
+	}
+	(listPtr->numNodes)++;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to unlink (and free) a node of a doubly linked list, given both of its neighbours
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, prevNodePtr (DoublyListNode *): the node before currNodePtr,
+ * currNodePtr (DoublyListNode *): node to be removed, nextNodePtr (DoublyListNode *): the node after currNodePtr
+ * Return value: none
+ * Post-condition: prevNodePtr and nextNodePtr are adjacent, currNodePtr is freed, listPtr->numNodes is decremented by 1
+ * Assumptions: listPtr != NULL, currNodePtr is in the list, prevNodePtr and nextNodePtr are its neighbours
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void UnlinkBetween (DoublyList *listPtr, DoublyListNode *prevNodePtr, DoublyListNode *currNodePtr, DoublyListNode *nextNodePtr) {
+	if (listPtr->kind == XOR_LINKED) {
+		if (prevNodePtr != NULL) {
+			prevNodePtr->link ^= (uintptr_t) currNodePtr ^ (uintptr_t) nextNodePtr;
+		}
+		if (nextNodePtr != NULL) {
+			nextNodePtr->link ^= (uintptr_t) currNodePtr ^ (uintptr_t) prevNodePtr;
+		}
+	}
+	else {
+		if (prevNodePtr != NULL) {
+			prevNodePtr->nextNodePtr = nextNodePtr;
+		}
+		if (nextNodePtr != NULL) {
+			nextNodePtr->link = (uintptr_t) prevNodePtr;
+		}
+	}
+
+	if (prevNodePtr == NULL) {
+		listPtr->headPtr = nextNodePtr;
+	}
+	if (nextNodePtr == NULL) {
+		listPtr->tailPtr = prevNodePtr;
+	}
+	(listPtr->numNodes)--;
+	free (currNodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to find the two nodes on either side of a position of a doubly linked list
+ * The list is walked from the head or from the tail, whichever is nearer.
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, position (Index) (int): from 0 (before head) to
+ * (listPtr->numNodes) (after tail), prevNodePtrPtr (DoublyListNode **): receives the node at position-1 (NULL if
+ * position is 0), nextNodePtrPtr (DoublyListNode **): receives the node at position (NULL if position is numNodes)
+ * Return value: none
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
+ * Time complexity: O(min(position, listPtr->numNodes - position))
+ * Space complexity: O(1)
+ */
+static void FindNeighbours (DoublyList *listPtr, Index position, DoublyListNode **prevNodePtrPtr, DoublyListNode **nextNodePtrPtr) {
+	DoublyListNode *prevNodePtr, *currNodePtr, *nextNodePtr;
+	Index i;
+
+	if (position <= (listPtr->numNodes)-position) {
+		prevNodePtr = NULL;
+		currNodePtr = listPtr->headPtr;
+		for (i = 0; i < position; i++) {
+			nextNodePtr = StepForward (listPtr->kind, prevNodePtr, currNodePtr);
+			prevNodePtr = currNodePtr;
+			currNodePtr = nextNodePtr;
+		}
+
+		*prevNodePtrPtr = prevNodePtr;
+		*nextNodePtrPtr = currNodePtr;
+	}
+	else {
+		nextNodePtr = NULL;
+		currNodePtr = listPtr->tailPtr;
+		for (i = listPtr->numNodes; i > position; i--) {
+			prevNodePtr = StepBackward (listPtr->kind, currNodePtr, nextNodePtr);
+			nextNodePtr = currNodePtr;
+			currNodePtr = prevNodePtr;
+		}
+
+		*prevNodePtrPtr = currNodePtr;
+		*nextNodePtrPtr = nextNodePtr;
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find the node after a node of a doubly linked list
+ * Inputs: listPtr (const DoublyList *): pointer to doubly linked list, prevNodePtr (DoublyListNode *): the node before
+ * currNodePtr (NULL => currNodePtr is the head; only needed for XOR_LINKED lists), currNodePtr (DoublyListNode *)
+ * Return value: pointer to the node after currNodePtr, NULL if currNodePtr is the tail
+ * Assumptions: listPtr != NULL, currNodePtr is in the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+DoublyListNode *DoublyNextNode (const DoublyList *listPtr, DoublyListNode *prevNodePtr, DoublyListNode *currNodePtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyNextNode (const DoublyList *listPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	if (currNodePtr == NULL) {
+		printf ("Error: Argument 3 of DoublyNextNode (DoublyListNode *currNodePtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	return StepForward (listPtr->kind, prevNodePtr, currNodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find the node before a node of a doubly linked list
+ * Inputs: listPtr (const DoublyList *): pointer to doubly linked list, currNodePtr (DoublyListNode *),
+ * nextNodePtr (DoublyListNode *): the node after currNodePtr (NULL => currNodePtr is the tail; only needed for
+ * XOR_LINKED lists)
+ * Return value: pointer to the node before currNodePtr, NULL if currNodePtr is the head
+ * Assumptions: listPtr != NULL, currNodePtr is in the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+DoublyListNode *DoublyPrevNode (const DoublyList *listPtr, DoublyListNode *currNodePtr, DoublyListNode *nextNodePtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyPrevNode (const DoublyList *listPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	if (currNodePtr == NULL) {
+		printf ("Error: Argument 2 of DoublyPrevNode (DoublyListNode *currNodePtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	return StepBackward (listPtr->kind, currNodePtr, nextNodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find the node at a certain position w.r.t. the head of a doubly linked list
+ * The list is walked from the head or from the tail, whichever is nearer.
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, position (Index) (int): like an array index, from 0 (head)
+ * to (listPtr->numNodes)-1 (tail), prevNodePtrPtr (DoublyListNode **): if not NULL, receives the node before it (which
+ * DoublyNextNode and DoublyRemoveNode need for XOR_LINKED lists)
+ * Return value: pointer to the node at offset 'position' from the beginning, or NULL if position is out of bounds
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(min(position, listPtr->numNodes - position))
+ * Space complexity: O(1)
+ */
+DoublyListNode *DoublyGetNodeAtPosition (DoublyList *listPtr, Index position, DoublyListNode **prevNodePtrPtr) {
+	DoublyListNode *prevNodePtr, *currNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyGetNodeAtPosition (DoublyList *listPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	if (position < 0 || position >= (listPtr->numNodes)) {
+		printf ("Error:	Argument 2 of DoublyGetNodeAtPosition (Index position) is out of bounds\n");
+		return NULL;
+	}
+
+	FindNeighbours (listPtr, position, &prevNodePtr, &currNodePtr);
+	if (prevNodePtrPtr != NULL) {
+		*prevNodePtrPtr = prevNodePtr;
+	}
+	return currNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the end of a doubly linked list
+ * Inputs: listPtr (DoublyList *), data (Data) (int)
+ * Return value: none
+ * Pre-condition: listPtr is a doubly linked list, with some (or no) nodes
+ * Post-condition: A node with node.data = data is inserted at the end of the list
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void DoublyAddDataAtEnd (DoublyList *listPtr, Data data) {
+	DoublyListNode *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyAddDataAtEnd (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	newNodePtr = NewDoublyNode (listPtr->kind, data);
+	if (newNodePtr == NULL) {
+		return;
+	}
+
+	LinkBetween (listPtr, listPtr->tailPtr, NULL, newNodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the beginning of a doubly linked list
+ * Inputs: listPtr (DoublyList *), data (Data) (int)
+ * Return value: none
+ * Pre-condition: listPtr is a doubly linked list, with some (or no) nodes
+ * Post-condition: A node with node.data = data is inserted at the beginning of the list
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void DoublyAddDataAtBeginning (DoublyList *listPtr, Data data) {
+	DoublyListNode *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyAddDataAtBeginning (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	newNodePtr = NewDoublyNode (listPtr->kind, data);
+	if (newNodePtr == NULL) {
+		return;
+	}
+
+	LinkBetween (listPtr, NULL, listPtr->headPtr, newNodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to a doubly linked list at a certain position w.r.t. the head of the list
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, data (Data) (int), position (Index) (int)
+ * position is like an array index: should range from 0 (head) to (listPtr->numNodes) (after tail)
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: node containing data is inserted at offset 'position' from the beginning
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
+ * Time complexity: O(min(position, listPtr->numNodes - position))
+ * Space complexity: O(1)
+ */
+void DoublyAddDataFromBeginning (DoublyList *listPtr, Data data, Index position) {
+	DoublyListNode *prevNodePtr, *nextNodePtr, *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyAddDataFromBeginning (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > (listPtr->numNodes)) {
+		printf ("Error:	Argument 3 of DoublyAddDataFromBeginning (Index position) is out of bounds\n");
+		return;
+	}
+
+	newNodePtr = NewDoublyNode (listPtr->kind, data);
+	if (newNodePtr == NULL) {
+		return;
+	}
+
+	FindNeighbours (listPtr, position, &prevNodePtr, &nextNodePtr);
+	LinkBetween (listPtr, prevNodePtr, nextNodePtr, newNodePtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to a doubly linked list at a certain position w.r.t. the tail of the list
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, data (Data) (int), position (Index) (int).
+ * Position is like an array index: should range from 0 (tail) to (listPtr->numNodes) (before head)
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: node containing data is inserted at offset 'position' from the end
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
+ * Time complexity: O(min(position, listPtr->numNodes - position))
+ * Space complexity: O(1)
+ */
+void DoublyAddDataFromEnd (DoublyList *listPtr, Data data, Index position) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyAddDataFromEnd (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > (listPtr->numNodes)) {
+		printf ("Error:	Argument 3 of DoublyAddDataFromEnd (Index position) is out of bounds\n");
+		return;
+	}
+
+	DoublyAddDataFromBeginning (listPtr, data, (listPtr->numNodes)-position);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove a node from a doubly linked list
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, prevNodePtr (DoublyListNode *): the node before the node
+ * to be removed (NULL => it is the head); ignored for DOUBLY_LINKED lists, which find it themselves,
+ * currNodePtr (DoublyListNode *): the node to be removed
+ * Return value: none
+ * Pre-condition: list has some nodes
+ * Post-condition: currNodePtr is removed from the list and freed, listPtr->numNodes is decremented by 1
+ * Assumptions: listPtr != NULL, currNodePtr is in the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void DoublyRemoveNode (DoublyList *listPtr, DoublyListNode *prevNodePtr, DoublyListNode *currNodePtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyRemoveNode (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (currNodePtr == NULL) {
+		printf ("Error: Argument 3 of DoublyRemoveNode (DoublyListNode *currNodePtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->kind == XOR_LINKED) {
+		if (prevNodePtr == NULL && currNodePtr != listPtr->headPtr) {
+			printf ("Error: DoublyRemoveNode needs the node before currNodePtr in an XOR linked list\n");
+			return;
+		}
+	}
+	else {
+		prevNodePtr = StepBackward (listPtr->kind, currNodePtr, NULL);
+	}
+
+	UnlinkBetween (listPtr, prevNodePtr, currNodePtr, StepForward (listPtr->kind, prevNodePtr, currNodePtr));
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove the head of a doubly linked list, returning its data
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, dataPtr (Data *): receives the data of the head
+ * (may be NULL if the data is not needed)
+ * Return value: TRUE if a node was removed, FALSE if the list was empty
+ * Post-condition: the head is removed and freed, listPtr->numNodes is decremented by 1
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool DoublyRemoveDataAtBeginning (DoublyList *listPtr, Data *dataPtr) {
+	DoublyListNode *headPtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyRemoveDataAtBeginning (DoublyList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	headPtr = listPtr->headPtr;
+	if (headPtr == NULL) {
+		return FALSE;
+	}
+
+	if (dataPtr != NULL) {
+		*dataPtr = headPtr->data;
+	}
+	UnlinkBetween (listPtr, NULL, headPtr, StepForward (listPtr->kind, NULL, headPtr));
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove the tail of a doubly linked list, returning its data
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, dataPtr (Data *): receives the data of the tail
+ * (may be NULL if the data is not needed)
+ * Return value: TRUE if a node was removed, FALSE if the list was empty
+ * Post-condition: the tail is removed and freed, listPtr->numNodes is decremented by 1
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool DoublyRemoveDataAtEnd (DoublyList *listPtr, Data *dataPtr) {
+	DoublyListNode *tailPtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyRemoveDataAtEnd (DoublyList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	tailPtr = listPtr->tailPtr;
+	if (tailPtr == NULL) {
+		return FALSE;
+	}
+
+	if (dataPtr != NULL) {
+		*dataPtr = tailPtr->data;
+	}
+	UnlinkBetween (listPtr, StepBackward (listPtr->kind, tailPtr, NULL), tailPtr, NULL);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove given data from a doubly linked list
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, data (Data) (int)
+ * Return value: none
+ * Pre-condition: list has some (or no) nodes
+ * Post-condition: All occurrences of data in list are removed, listPtr->numNodes is reduced by number of nodes removed
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Space complexity: O(1)
+ */
+void DoublyRemoveData (DoublyList *listPtr, Data data) {
+	DoublyListNode *prevNodePtr, *currNodePtr, *nextNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyRemoveData (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	while (currNodePtr != NULL) {
+		nextNodePtr = StepForward (listPtr->kind, prevNodePtr, currNodePtr);
+
+		if (currNodePtr->data == data) {
+			UnlinkBetween (listPtr, prevNodePtr, currNodePtr, nextNodePtr);
+		}
+		else {
+			prevNodePtr = currNodePtr;
+		}
+		currNodePtr = nextNodePtr;
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove (and free) all nodes in a doubly linked list
+ * Input: listPtr (DoublyList *): pointer to doubly linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: list contains zero nodes, listPtr->headPtr = listPtr->tailPtr = NULL, listPtr->numNodes = 0
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Space complexity: O(1)
+ */
+void DoublyRemoveAllNodes (DoublyList *listPtr) {
+	DoublyListNode *prevNodePtr, *currNodePtr, *nextNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyRemoveAllNodes (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	// a node is freed only once the step past the node after it no longer needs its address
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	while (currNodePtr != NULL) {
+		nextNodePtr = StepForward (listPtr->kind, prevNodePtr, currNodePtr);
+		free (prevNodePtr);
+		prevNodePtr = currNodePtr;
+		currNodePtr = nextNodePtr;
+	}
+	free (prevNodePtr);
+
+	listPtr->headPtr = NULL;
+	listPtr->tailPtr = NULL;
+	listPtr->numNodes = 0;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to reverse a doubly linked list
+ * An XOR_LINKED list reads the same in both directions, so only its head and tail are swapped.
+ * Input: listPtr (DoublyList *): pointer to doubly linked list
+ * Return value: none
+ * Pre-condition: linked list contains some nodes (n_1)<->...(n_numNodes)
+ * Post-condition: linked list contains the nodes in order (n_numNodes)<->...(n_1)
+ * Assumption: listPtr != NULL
+ * Time complexity: O(1) for XOR_LINKED, O(listPtr->numNodes) for DOUBLY_LINKED
+ * Space complexity: O(1)
+ */
+void DoublyReverseList (DoublyList *listPtr) {
+	DoublyListNode *currNodePtr, *nextNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyReverseList (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->kind == DOUBLY_LINKED) {
+		currNodePtr = listPtr->headPtr;
+
+		while (currNodePtr != NULL) {
+			nextNodePtr = currNodePtr->nextNodePtr;
+			currNodePtr->nextNodePtr = (DoublyListNode *) currNodePtr->link;
+			currNodePtr->link = (uintptr_t) nextNodePtr;
+			currNodePtr = nextNodePtr;
+		}
+	}
+
+	currNodePtr = listPtr->headPtr;
+	listPtr->headPtr = listPtr->tailPtr;
+	listPtr->tailPtr = currNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to rotate a doubly linked list by a given amount
+ * The list is walked to the rotation point from whichever end is nearer, then four links are changed.
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, rotation (Index) (int): amount by which to rotate
+ * rotation > 0 => right rotation, rotation < 0 => left rotation (same meaning as for RotateList)
+ * Return value: none
+ * Assumptions: listPtr != NULL, -numNodes+1 <= rotation <= numNodes-1
+ * Time complexity: O(min(|rotation|, listPtr->numNodes - |rotation|))
+ * Space complexity: O(1)
+ */
+void DoublyRotateList (DoublyList *listPtr, Index rotation) {
+	DoublyListNode *prevNodePtr, *currNodePtr;
+	Index index;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyRotateList (DoublyList *listPtr) cannot be NULL\n");
+		return;
+	}
+	if (rotation <= -(listPtr->numNodes) || rotation >= (listPtr->numNodes)) {
+		printf ("Error: Argument 2 of DoublyRotateList (Index rotation) describes rotation that is not supported\n");
+		return;
+	}
+
+	if (rotation == 0) {
+		return;
+	}
+	else if (rotation < 0) {
+		index = -rotation;
+	}
+	else {
+		index = (listPtr->numNodes)-rotation;
+	}
+
+	// currNodePtr becomes the head and prevNodePtr the tail; neither is the old head or tail respectively
+	FindNeighbours (listPtr, index, &prevNodePtr, &currNodePtr);
+
+	if (listPtr->kind == XOR_LINKED) {
+		listPtr->tailPtr->link ^= (uintptr_t) listPtr->headPtr;
+		listPtr->headPtr->link ^= (uintptr_t) listPtr->tailPtr;
+		prevNodePtr->link ^= (uintptr_t) currNodePtr;
+		currNodePtr->link ^= (uintptr_t) prevNodePtr;
+	}
+	else {
+		listPtr->tailPtr->nextNodePtr = listPtr->headPtr;
+		listPtr->headPtr->link = (uintptr_t) listPtr->tailPtr;
+		prevNodePtr->nextNodePtr = NULL;
+		currNodePtr->link = (uintptr_t) NULL;
+	}
+
+	listPtr->headPtr = currNodePtr;
+	listPtr->tailPtr = prevNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to copy the contents of a doubly linked list into an array
+ * Inputs: listPtr (DoublyList *): pointer to doubly linked list, dataArray (Data *): array to copy into,
+ * arrayLength (Length) (int): number of elements dataArray can hold
+ * Return value: number of elements copied (Length) (int) = min(listPtr->numNodes, arrayLength)
+ * Post-condition: dataArray[i] holds the data of the i-th node (from the head), for each element copied. The list is unchanged.
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless arrayLength == 0)
+ * Time complexity: O(min(listPtr->numNodes, arrayLength))
+ * Space complexity: O(1)
+ */
+Length DoublyListToArray (DoublyList *listPtr, Data *dataArray, Length arrayLength) {
+	DoublyListNode *prevNodePtr, *currNodePtr, *nextNodePtr;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DoublyListToArray (DoublyList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	for (i = 0; i < arrayLength && currNodePtr != NULL; i++) {
+		dataArray[i] = currNodePtr->data;
+		nextNodePtr = StepForward (listPtr->kind, prevNodePtr, currNodePtr);
+		prevNodePtr = currNodePtr;
+		currNodePtr = nextNodePtr;
+	}
+
+	return i;
+}
@@ -0,0 +1,128 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the doubly linked list data structure.
+ * A doubly linked list can be walked in both directions, so it can work from whichever end is nearer, remove a node
+ * without searching for the one before it, and remove its tail in O(1).
+ * It comes in two kinds, behind the same functions:
+ * - DOUBLY_LINKED: each node holds the address of the node before it and a pointer to the node after it
+ * - XOR_LINKED: each node holds only (address of the node before it) XOR (address of the node after it), saving one
+ *   pointer per node. Walking needs two adjacent nodes, so the functions that step or remove take the neighbour too.
+ *
+ * The following types are declared in this file:
+ * a) DoublyListKind: For the kind of a doubly linked list. Another name for int, taking one of the values
+ *    DOUBLY_LINKED, XOR_LINKED
+ * b) struct doublylistnode (DoublyListNode): a structure representing one doubly linked list node. Contains the data,
+ *    the link to the node before it (XOR the node after it, for XOR_LINKED) and, for DOUBLY_LINKED only, a pointer to
+ *    the node after it
+ * c) struct doublylist (DoublyList): a structure representing a doubly linked list. Contains a head pointer, a tail
+ *    pointer, the number of nodes and the kind of the list
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to printing contents of a doubly linked list
+ * a) PrintDoublyList: Function to print the contents of a doubly linked list
+ *
+ * Related to initialising a doubly linked list
+ * b) InitialiseDoublyList: Function to create an empty doubly linked list of a given kind
+ *
+ * Related to walking a doubly linked list
+ * c) DoublyNextNode: Function to find the node after a node of a doubly linked list
+ * d) DoublyPrevNode: Function to find the node before a node of a doubly linked list
+ * e) DoublyGetNodeAtPosition: Function to find the node at a certain position w.r.t. the head of a doubly linked list
+ *
+ * Related to adding data (nodes) to a doubly linked list
+ * f) DoublyAddDataAtEnd: Function to add data at the end of a doubly linked list
+ * g) DoublyAddDataAtBeginning: Function to add data at the beginning of a doubly linked list
+ * h) DoublyAddDataFromBeginning: Function to add data at a certain position w.r.t. the head of a doubly linked list
+ * i) DoublyAddDataFromEnd: Function to add data at a certain position w.r.t. the tail of a doubly linked list
+ *
+ * Related to removing data (nodes) from a doubly linked list
+ * j) DoublyRemoveNode: Function to remove a node from a doubly linked list
+ * k) DoublyRemoveDataAtBeginning: Function to remove the head of a doubly linked list, returning its data
+ * l) DoublyRemoveDataAtEnd: Function to remove the tail of a doubly linked list, returning its data
+ * m) DoublyRemoveData: Function to remove all occurrences of given data from a doubly linked list
+ * n) DoublyRemoveAllNodes: Function to remove (and free) all nodes in a doubly linked list
+ *
+ * Related to permutation of a doubly linked list
+ * o) DoublyReverseList: Function to reverse a doubly linked list
+ * p) DoublyRotateList: Function to rotate a doubly linked list by a given amount
+ *
+ * Related to bulk transfer of data from a doubly linked list
+ * q) DoublyListToArray: Function to copy the contents of a doubly linked list into an array
+ *
+ * All of the above functions are defined in "Linked List/doublylist.c". For more details, see there.
+ */
+
+#ifndef DOUBLYLIST_H
+#define DOUBLYLIST_H
+
+	#include <stdint.h>
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// For the kind of a doubly linked list
+	typedef int DoublyListKind;
+	#define DOUBLY_LINKED 0
+	#define XOR_LINKED 1
+
+	// For one node in doubly linked list. XOR_LINKED nodes are allocated without nextNodePtr.
+	struct doublylistnode {
+		Data data;
+		uintptr_t link;
+		struct doublylistnode *nextNodePtr;
+	};
+	typedef struct doublylistnode DoublyListNode;
+
+	// Wrapper for doubly linked list node
+	struct doublylist {
+		DoublyListNode *headPtr;
+		DoublyListNode *tailPtr;
+		Length numNodes;
+		DoublyListKind kind;
+	};
+	typedef struct doublylist DoublyList;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/doublylist.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to printing the contents of the doubly linked list
+	void PrintDoublyList (DoublyList list);
+
+	// Related to initialising doubly linked lists
+	DoublyList InitialiseDoublyList (DoublyListKind kind);
+
+	// Related to walking a doubly linked list
+	DoublyListNode *DoublyNextNode (const DoublyList *listPtr, DoublyListNode *prevNodePtr, DoublyListNode *currNodePtr);
+	DoublyListNode *DoublyPrevNode (const DoublyList *listPtr, DoublyListNode *currNodePtr, DoublyListNode *nextNodePtr);
+	DoublyListNode *DoublyGetNodeAtPosition (DoublyList *listPtr, Index position, DoublyListNode **prevNodePtrPtr);
+
+	// Related to adding data (nodes) to a doubly linked list
+	void DoublyAddDataAtEnd (DoublyList *listPtr, Data data);
+	void DoublyAddDataAtBeginning (DoublyList *listPtr, Data data);
+	void DoublyAddDataFromBeginning (DoublyList *listPtr, Data data, Index position);
+	void DoublyAddDataFromEnd (DoublyList *listPtr, Data data, Index position);
+
+	// Related to removing data (nodes) from a doubly linked list
+	void DoublyRemoveNode (DoublyList *listPtr, DoublyListNode *prevNodePtr, DoublyListNode *currNodePtr);
+	bool DoublyRemoveDataAtBeginning (DoublyList *listPtr, Data *dataPtr);
+	bool DoublyRemoveDataAtEnd (DoublyList *listPtr, Data *dataPtr);
+	void DoublyRemoveData (DoublyList *listPtr, Data data);
+	void DoublyRemoveAllNodes (DoublyList *listPtr);
+
+	// Related to permutation of a doubly linked list
+	void DoublyReverseList (DoublyList *listPtr);
+	void DoublyRotateList (DoublyList *listPtr, Index rotation);
+
+	// Related to bulk transfer of data from a doubly linked list
+	Length DoublyListToArray (DoublyList *listPtr, Data *dataArray, Length arrayLength);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
@@ -0,0 +1,295 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <sched.h>  		// For yielding while waiting for readers
+#include "../epoch.h"		// For type declarations and function declarations related to epoch-based reclamation
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an epoch domain with no readers and nothing retired
+ * The domain is initialised in place (not returned by value), because it contains a lock.
+ * Input: domainPtr (EpochDomain *): pointer to the domain to initialise
+ * Return value: none
+ * Assumptions: no other thread uses the domain until this function returns
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void InitialiseEpochDomain (EpochDomain *domainPtr) {
+	Index i;
+
+	if (domainPtr == NULL) {
+		printf ("Error: Argument 1 of InitialiseEpochDomain (EpochDomain *domainPtr) cannot be NULL\n");
+		return;
+	}
+
+	atomic_init (&(domainPtr->globalEpoch), 0);
+	atomic_init (&(domainPtr->recordListPtr), NULL);
+	for (i = 0; i < EPOCH_NUM_LIMBO_LISTS; i++) {
+		atomic_init (&(domainPtr->limboListPtrs[i]), NULL);
+	}
+	atomic_init (&(domainPtr->numRetired), 0);
+	pthread_mutex_init (&(domainPtr->advanceLock), NULL);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to free a chain of retired nodes
+ * Input: entryPtr (EpochEntry *): first entry of the chain (may be NULL)
+ * Return value: none
+ * Time complexity: O(length of chain)
+ * Space complexity: O(1)
+ */
+static void FreeEntryChain (EpochEntry *entryPtr) {
+	EpochEntry *nextEntryPtr;
+
+	while (entryPtr != NULL) {
+		nextEntryPtr = entryPtr->nextEntryPtr;
+		entryPtr->freeFunction (entryPtr);
+		entryPtr = nextEntryPtr;
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to free everything retired to an epoch domain, and its reader records
+ * Input: domainPtr (EpochDomain *): pointer to epoch domain
+ * Return value: none
+ * Post-condition: all retired nodes are freed, all reader records are freed, and the domain must be initialised again before use
+ * Assumptions: no other thread uses the domain (or any of its records) any more
+ * Time complexity: O(number of retired nodes + number of records)
+ * Space complexity: O(1)
+ */
+void DestroyEpochDomain (EpochDomain *domainPtr) {
+	EpochRecord *recordPtr, *nextRecordPtr;
+	Index i;
+
+	if (domainPtr == NULL) {
+		printf ("Error: Argument 1 of DestroyEpochDomain (EpochDomain *domainPtr) cannot be NULL\n");
+		return;
+	}
+
+	for (i = 0; i < EPOCH_NUM_LIMBO_LISTS; i++) {
+		FreeEntryChain (atomic_exchange (&(domainPtr->limboListPtrs[i]), NULL));
+	}
+
+	recordPtr = atomic_exchange (&(domainPtr->recordListPtr), NULL);
+	while (recordPtr != NULL) {
+		nextRecordPtr = recordPtr->nextRecordPtr;
+		free (recordPtr);
+		recordPtr = nextRecordPtr;
+	}
+
+	pthread_mutex_destroy (&(domainPtr->advanceLock));
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to get a reader record for the calling thread
+ * A record given back by another thread is reused; otherwise a new record is allocated and added (lock-free) to the domain.
+ * Input: domainPtr (EpochDomain *): pointer to epoch domain
+ * Return value: pointer to a record owned by the caller until UnregisterEpochThread, or NULL if it could not be allocated
+ * Time complexity: O(number of records)
+ * Space complexity: O(1)
+ */
+EpochRecord *RegisterEpochThread (EpochDomain *domainPtr) {
+	EpochRecord *recordPtr, *headRecordPtr;
+	bool isInUse;
+
+	if (domainPtr == NULL) {
+		printf ("Error: Argument 1 of RegisterEpochThread (EpochDomain *domainPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	for (recordPtr = atomic_load (&(domainPtr->recordListPtr)); recordPtr != NULL; recordPtr = recordPtr->nextRecordPtr) {
+		isInUse = FALSE;
+		if (!atomic_load_explicit (&(recordPtr->isInUse), memory_order_relaxed)
+			&& atomic_compare_exchange_strong (&(recordPtr->isInUse), &isInUse, TRUE)) {
+			recordPtr->nestingDepth = 0;
+			return recordPtr;
+		}
+	}
+
+	recordPtr = (EpochRecord *) malloc (sizeof (EpochRecord));
+	if (recordPtr == NULL) {
+		printf ("Error: could not allocate a new epoch record\n");
+		return NULL;
+	}
+
+	atomic_init (&(recordPtr->localEpoch), 0);
+	atomic_init (&(recordPtr->isActive), FALSE);
+	atomic_init (&(recordPtr->isInUse), TRUE);
+	recordPtr->nestingDepth = 0;
+
+	headRecordPtr = atomic_load (&(domainPtr->recordListPtr));
+	do {
+		recordPtr->nextRecordPtr = headRecordPtr;
+	} while (!atomic_compare_exchange_weak (&(domainPtr->recordListPtr), &headRecordPtr, recordPtr));
+
+	return recordPtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to give back a reader record, for reuse by another thread
+ * Input: recordPtr (EpochRecord *): record returned by RegisterEpochThread
+ * Return value: none
+ * Assumptions: the thread is not inside a read section
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void UnregisterEpochThread (EpochRecord *recordPtr) {
+	if (recordPtr == NULL) {
+		printf ("Error: Argument 1 of UnregisterEpochThread (EpochRecord *recordPtr) cannot be NULL\n");
+		return;
+	}
+
+	atomic_store_explicit (&(recordPtr->isActive), FALSE, memory_order_release);
+	atomic_store_explicit (&(recordPtr->isInUse), FALSE, memory_order_release);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to start a read section
+ * Between EpochEnter and EpochExit the thread may follow pointers of the shared structure without locks; nothing it can
+ * reach is freed until it exits. Read sections may be nested; only the outermost pair counts.
+ * Inputs: domainPtr (EpochDomain *): pointer to epoch domain, recordPtr (EpochRecord *): record of the calling thread
+ * Return value: none
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void EpochEnter (EpochDomain *domainPtr, EpochRecord *recordPtr) {
+	if (recordPtr->nestingDepth++ > 0) {
+		return;
+	}
+
+	atomic_store_explicit (&(recordPtr->isActive), TRUE, memory_order_relaxed);
+	atomic_thread_fence (memory_order_seq_cst);
+	atomic_store_explicit (&(recordPtr->localEpoch), atomic_load (&(domainPtr->globalEpoch)), memory_order_relaxed);
+	atomic_thread_fence (memory_order_seq_cst);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to end a read section
+ * Input: recordPtr (EpochRecord *): record of the calling thread
+ * Return value: none
+ * Post-condition: pointers read inside the section must not be used any more
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void EpochExit (EpochRecord *recordPtr) {
+	if (--(recordPtr->nestingDepth) > 0) {
+		return;
+	}
+
+	atomic_store_explicit (&(recordPtr->isActive), FALSE, memory_order_release);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to retire an unlinked node, to be freed when no reader can still see it
+ * The node goes on the limbo list of the current epoch (a lock-free push). Every EPOCH_ADVANCE_INTERVAL retirements,
+ * the epoch is moved on if possible, so limbo lists are freed without any extra call.
+ * Inputs: domainPtr (EpochDomain *): pointer to epoch domain, entryPtr (EpochEntry *): entry embedded in the node,
+ * freeFunction (void (*) (EpochEntry *)): function that frees the node, given its entry
+ * Return value: none
+ * Pre-condition: the node is no longer reachable from the shared structure
+ * Assumptions: domainPtr != NULL, entryPtr != NULL, freeFunction != NULL. No reader record is needed.
+ * Time complexity: O(1), O(number of records + nodes freed) when the epoch is moved on
+ * Space complexity: O(1)
+ */
+void EpochRetire (EpochDomain *domainPtr, EpochEntry *entryPtr, void (*freeFunction) (EpochEntry *entryPtr)) {
+	_Atomic (EpochEntry *) *limboListPtrPtr;
+	EpochEntry *headEntryPtr;
+	unsigned long epoch;
+
+	entryPtr->freeFunction = freeFunction;
+
+	// the unlinking must be visible before the epoch is read
+	atomic_thread_fence (memory_order_seq_cst);
+	epoch = atomic_load (&(domainPtr->globalEpoch));
+	limboListPtrPtr = &(domainPtr->limboListPtrs[epoch % EPOCH_NUM_LIMBO_LISTS]);
+
+	headEntryPtr = atomic_load_explicit (limboListPtrPtr, memory_order_relaxed);
+	do {
+		entryPtr->nextEntryPtr = headEntryPtr;
+	} while (!atomic_compare_exchange_weak_explicit (limboListPtrPtr, &headEntryPtr, entryPtr,
+		memory_order_release, memory_order_relaxed));
+
+	if (atomic_fetch_add_explicit (&(domainPtr->numRetired), 1, memory_order_relaxed) % EPOCH_ADVANCE_INTERVAL == 0) {
+		EpochTryAdvance (domainPtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to move the global epoch on (and free a limbo list), if every reader allows it
+ * The epoch moves from g to g+1 only if every reader inside a read section entered during g. The nodes retired during g-1
+ * are then unreachable by every reader, and are freed. Only one thread moves the epoch at a time; others return at once.
+ * Input: domainPtr (EpochDomain *): pointer to epoch domain
+ * Return value: TRUE if the epoch was moved on, FALSE if a reader is still in an older epoch or another thread is moving it
+ * Assumptions: the calling thread is not inside a read section of this domain (it would only hold the epoch back)
+ * Time complexity: O(number of records + number of nodes freed)
+ * Space complexity: O(1)
+ */
+bool EpochTryAdvance (EpochDomain *domainPtr) {
+	EpochRecord *recordPtr;
+	EpochEntry *freeListPtr;
+	unsigned long epoch;
+
+	if (domainPtr == NULL) {
+		printf ("Error: Argument 1 of EpochTryAdvance (EpochDomain *domainPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (pthread_mutex_trylock (&(domainPtr->advanceLock)) != 0) {
+		return FALSE;
+	}
+
+	atomic_thread_fence (memory_order_seq_cst);
+	epoch = atomic_load (&(domainPtr->globalEpoch));
+
+	for (recordPtr = atomic_load (&(domainPtr->recordListPtr)); recordPtr != NULL; recordPtr = recordPtr->nextRecordPtr) {
+		if (atomic_load (&(recordPtr->isActive)) && atomic_load (&(recordPtr->localEpoch)) != epoch) {
+			pthread_mutex_unlock (&(domainPtr->advanceLock));
+			return FALSE;
+		}
+	}
+
+	// limbo list of g-1, which is the same list as g+2
+	freeListPtr = atomic_exchange (&(domainPtr->limboListPtrs[(epoch + 2) % EPOCH_NUM_LIMBO_LISTS]), NULL);
+	atomic_store (&(domainPtr->globalEpoch), epoch + 1);
+	pthread_mutex_unlock (&(domainPtr->advanceLock));
+
+	FreeEntryChain (freeListPtr);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to wait until everything retired so far has been freed
+ * Input: domainPtr (EpochDomain *): pointer to epoch domain
+ * Return value: none
+ * Post-condition: every node retired before the call is freed
+ * Assumptions: the calling thread is not inside a read section of this domain (it would wait for itself forever)
+ * Time complexity: O(number of records + number of nodes freed), plus the time readers take to exit
+ * Space complexity: O(1)
+ */
+void EpochSynchronize (EpochDomain *domainPtr) {
+	Length numAdvances;
+
+	if (domainPtr == NULL) {
+		printf ("Error: Argument 1 of EpochSynchronize (EpochDomain *domainPtr) cannot be NULL\n");
+		return;
+	}
+
+	// after three moves every limbo list has been freed once
+	numAdvances = 0;
+	while (numAdvances < EPOCH_NUM_LIMBO_LISTS) {
+		if (EpochTryAdvance (domainPtr)) {
+			numAdvances++;
+		}
+		else {
+			sched_yield ();
+		}
+	}
+}
@@ -0,0 +1,100 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to epoch-based reclamation.
+ * Epoch-based reclamation lets threads read a shared linked structure without locks while other threads unlink and
+ * free its nodes. A reader brackets its reads with EpochEnter and EpochExit. A writer that unlinks a node retires it
+ * instead of freeing it, and the node is freed only after every reader that might still hold a pointer to it has exited.
+ *
+ * The domain keeps a global epoch number. A node retired during epoch e is put on the limbo list of e. The epoch is moved
+ * on from g to g+1 only when every reader inside a read section entered during g; a reader that entered during g started
+ * after everything retired during g-1 was unlinked, so the limbo list of g-1 is then freed. Three limbo lists are enough.
+ *
+ * The following types are declared in this file:
+ * a) struct epochentry (EpochEntry): a structure to embed in a node that can be retired. Links retired nodes together
+ *    and records how to free the node
+ * b) struct epochrecord (EpochRecord): a structure representing one reader thread. Contains the epoch the thread entered
+ *    its read section in, and whether it is in one
+ * c) struct epochdomain (EpochDomain): a structure representing a reclamation domain. Contains the global epoch,
+ *    the reader records and the limbo lists
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to initialising an epoch domain
+ * a) InitialiseEpochDomain: Function to create an epoch domain with no readers and nothing retired
+ * b) DestroyEpochDomain: Function to free everything retired to an epoch domain, and its reader records
+ *
+ * Related to readers
+ * c) RegisterEpochThread: Function to get a reader record for the calling thread
+ * d) UnregisterEpochThread: Function to give back a reader record
+ * e) EpochEnter: Function to start a read section
+ * f) EpochExit: Function to end a read section
+ *
+ * Related to writers
+ * g) EpochRetire: Function to retire an unlinked node, to be freed when no reader can still see it
+ * h) EpochTryAdvance: Function to move the global epoch on (and free a limbo list), if every reader allows it
+ * i) EpochSynchronize: Function to wait until everything retired so far has been freed
+ *
+ * All of the above functions are defined in "Linked List/epoch.c". For more details, see there.
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+	#include <pthread.h>
+	#include <stdatomic.h>
+	#include "linkedlist.h"
+
+	// Number of limbo lists (nodes retired during the current epoch and the two before it)
+	#define EPOCH_NUM_LIMBO_LISTS 3
+
+	// Number of retirements after which EpochRetire tries to move the epoch on
+	#define EPOCH_ADVANCE_INTERVAL 64
+
+	// For a retired node, embedded in the node
+	struct epochentry {
+		struct epochentry *nextEntryPtr;
+		void (*freeFunction) (struct epochentry *entryPtr);
+	};
+	typedef struct epochentry EpochEntry;
+
+	// For one reader thread
+	struct epochrecord {
+		_Atomic unsigned long localEpoch;
+		_Atomic bool isActive;
+		_Atomic bool isInUse;
+		Length nestingDepth;
+		struct epochrecord *nextRecordPtr;
+	};
+	typedef struct epochrecord EpochRecord;
+
+	// For an epoch-based reclamation domain
+	struct epochdomain {
+		_Atomic unsigned long globalEpoch;
+		_Atomic (EpochRecord *) recordListPtr;
+		_Atomic (EpochEntry *) limboListPtrs[EPOCH_NUM_LIMBO_LISTS];
+		_Atomic unsigned long numRetired;
+		pthread_mutex_t advanceLock;
+	};
+	typedef struct epochdomain EpochDomain;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/epoch.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to initialising epoch domains
+	void InitialiseEpochDomain (EpochDomain *domainPtr);
+	void DestroyEpochDomain (EpochDomain *domainPtr);
+
+	// Related to readers
+	EpochRecord *RegisterEpochThread (EpochDomain *domainPtr);
+	void UnregisterEpochThread (EpochRecord *recordPtr);
+	void EpochEnter (EpochDomain *domainPtr, EpochRecord *recordPtr);
+	void EpochExit (EpochRecord *recordPtr);
+
+	// Related to writers
+	void EpochRetire (EpochDomain *domainPtr, EpochEntry *entryPtr, void (*freeFunction) (EpochEntry *entryPtr));
+	bool EpochTryAdvance (EpochDomain *domainPtr);
+	void EpochSynchronize (EpochDomain *domainPtr);
+
+#endif
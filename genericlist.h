@@ -0,0 +1,347 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing macros that generate a linked list for any element type.
+ * LinkedList holds Data (int) only. A generic list is generated for another element type (64-bit keys, small structs, ...)
+ * with two macros, the same way a list module is split into a header and a source file:
+ *
+ *   GENERIC_LIST_DECLARE (Name, ElementType)
+ *       in a header: declares the types and functions of the list
+ *   GENERIC_LIST_DEFINE (Name, ElementType, IsEqual, IsLess)
+ *       in exactly one source file: defines the functions
+ *
+ * IsEqual (a, b) and IsLess (a, b) are function-like macros (or static inline functions) that compare two elements.
+ * They are written into the generated code, so RemoveData, FindData and SortList compare elements inline, with no call
+ * through a function pointer. GENERIC_LIST_EQUAL_SCALAR and GENERIC_LIST_LESS_SCALAR suit arithmetic types;
+ * GENERIC_LIST_EQUAL_BYTES suits structs without padding. Nodes hold the element itself, so a node is as large as
+ * the element plus a pointer (rounded up for alignment).
+ *
+ * For example, GENERIC_LIST_DECLARE (Int64, int64_t) declares:
+ * a) struct Int64node (Int64Node): a structure representing one list node. Contains an int64_t and a pointer
+ *    to the next node
+ * b) struct Int64list (Int64List): a structure representing the list. Contains a head pointer, a tail pointer
+ *    and the number of nodes
+ *
+ * and the following functions, which behave like the LinkedList functions of the same name (see "linkedlist.h"):
+ * a) InitialiseInt64List: Function to create an empty list
+ * b) Int64AddDataAtEnd: Function to add data at the end of a list
+ * c) Int64AddDataAtBeginning: Function to add data at the beginning of a list
+ * d) Int64AddDataFromBeginning: Function to add data at a certain position w.r.t. the head of a list
+ * e) Int64FindData: Function to find the first node holding data equal to given data
+ * f) Int64RemoveData: Function to remove all occurrences of given data from a list
+ * g) Int64RemoveAllNodes: Function to remove (and free) all nodes in a list
+ * h) Int64ReverseList: Function to reverse a list
+ * i) Int64SortList: Function to sort a list in ascending order (in place, stable)
+ *
+ * A ready-made list of 64-bit keys is in "Linked List/int64list.h".
+ */
+
+#ifndef GENERICLIST_H
+#define GENERICLIST_H
+
+	#include <stdio.h>
+	#include <stdlib.h>
+	#include <string.h>
+	#include "linkedlist.h"
+
+	// Comparisons for arithmetic element types
+	#define GENERIC_LIST_EQUAL_SCALAR(a, b) ((a) == (b))
+	#define GENERIC_LIST_LESS_SCALAR(a, b) ((a) < (b))
+
+	// Equality for structs without padding (the size is known at compile time, so memcmp is expanded inline)
+	#define GENERIC_LIST_EQUAL_BYTES(a, b) (memcmp (&(a), &(b), sizeof (a)) == 0)
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Macro to declare the types and functions of a linked list of ElementType
+	 * Inputs: Name: prefix of the generated names, ElementType: type of the data held by each node
+	 */
+	#define GENERIC_LIST_DECLARE(Name, ElementType)											\
+		struct Name##node {															\
+			ElementType data;														\
+			struct Name##node *nextNodePtr;											\
+		};																			\
+		typedef struct Name##node Name##Node;										\
+																					\
+		struct Name##list {															\
+			Name##Node *headPtr;													\
+			Name##Node *tailPtr;													\
+			Length numNodes;														\
+		};																			\
+		typedef struct Name##list Name##List;										\
+																					\
+		Name##List Initialise##Name##List (void);									\
+		void Name##AddDataAtEnd (Name##List *listPtr, ElementType data);			\
+		void Name##AddDataAtBeginning (Name##List *listPtr, ElementType data);		\
+		void Name##AddDataFromBeginning (Name##List *listPtr, ElementType data, Index position);	\
+		Name##Node *Name##FindData (Name##List *listPtr, ElementType data);		\
+		Length Name##RemoveData (Name##List *listPtr, ElementType data);			\
+		void Name##RemoveAllNodes (Name##List *listPtr);							\
+		void Name##ReverseList (Name##List *listPtr);								\
+		void Name##SortList (Name##List *listPtr);
+
+	/*
+	 * G V Vishwanath, 17th October 2026, v1.0
+	 * Macro to define the functions of a linked list of ElementType, declared with GENERIC_LIST_DECLARE
+	 * Inputs: Name, ElementType: as for GENERIC_LIST_DECLARE,
+	 * IsEqual, IsLess: function-like macros (or static inline functions) taking two elements
+	 * Time complexity (of the generated functions): as for the LinkedList functions of the same name;
+	 * Name##FindData is O(numNodes), Name##SortList is O(numNodes log numNodes) with O(1) extra space
+	 */
+	#define GENERIC_LIST_DEFINE(Name, ElementType, IsEqual, IsLess)						\
+		Name##List Initialise##Name##List (void) {									\
+			Name##List list;														\
+			list.headPtr = NULL;													\
+			list.tailPtr = NULL;													\
+			list.numNodes = 0;														\
+			return list;															\
+		}																			\
+																					\
+		static Name##Node *Name##NewNode (ElementType data) {						\
+			Name##Node *newNodePtr;													\
+																					\
+			newNodePtr = (Name##Node *) malloc (sizeof (Name##Node));				\
+			if (newNodePtr == NULL) {												\
+				printf ("Error: could not allocate a new node\n");					\
+				return NULL;														\
+			}																		\
+			newNodePtr->data = data;												\
+			newNodePtr->nextNodePtr = NULL;											\
+			return newNodePtr;														\
+		}																			\
+																					\
+		void Name##AddDataAtEnd (Name##List *listPtr, ElementType data) {			\
+			Name##Node *newNodePtr;													\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "AddDataAtEnd (" #Name "List *listPtr) cannot be NULL\n");	\
+				return;																\
+			}																		\
+																					\
+			newNodePtr = Name##NewNode (data);										\
+			if (newNodePtr == NULL) {												\
+				return;																\
+			}																		\
+																					\
+			if (listPtr->headPtr == NULL) {											\
+				listPtr->headPtr = newNodePtr;										\
+			}																		\
+			else {																	\
+				listPtr->tailPtr->nextNodePtr = newNodePtr;							\
+			}																		\
+			listPtr->tailPtr = newNodePtr;											\
+			listPtr->numNodes++;													\
+		}																			\
+																					\
+		void Name##AddDataAtBeginning (Name##List *listPtr, ElementType data) {		\
+			Name##Node *newNodePtr;													\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "AddDataAtBeginning (" #Name "List *listPtr) cannot be NULL\n");	\
+				return;																\
+			}																		\
+																					\
+			newNodePtr = Name##NewNode (data);										\
+			if (newNodePtr == NULL) {												\
+				return;																\
+			}																		\
+																					\
+			newNodePtr->nextNodePtr = listPtr->headPtr;								\
+			listPtr->headPtr = newNodePtr;											\
+			if (listPtr->tailPtr == NULL) {											\
+				listPtr->tailPtr = newNodePtr;										\
+			}																		\
+			listPtr->numNodes++;													\
+		}																			\
+																					\
+		void Name##AddDataFromBeginning (Name##List *listPtr, ElementType data, Index position) {	\
+			Name##Node *prevNodePtr, *newNodePtr;									\
+			Index i;																\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "AddDataFromBeginning (" #Name "List *listPtr) cannot be NULL\n");	\
+				return;																\
+			}																		\
+																					\
+			if (position < 0 || position > (listPtr->numNodes)) {					\
+				printf ("Error:	Argument 3 of " #Name "AddDataFromBeginning (Index position) is out of bounds\n");	\
+				return;																\
+			}																		\
+																					\
+			if (position == 0) {													\
+				Name##AddDataAtBeginning (listPtr, data);							\
+				return;																\
+			}																		\
+			if (position == listPtr->numNodes) {									\
+				Name##AddDataAtEnd (listPtr, data);									\
+				return;																\
+			}																		\
+																					\
+			newNodePtr = Name##NewNode (data);										\
+			if (newNodePtr == NULL) {												\
+				return;																\
+			}																		\
+																					\
+			prevNodePtr = listPtr->headPtr;											\
+			for (i = 1; i < position; i++) {										\
+				prevNodePtr = prevNodePtr->nextNodePtr;								\
+			}																		\
+			newNodePtr->nextNodePtr = prevNodePtr->nextNodePtr;						\
+			prevNodePtr->nextNodePtr = newNodePtr;									\
+			listPtr->numNodes++;													\
+		}																			\
+																					\
+		Name##Node *Name##FindData (Name##List *listPtr, ElementType data) {		\
+			Name##Node *currNodePtr;												\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "FindData (" #Name "List *listPtr) cannot be NULL\n");	\
+				return NULL;														\
+			}																		\
+																					\
+			for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {	\
+				if (IsEqual (currNodePtr->data, data)) {							\
+					return currNodePtr;												\
+				}																	\
+			}																		\
+			return NULL;															\
+		}																			\
+																					\
+		Length Name##RemoveData (Name##List *listPtr, ElementType data) {			\
+			Name##Node **linkPtrPtr, *currNodePtr, *lastKeptNodePtr;				\
+			Length numRemoved;														\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "RemoveData (" #Name "List *listPtr) cannot be NULL\n");	\
+				return 0;															\
+			}																		\
+																					\
+			/* single pass, relinking through the link that points at the current node */	\
+			numRemoved = 0;															\
+			lastKeptNodePtr = NULL;													\
+			linkPtrPtr = &(listPtr->headPtr);										\
+			while (*linkPtrPtr != NULL) {											\
+				currNodePtr = *linkPtrPtr;											\
+				if (IsEqual (currNodePtr->data, data)) {							\
+					*linkPtrPtr = currNodePtr->nextNodePtr;							\
+					free (currNodePtr);												\
+					numRemoved++;													\
+				}																	\
+				else {																\
+					lastKeptNodePtr = currNodePtr;									\
+					linkPtrPtr = &(currNodePtr->nextNodePtr);						\
+				}																	\
+			}																		\
+			listPtr->tailPtr = lastKeptNodePtr;										\
+			listPtr->numNodes -= numRemoved;										\
+			return numRemoved;														\
+		}																			\
+																					\
+		void Name##RemoveAllNodes (Name##List *listPtr) {							\
+			Name##Node *currNodePtr, *nextNodePtr;									\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "RemoveAllNodes (" #Name "List *listPtr) cannot be NULL\n");	\
+				return;																\
+			}																		\
+																					\
+			currNodePtr = listPtr->headPtr;											\
+			while (currNodePtr != NULL) {											\
+				nextNodePtr = currNodePtr->nextNodePtr;								\
+				free (currNodePtr);													\
+				currNodePtr = nextNodePtr;											\
+			}																		\
+			listPtr->headPtr = NULL;												\
+			listPtr->tailPtr = NULL;												\
+			listPtr->numNodes = 0;													\
+		}																			\
+																					\
+		void Name##ReverseList (Name##List *listPtr) {								\
+			Name##Node *prevNodePtr, *currNodePtr, *nextNodePtr;					\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "ReverseList (" #Name "List *listPtr) cannot be NULL\n");	\
+				return;																\
+			}																		\
+																					\
+			prevNodePtr = NULL;														\
+			currNodePtr = listPtr->headPtr;											\
+			listPtr->tailPtr = currNodePtr;											\
+			while (currNodePtr != NULL) {											\
+				nextNodePtr = currNodePtr->nextNodePtr;								\
+				currNodePtr->nextNodePtr = prevNodePtr;								\
+				prevNodePtr = currNodePtr;											\
+				currNodePtr = nextNodePtr;											\
+			}																		\
+			listPtr->headPtr = prevNodePtr;											\
+		}																			\
+																					\
+		static Name##Node *Name##CutChain (Name##Node *headPtr, Length numNodes) {	\
+			Name##Node *restPtr;													\
+																					\
+			while (headPtr != NULL && numNodes > 1) {								\
+				headPtr = headPtr->nextNodePtr;										\
+				numNodes--;															\
+			}																		\
+			if (headPtr == NULL) {													\
+				return NULL;														\
+			}																		\
+			restPtr = headPtr->nextNodePtr;											\
+			headPtr->nextNodePtr = NULL;											\
+			return restPtr;															\
+		}																			\
+																					\
+		static Name##Node *Name##MergeChains (Name##Node *firstPtr, Name##Node *secondPtr, Name##Node **tailPtrPtr) {	\
+			Name##Node dummyNode, *lastNodePtr;										\
+																					\
+			lastNodePtr = &dummyNode;												\
+			while (firstPtr != NULL && secondPtr != NULL) {							\
+				if (IsLess (secondPtr->data, firstPtr->data)) {						\
+					lastNodePtr->nextNodePtr = secondPtr;							\
+					secondPtr = secondPtr->nextNodePtr;								\
+				}																	\
+				else {																\
+					lastNodePtr->nextNodePtr = firstPtr;							\
+					firstPtr = firstPtr->nextNodePtr;								\
+				}																	\
+				lastNodePtr = lastNodePtr->nextNodePtr;								\
+			}																		\
+			lastNodePtr->nextNodePtr = (firstPtr != NULL) ? firstPtr : secondPtr;	\
+			while (lastNodePtr->nextNodePtr != NULL) {								\
+				lastNodePtr = lastNodePtr->nextNodePtr;								\
+			}																		\
+			*tailPtrPtr = lastNodePtr;												\
+			return dummyNode.nextNodePtr;											\
+		}																			\
+																					\
+		void Name##SortList (Name##List *listPtr) {									\
+			Name##Node dummyNode, *lastNodePtr, *currNodePtr, *leftPtr, *rightPtr, *mergedTailPtr;	\
+			Length width;															\
+																					\
+			if (listPtr == NULL) {													\
+				printf ("Error: Argument 1 of " #Name "SortList (" #Name "List *listPtr) cannot be NULL\n");	\
+				return;																\
+			}																		\
+																					\
+			if (listPtr->numNodes < 2) {											\
+				return;																\
+			}																		\
+																					\
+			/* bottom-up merge sort: merge runs of width 1, 2, 4, ... along the list */	\
+			dummyNode.nextNodePtr = listPtr->headPtr;								\
+			lastNodePtr = NULL;														\
+			for (width = 1; width < listPtr->numNodes; width *= 2) {				\
+				lastNodePtr = &dummyNode;											\
+				currNodePtr = dummyNode.nextNodePtr;								\
+				while (currNodePtr != NULL) {										\
+					leftPtr = currNodePtr;											\
+					rightPtr = Name##CutChain (leftPtr, width);						\
+					currNodePtr = Name##CutChain (rightPtr, width);					\
+					lastNodePtr->nextNodePtr = Name##MergeChains (leftPtr, rightPtr, &mergedTailPtr);	\
+					lastNodePtr = mergedTailPtr;									\
+				}																	\
+			}																		\
+			listPtr->headPtr = dummyNode.nextNodePtr;								\
+			listPtr->tailPtr = lastNodePtr;											\
+		}
+
+#endif
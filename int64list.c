@@ -0,0 +1,4 @@
+#include "../int64list.h"	// For type declarations and function declarations related to linked lists of 64-bit keys
+
+// Defines InitialiseInt64List, Int64AddDataAtEnd, ..., Int64SortList, comparing keys inline
+GENERIC_LIST_DEFINE (Int64, int64_t, GENERIC_LIST_EQUAL_SCALAR, GENERIC_LIST_LESS_SCALAR)
@@ -0,0 +1,18 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to linked lists of 64-bit keys.
+ * The list is generated from "genericlist.h"; see there for the types and functions (Int64List, Int64Node,
+ * InitialiseInt64List, Int64AddDataAtEnd, Int64RemoveData, ...).
+ *
+ * All of the functions are defined in "Linked List/int64list.c".
+ */
+
+#ifndef INT64LIST_H
+#define INT64LIST_H
+
+	#include <stdint.h>
+	#include "genericlist.h"
+
+	GENERIC_LIST_DECLARE (Int64, int64_t)
+
+#endif
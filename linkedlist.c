@@ -1,9 +1,22 @@
 #include <stdio.h>  		// For input/output
 #include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <string.h> 		// For copying arrays of data
+#include <stdint.h> 		// For the distance in memory between nodes
+#include <pthread.h>		// For sorting chunks of a list in parallel
 #include "../linkedlist.h"	// For type declarations and function declarations related to the linked list data structure
+#include "../nodepool.h"	// For the node pool allocator
+#include "../nodecache.h"	// For the node cache allocator
+#include "../positionindex.h"	// For the positional index
+#include "../valueindex.h"	// For the value index
+#include "../listio.h"		// For writing out the list in large chunks
+#include "../liststats.h"	// For recording operation statistics (with LIST_STATS 1)
 
 #define DEBUG 0	    // Condition to print statements for debugging. If 0, no need to print. If 1, print.
 
+#define PARALLEL_SORT_MIN_CHUNK 65536	// Fewest nodes per thread for which SortListParallel uses threads
+
+#define COMPACT_NEAR_BYTES 64	// Largest distance in memory between consecutive nodes that ListFragmentation counts as close
+
 /*
  * G V Vishwanath, 15th May 2019. v1.0
  * Function to print data (integers)
@@ -17,24 +30,19 @@ void PrintData (Data data) {
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.0
+ * G V Vishwanath, 17th October 2026, v1.1
  * Function to print the contents of a linked list
+ * The list is formatted in chunks and written straight to standard output (see SerialiseListToFile),
+ * rather than with two printf calls per node.
  * Input: list (LinkedList)
  * Return value: none
  * Assumptions: list is terminated with a NULL, empty list has headPtr == NULL
  * Time complexity: O(list.numNodes)
- * Space complexity: O(1)
+ * Space complexity: O(LIST_IO_CHUNK_SIZE)
  */
 void PrintList (LinkedList list) {
-	ListNode *currNodePtr;
-	currNodePtr = list.headPtr;
-	
-	while (currNodePtr != NULL) {
-		PrintData (currNodePtr->data);
-		printf (" -> ");
-		currNodePtr = currNodePtr->nextNodePtr;
-	}
-	printf ("NULL\n");
+	fflush (stdout);
+	SerialiseListToFile (&list, fileno (stdout), LIST_FORMAT_ARROW);
 }
 
 /*
@@ -53,10 +61,14 @@ ListNode MakeNode (Data data) {
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.0
+ * G V Vishwanath, 18th October 2026, v1.5
  * Function to create an empty linked list
  * Input: none
- * Return value: list (ListNode) : linked list with list.numNodes = 0, list.headPtr = NULL, list.tailPtr = NULL
+ * Return value: list (ListNode) : linked list with list.numNodes = 0, list.headPtr = NULL, list.tailPtr = NULL,
+ * list.poolPtr = NULL (nodes are malloc-ed), list.cachePtr = NULL (no node cache),
+ * list.indexPtr = NULL (no positional index), list.valueIndexPtr = NULL (no value index),
+ * list.cursorListPtr = NULL (no cursors), list.maxFragmentation = 0 (no automatic compaction),
+ * and, with LIST_STATS 1, list.statsPtr = NULL (no statistics)
  * Time complexity: O(1)
  * Space complexity: O(1)
  */
@@ -65,34 +77,473 @@ LinkedList InitialiseList (void) {
 	list.numNodes = 0;
 	list.headPtr = NULL;
 	list.tailPtr = NULL;
+	list.poolPtr = NULL;
+	list.cachePtr = NULL;
+	list.indexPtr = NULL;
+	list.valueIndexPtr = NULL;
+	list.cursorListPtr = NULL;
+	list.maxFragmentation = 0;
+	#if LIST_STATS
+		list.statsPtr = NULL;
+	#endif
 	return list;
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.0
- * Function to add a new node after a certain node in a linked list
- * Takes special action if the list is empty, or the new node is to be inserted at the head, 
- * or the new node is to be inserted after the tail
- * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): pointer to node before which
- * new node is to be inserted, newNodePtr (ListNode *): new node to be inserted
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to allocate a node for a linked list without a node pool
+ * The node is taken from the list's node cache if one is attached, and malloc-ed otherwise
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: pointer to an uninitialised node, or NULL if allocation failed
+ * Assumptions: listPtr != NULL, listPtr->poolPtr == NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static ListNode *AllocateUnpooledNode (LinkedList *listPtr) {
+	if (listPtr->cachePtr != NULL) {
+		return AllocateCachedNode (listPtr->cachePtr);
+	}
+	return (ListNode *) malloc (sizeof (ListNode));
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to free a node of a linked list without a node pool
+ * The node is returned to the list's node cache if one is attached, and free-d otherwise
+ * Inputs: listPtr (LinkedList *): pointer to linked list, nodePtr (ListNode *): node to be freed
  * Return value: none
- * Pre-condition: The list has some (or no) nodes
- * Post-condition: newNodePtr is inserted between "the previous node" (might be NULL => new node is inserted at the head) 
- * and "the node originally after it" (might be NULL => new node is inserted at the tail). listPtr->numNodes is incremented by 1.
+ * Assumptions: listPtr != NULL, listPtr->poolPtr == NULL, nodePtr was allocated by AllocateUnpooledNode (for any list)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void FreeUnpooledNode (LinkedList *listPtr, ListNode *nodePtr) {
+	if (listPtr->cachePtr != NULL) {
+		FreeCachedNode (listPtr->cachePtr, nodePtr);
+	}
+	else {
+		free (nodePtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to allocate a new node for a linked list, with given data
+ * The node is taken from the list's node pool if one is attached, then from its node cache, and malloc-ed otherwise
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int)
+ * Return value: pointer to node with node->data = data, node->nextNodePtr = NULL, or NULL if allocation failed
  * Assumptions: listPtr != NULL
  * Time complexity: O(1)
  * Space complexity: O(1)
  */
-void AddNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *newNodePtr) {
-	if (listPtr == NULL) {
-		printf ("Error: Argument 1 of AddNode (LinkedList *listPtr) cannot be NULL\n");
+static ListNode *NewNode (LinkedList *listPtr, Data data) {
+	ListNode *newNodePtr;
+
+	if (listPtr->poolPtr != NULL) {
+		newNodePtr = AllocateNode (listPtr->poolPtr);
+	}
+	else {
+		newNodePtr = AllocateUnpooledNode (listPtr);
+	}
+
+	if (newNodePtr == NULL) {
+		printf ("Error: could not allocate a new node\n");
+		return NULL;
+	}
+
+	*newNodePtr = MakeNode (data);
+	LIST_STATS_ALLOCATED (listPtr, 1);
+	return newNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to free a node that has been unlinked from a linked list
+ * The node is returned to the list's node pool if one is attached, then to its node cache, and free-d otherwise
+ * Inputs: listPtr (LinkedList *): pointer to linked list, nodePtr (ListNode *): node to be freed
+ * Return value: none
+ * Assumptions: listPtr != NULL, nodePtr was allocated by NewNode for the same list (or a list with the same pool)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void DeleteNode (LinkedList *listPtr, ListNode *nodePtr) {
+	LIST_STATS_FREED (listPtr, 1);
+	if (listPtr->poolPtr != NULL) {
+		FreeNode (listPtr->poolPtr, nodePtr);
+	}
+	else {
+		FreeUnpooledNode (listPtr, nodePtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to free a chain of nodes that have been unlinked from a linked list
+ * With a node pool attached, the whole chain is handed back to the pool at once, and with a node cache, to the
+ * magazines of the calling thread in one go.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, firstNodePtr (ListNode *), lastNodePtr (ListNode *): first and
+ * last node of a chain linked through nextNodePtr (the last node's nextNodePtr is ignored), numNodes (Length) (int):
+ * number of nodes in the chain
+ * Return value: none
+ * Assumptions: listPtr != NULL, the nodes were allocated by NewNode for the same list (or a list with the same pool)
+ * Time complexity: O(1) with a node pool, O(numNodes) otherwise
+ * Space complexity: O(1)
+ */
+static void DeleteNodeChain (LinkedList *listPtr, ListNode *firstNodePtr, ListNode *lastNodePtr, Length numNodes) {
+	ListNode *tempNodePtr;
+
+	LIST_STATS_FREED (listPtr, numNodes);
+	if (listPtr->poolPtr != NULL) {
+		FreeNodeChain (listPtr->poolPtr, firstNodePtr, lastNodePtr, numNodes);
 		return;
 	}
+	if (listPtr->cachePtr != NULL) {
+		FreeCachedNodeChain (listPtr->cachePtr, firstNodePtr, numNodes);
+		return;
+	}
+
+	while (numNodes > 0) {
+		tempNodePtr = firstNodePtr;
+		firstNodePtr = firstNodePtr->nextNodePtr;
+		free (tempNodePtr);
+		numNodes--;
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.3
+ * Helper function to allocate a chain of new nodes for a linked list, holding the elements of an array in order
+ * With a node pool attached, the nodes are taken with AllocateNodeChain: freed nodes of the pool first, and the rest as
+ * one contiguous block. Otherwise they are taken one at a time (from the node cache, or malloc-ed), since each node
+ * must stay free-able on its own.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, dataArray (const Data *): array of data,
+ * numData (Length) (int): number of elements in dataArray, lastNodePtrPtr (ListNode **): receives the last node of the chain
+ * Return value: pointer to the first node of the chain (the last node has nextNodePtr = NULL), or NULL if allocation failed
+ * Assumptions: listPtr != NULL, dataArray != NULL, numData > 0
+ * Time complexity: O(numData)
+ * Space complexity: O(1) (besides the nodes)
+ */
+static ListNode *NewNodeChain (LinkedList *listPtr, const Data *dataArray, Length numData, ListNode **lastNodePtrPtr) {
+	ListNode *firstNodePtr, *currNodePtr, *nextNodePtr;
+	Index i;
+
+	if (listPtr->poolPtr != NULL) {
+		firstNodePtr = AllocateNodeChain (listPtr->poolPtr, numData, lastNodePtrPtr);
+		if (firstNodePtr == NULL) {
+			return NULL;
+		}
+
+		currNodePtr = firstNodePtr;
+		for (i = 0; i < numData; i++) {
+			currNodePtr->data = dataArray[i];
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+
+		LIST_STATS_ALLOCATED (listPtr, numData);
+		return firstNodePtr;
+	}
+
+	firstNodePtr = AllocateUnpooledNode (listPtr);
+	if (firstNodePtr == NULL) {
+		printf ("Error: could not allocate a new node\n");
+		return NULL;
+	}
+	firstNodePtr->data = dataArray[0];
+	currNodePtr = firstNodePtr;
+
+	for (i = 1; i < numData; i++) {
+		nextNodePtr = AllocateUnpooledNode (listPtr);
+
+		// undo the partial chain
+		if (nextNodePtr == NULL) {
+			printf ("Error: could not allocate a new node\n");
+			currNodePtr->nextNodePtr = NULL;
+			while (firstNodePtr != NULL) {
+				currNodePtr = firstNodePtr;
+				firstNodePtr = firstNodePtr->nextNodePtr;
+				FreeUnpooledNode (listPtr, currNodePtr);
+			}
+			return NULL;
+		}
+
+		nextNodePtr->data = dataArray[i];
+		currNodePtr->nextNodePtr = nextNodePtr;
+		currNodePtr = nextNodePtr;
+	}
+	currNodePtr->nextNodePtr = NULL;
+
+	*lastNodePtrPtr = currNodePtr;
+	LIST_STATS_ALLOCATED (listPtr, numData);
+	return firstNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to keep the structures attached to a linked list up to date after a run of new nodes has been linked in
+ * A cursor whose current node follows the new nodes stays on that node; cursors further on have their index moved up.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): node before the new nodes (NULL => head),
+ * firstNodePtr (ListNode *), lastNodePtr (ListNode *): first and last new node, numNew (Length) (int): number of new nodes,
+ * position (Index) (int): position of the first new node (-1 => not known)
+ * Return value: none
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of cursors + log listPtr->numNodes) expected, plus O(numNew) expected with a value index
+ * Space complexity: O(1)
+ */
+static void NoteInsertion (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *firstNodePtr, ListNode *lastNodePtr,
+	Length numNew, Index position) {
+	ListCursor *cursorPtr;
+	ListNode *currNodePtr;
+
+	if (listPtr->indexPtr != NULL) {
+		if (position >= 0 && numNew == 1) {
+			PositionIndexInsert (listPtr, firstNodePtr, position);
+		}
+		else {
+			InvalidatePositionIndex (listPtr);
+		}
+	}
+
+	if (listPtr->valueIndexPtr != NULL) {
+		ValueIndexInsert (listPtr, prevNodePtr, firstNodePtr);
+		for (currNodePtr = firstNodePtr; currNodePtr != lastNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			ValueIndexInsert (listPtr, currNodePtr, currNodePtr->nextNodePtr);
+		}
+
+		// the node after the new nodes has a new node before it
+		if (lastNodePtr->nextNodePtr != NULL) {
+			ValueIndexRelink (listPtr, lastNodePtr->nextNodePtr, lastNodePtr);
+		}
+	}
+
+	for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+		// new nodes went in just before the current node of the cursor
+		if (cursorPtr->prevNodePtr == prevNodePtr) {
+			cursorPtr->prevNodePtr = lastNodePtr;
+			cursorPtr->index += numNew;
+		}
+		else if (position >= 0) {
+			if (position < cursorPtr->index) {
+				cursorPtr->index += numNew;
+			}
+		}
+		else {
+			cursorPtr->isIndexKnown = FALSE;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to keep the structures attached to a linked list up to date after a node has been unlinked
+ * A cursor on the removed node moves on to the node after it.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): node before the removed node (NULL => head),
+ * nodePtr (ListNode *): the removed node (not yet freed), position (Index) (int): position the node had (-1 => not known)
+ * Return value: none
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of cursors + log listPtr->numNodes) expected
+ * Space complexity: O(1)
+ */
+static void NoteRemoval (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *nodePtr, Index position) {
+	ListCursor *cursorPtr;
+
+	if (listPtr->indexPtr != NULL) {
+		if (position >= 0) {
+			PositionIndexRemove (listPtr, position);
+		}
+		else {
+			InvalidatePositionIndex (listPtr);
+		}
+	}
+
+	if (listPtr->valueIndexPtr != NULL) {
+		ValueIndexRemove (listPtr, nodePtr);
+		if (nodePtr->nextNodePtr != NULL) {
+			ValueIndexRelink (listPtr, nodePtr->nextNodePtr, prevNodePtr);
+		}
+	}
+
+	for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+		if (cursorPtr->currNodePtr == nodePtr) {
+			cursorPtr->currNodePtr = nodePtr->nextNodePtr;
+		}
+		else if (cursorPtr->prevNodePtr == nodePtr) {
+			cursorPtr->prevNodePtr = prevNodePtr;
+			(cursorPtr->index)--;
+		}
+		else if (position >= 0) {
+			if (position < cursorPtr->index) {
+				(cursorPtr->index)--;
+			}
+		}
+		else {
+			cursorPtr->isIndexKnown = FALSE;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to keep the structures attached to a linked list up to date after a run of nodes has been unlinked
+ * (to be linked into another list). Cursors on the removed nodes move on to the node after them.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): node before the removed nodes
+ * (NULL => head), firstNodePtr (ListNode *), lastNodePtr (ListNode *): first and last removed node, with
+ * lastNodePtr->nextNodePtr still the node after them, numRemoved (Length) (int): number of removed nodes,
+ * position (Index) (int): position the first removed node had (-1 => not known)
+ * Return value: none
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of cursors), plus O(numRemoved) expected with a value index, plus O(numRemoved) for each
+ * cursor whose position (or that of the removed nodes) is not known
+ * Space complexity: O(1)
+ */
+static void NoteRangeRemoval (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *firstNodePtr, ListNode *lastNodePtr,
+	Length numRemoved, Index position) {
+	ListCursor *cursorPtr;
+	ListNode *nextNodePtr = lastNodePtr->nextNodePtr, *currNodePtr;
+	bool isInRange;
+
+	if (listPtr->indexPtr != NULL) {
+		InvalidatePositionIndex (listPtr);
+	}
+
+	if (listPtr->valueIndexPtr != NULL) {
+		for (currNodePtr = firstNodePtr; currNodePtr != nextNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			ValueIndexRemove (listPtr, currNodePtr);
+		}
+		if (nextNodePtr != NULL) {
+			ValueIndexRelink (listPtr, nextNodePtr, prevNodePtr);
+		}
+	}
+
+	for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+		// the current node of the cursor follows the removed nodes
+		if (cursorPtr->prevNodePtr == lastNodePtr) {
+			cursorPtr->prevNodePtr = prevNodePtr;
+			cursorPtr->index -= numRemoved;
+		}
+		else if (position >= 0 && cursorPtr->isIndexKnown) {
+			if (cursorPtr->index >= position + numRemoved) {
+				cursorPtr->index -= numRemoved;
+			}
+			else if (cursorPtr->index >= position) {
+				cursorPtr->prevNodePtr = prevNodePtr;
+				cursorPtr->currNodePtr = nextNodePtr;
+				cursorPtr->index = position;
+			}
+		}
+		else {
+			isInRange = FALSE;
+			for (currNodePtr = firstNodePtr; currNodePtr != nextNodePtr && !isInRange; currNodePtr = currNodePtr->nextNodePtr) {
+				isInRange = (cursorPtr->currNodePtr == currNodePtr);
+			}
+			if (isInRange) {
+				cursorPtr->prevNodePtr = prevNodePtr;
+				cursorPtr->currNodePtr = nextNodePtr;
+			}
+			cursorPtr->isIndexKnown = FALSE;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to move all cursors of a linked list back to the head
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of cursors)
+ * Space complexity: O(1)
+ */
+static void ResetCursors (LinkedList *listPtr) {
+	ListCursor *cursorPtr;
+
+	for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+		cursorPtr->prevNodePtr = NULL;
+		cursorPtr->currNodePtr = listPtr->headPtr;
+		cursorPtr->index = 0;
+		cursorPtr->isIndexKnown = TRUE;
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to keep the structures attached to a linked list up to date after the nodes have been reordered
+ * Cursors are moved back to the head.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of cursors)
+ * Space complexity: O(1)
+ */
+static void NoteRestructuring (LinkedList *listPtr) {
+	if (listPtr->indexPtr != NULL) {
+		InvalidatePositionIndex (listPtr);
+	}
+	if (listPtr->valueIndexPtr != NULL) {
+		InvalidateValueIndex (listPtr);
+	}
+
+	ResetCursors (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to mark a linked list empty, once its nodes have been freed or handed over to another list
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Post-condition: listPtr->headPtr = listPtr->tailPtr = NULL, listPtr->numNodes = 0, the indices (if any) are empty,
+ * and the cursors are past the end
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of cursors), plus the time to empty the indices
+ * Space complexity: O(1)
+ */
+static void ForgetAllNodes (LinkedList *listPtr) {
+	listPtr->headPtr = NULL;
+	listPtr->tailPtr = NULL;
+	listPtr->numNodes = 0;
+
+	if (listPtr->indexPtr != NULL) {
+		ClearPositionIndex (listPtr);
+	}
+	if (listPtr->valueIndexPtr != NULL) {
+		ClearValueIndex (listPtr);
+	}
+	ResetCursors (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to compact a linked list if it compacts itself (see SetAutoCompact) and has become too fragmented
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1) if the list does not compact itself, O(listPtr->numNodes) otherwise
+ * Space complexity: O(1)
+ */
+static void CompactIfFragmented (LinkedList *listPtr) {
+	if (listPtr->maxFragmentation > 0 && ListFragmentation (listPtr) > listPtr->maxFragmentation) {
+		CompactList (listPtr);
+	}
+}
 
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to link a new node into a linked list after a certain node, at a position that may be known
+ * Takes special action if the list is empty, or the new node is to be inserted at the head,
+ * or the new node is to be inserted after the tail
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): pointer to node after which
+ * new node is to be inserted, newNodePtr (ListNode *): new node to be inserted,
+ * position (Index) (int): position the new node will have (-1 => not known)
+ * Return value: none
+ * Post-condition: as for AddNode
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+static void InsertNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *newNodePtr, Index position) {
 	// list is empty
 	if (listPtr->headPtr == NULL) {
 		listPtr->headPtr = newNodePtr;
 		listPtr->tailPtr = newNodePtr;
+		prevNodePtr = NULL;
 	}
 
 	// new node is to be inserted at the head
@@ -114,10 +565,50 @@ void AddNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *newNodePtr)
 	}
 
 	(listPtr->numNodes)++;
+	NoteInsertion (listPtr, prevNodePtr, newNodePtr, newNodePtr, 1, position);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.2
+ * Function to add a new node after a certain node in a linked list
+ * Takes special action if the list is empty, or the new node is to be inserted at the head, 
+ * or the new node is to be inserted after the tail
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): pointer to node before which
+ * new node is to be inserted, newNodePtr (ListNode *): new node to be inserted
+ * Return value: none
+ * Pre-condition: The list has some (or no) nodes
+ * Post-condition: newNodePtr is inserted between "the previous node" (might be NULL => new node is inserted at the head) 
+ * and "the node originally after it" (might be NULL => new node is inserted at the tail). listPtr->numNodes is incremented by 1.
+ * An insertion in the middle of the list marks the positional index (if any) out of date, since its position is not known.
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void AddNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *newNodePtr) {
+	Index position;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AddNode (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_NODE);
+	if (listPtr->headPtr == NULL || prevNodePtr == NULL) {
+		position = 0;
+	}
+	else if (prevNodePtr == listPtr->tailPtr) {
+		position = listPtr->numNodes;
+	}
+	else {
+		position = -1;
+	}
+
+	InsertNode (listPtr, prevNodePtr, newNodePtr, position);
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 14th May 2019, v1.1
+ * G V Vishwanath, 17th October 2026, v1.2
  * Function to add data at the end of a linked list
  * Inputs: listPtr (LinkedList *), data (Data) (int)
  * Return value: none
@@ -135,14 +626,19 @@ void AddDataAtEnd (LinkedList *listPtr, Data data) {
 		return;
 	}
 
-	newNodePtr = (ListNode *) malloc (sizeof (ListNode));
-	*newNodePtr = MakeNode (data);
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_DATA_AT_END);
+	newNodePtr = NewNode (listPtr, data);
+	if (newNodePtr == NULL) {
+		LIST_STATS_END (listPtr);
+		return;
+	}
 
 	AddNode (listPtr, listPtr->tailPtr, newNodePtr); 
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 14th May 2019, v1.1
+ * G V Vishwanath, 17th October 2026, v1.2
  * Function to add data at the beginning of a linked list
  * Inputs: listPtr (LinkedList *), data (Data) (int)
  * Return value: none
@@ -160,14 +656,19 @@ void AddDataAtBeginning (LinkedList *listPtr, Data data) {
 		return;
 	}
 
-	newNodePtr = (ListNode *) malloc (sizeof (ListNode));
-	*newNodePtr = MakeNode (data);
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_DATA_AT_BEGINNING);
+	newNodePtr = NewNode (listPtr, data);
+	if (newNodePtr == NULL) {
+		LIST_STATS_END (listPtr);
+		return;
+	}
 
 	AddNode (listPtr, NULL, newNodePtr); 
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.1
+ * G V Vishwanath, 17th October 2026, v1.3
  * Function to add given data to a linked list at a certain position w.r.t. the head of the list
  * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int), position (Index) (int)
  * position is like an array index: should range from 0 (head) to (listPtr->numNodes) (after tail)
@@ -175,7 +676,7 @@ void AddDataAtBeginning (LinkedList *listPtr, Data data) {
  * Pre-condition: list contains some (or no) nodes
  * Post-condition: node containing data is inserted at offset 'position' from the beginning
  * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
- * Time complexity: O(position)
+ * Time complexity: O(position), O(log listPtr->numNodes) expected with a positional index
  * Space complexity: O(1)
  */
 void AddDataFromBeginning (LinkedList *listPtr, Data data, Index position) {
@@ -192,22 +693,33 @@ void AddDataFromBeginning (LinkedList *listPtr, Data data, Index position) {
 		return;
 	}
 
-	newNodePtr = (ListNode *) malloc (sizeof (ListNode));
-	*newNodePtr = MakeNode (data);
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_DATA_FROM_BEGINNING);
+	newNodePtr = NewNode (listPtr, data);
+	if (newNodePtr == NULL) {
+		LIST_STATS_END (listPtr);
+		return;
+	}
 
-	prevNodePtr = NULL;
-	currNodePtr = listPtr->headPtr;
+	if (listPtr->indexPtr != NULL) {
+		prevNodePtr = PositionIndexFind (listPtr, position-1);
+	}
+	else {
+		prevNodePtr = NULL;
+		currNodePtr = listPtr->headPtr;
 
-	for (i = 0; i < position; i++) {
-		prevNodePtr = currNodePtr;
-		currNodePtr = currNodePtr->nextNodePtr;
+		for (i = 0; i < position; i++) {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+		LIST_STATS_TRAVERSED (listPtr, position);
 	}
 	
-	AddNode (listPtr, prevNodePtr, newNodePtr);
+	InsertNode (listPtr, prevNodePtr, newNodePtr, position);
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.0
+ * G V Vishwanath, 17th October 2026, v1.1
  * Function to add given data to a linked list at a certain position w.r.t. the tail of the list
  * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int), position (Index) (int).
  * Position is like an array index: should range from 0 (tail) to (listPtr->numNodes) (before head)
@@ -215,7 +727,7 @@ void AddDataFromBeginning (LinkedList *listPtr, Data data, Index position) {
  * Pre-condition: list contains some (or no) nodes
  * Post-condition: node containing data is inserted at offset 'position' from the end
  * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numNodes)]
- * Time complexity: O(positionFromBeginning)
+ * Time complexity: O(positionFromBeginning), O(log listPtr->numNodes) expected with a positional index
  * Space complexity: O(1)
  */
 void AddDataFromEnd (LinkedList *listPtr, Data data, Index position) {
@@ -231,32 +743,134 @@ void AddDataFromEnd (LinkedList *listPtr, Data data, Index position) {
 		return;
 	}
 
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_DATA_FROM_END);
 	AddDataFromBeginning (listPtr, data, positionFromBeginning);
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.2
- * Helper function to remove a node from a linked list
- * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): the node before the node to be deleted,
- * currNodePtr (ListNode *): the node to be deleted
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to add the elements of an array at the end of a linked list
+ * Inputs: listPtr (LinkedList *): pointer to linked list, dataArray (const Data *): array of data,
+ * numData (Length) (int): number of elements in dataArray
  * Return value: none
- * Pre-condition: list has some (or no) nodes
- * Post-condition: currNode is removed from list, listPtr->numNodes is decremented by 1
- * Assumption: listPtr != NULL
- * Time complexity: O(1)
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: nodes holding dataArray[0], ..., dataArray[numData-1] (in that order) are inserted at the end of the list.
+ * listPtr->numNodes is incremented by numData. If allocation fails, the list is unchanged.
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless numData == 0)
+ * Time complexity: O(numData)
  * Space complexity: O(1)
  */
-void RemoveNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *currNodePtr) {
-	ListNode *tempNodePtr;
+void AddArrayAtEnd (LinkedList *listPtr, const Data *dataArray, Length numData) {
+	ListNode *prevNodePtr, *firstNodePtr, *lastNodePtr;
 
 	if (listPtr == NULL) {
-		printf ("Error: Argument 1 of RemoveNode (LinkedList *listPtr) cannot be NULL\n");
+		printf ("Error: Argument 1 of AddArrayAtEnd (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (numData < 0) {
+		printf ("Error: Argument 3 of AddArrayAtEnd (Length numData) cannot be negative\n");
+		return;
+	}
+
+	if (numData == 0) {
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_ARRAY_AT_END);
+	firstNodePtr = NewNodeChain (listPtr, dataArray, numData, &lastNodePtr);
+	if (firstNodePtr == NULL) {
+		LIST_STATS_END (listPtr);
+		return;
+	}
+
+	if (listPtr->headPtr == NULL) {
+		prevNodePtr = NULL;
+		listPtr->headPtr = firstNodePtr;
+	}
+	else {
+		prevNodePtr = listPtr->tailPtr;
+		listPtr->tailPtr->nextNodePtr = firstNodePtr;
+	}
+
+	listPtr->tailPtr = lastNodePtr;
+	listPtr->numNodes += numData;
+	NoteInsertion (listPtr, prevNodePtr, firstNodePtr, lastNodePtr, numData, (listPtr->numNodes)-numData);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to add the elements of an array at the beginning of a linked list
+ * Inputs: listPtr (LinkedList *): pointer to linked list, dataArray (const Data *): array of data,
+ * numData (Length) (int): number of elements in dataArray
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: nodes holding dataArray[0], ..., dataArray[numData-1] (in that order) are inserted at the beginning of the
+ * list, so that dataArray[0] is the new head. listPtr->numNodes is incremented by numData. If allocation fails, the list is unchanged.
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless numData == 0)
+ * Time complexity: O(numData)
+ * Space complexity: O(1)
+ */
+void AddArrayAtBeginning (LinkedList *listPtr, const Data *dataArray, Length numData) {
+	ListNode *firstNodePtr, *lastNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AddArrayAtBeginning (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (numData < 0) {
+		printf ("Error: Argument 3 of AddArrayAtBeginning (Length numData) cannot be negative\n");
+		return;
+	}
+
+	if (numData == 0) {
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_ARRAY_AT_BEGINNING);
+	firstNodePtr = NewNodeChain (listPtr, dataArray, numData, &lastNodePtr);
+	if (firstNodePtr == NULL) {
+		LIST_STATS_END (listPtr);
 		return;
 	}
 
+	if (listPtr->headPtr == NULL) {
+		listPtr->tailPtr = lastNodePtr;
+	}
+	else {
+		lastNodePtr->nextNodePtr = listPtr->headPtr;
+	}
+
+	listPtr->headPtr = firstNodePtr;
+	listPtr->numNodes += numData;
+	NoteInsertion (listPtr, NULL, firstNodePtr, lastNodePtr, numData, 0);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to unlink a node of a linked list without freeing it, at a position that may be known
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): the node before the node to be unlinked,
+ * currNodePtr (ListNode *): the node to be unlinked, position (Index) (int): position of the node (-1 => not known)
+ * Return value: pointer to the unlinked node
+ * Post-condition: as for RemoveNode, except that the node is not freed
+ * Assumption: listPtr != NULL
+ * Time complexity: O(1), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+static ListNode *DetachNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *currNodePtr, Index position) {
+	ListNode *tempNodePtr;
+
 	if (prevNodePtr == NULL) {
 		tempNodePtr = listPtr->headPtr;
 		listPtr->headPtr = listPtr->headPtr->nextNodePtr;
+
+		if (listPtr->headPtr == NULL) {
+			listPtr->tailPtr = NULL;
+		}
 	}
 	else {
 		tempNodePtr = currNodePtr;
@@ -267,47 +881,127 @@ void RemoveNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *currNodeP
 		}
 	}
 
-	free (tempNodePtr);
 	(listPtr->numNodes)--;
+	NoteRemoval (listPtr, prevNodePtr, tempNodePtr, position);
+
+	return tempNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to unlink and free a node of a linked list, at a position that may be known
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): the node before the node to be deleted,
+ * currNodePtr (ListNode *): the node to be deleted, position (Index) (int): position of the node to be deleted (-1 => not known)
+ * Return value: none
+ * Post-condition: as for RemoveNode
+ * Assumption: listPtr != NULL
+ * Time complexity: O(1), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+static void UnlinkNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *currNodePtr, Index position) {
+	DeleteNode (listPtr, DetachNode (listPtr, prevNodePtr, currNodePtr, position));
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.4
+ * G V Vishwanath, 17th October 2026, v1.4
+ * Helper function to remove a node from a linked list
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): the node before the node to be deleted,
+ * currNodePtr (ListNode *): the node to be deleted
+ * Return value: none
+ * Pre-condition: list has some (or no) nodes
+ * Post-condition: currNode is removed from list, listPtr->numNodes is decremented by 1.
+ * A removal in the middle of the list marks the positional index (if any) out of date, since its position is not known.
+ * Assumption: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void RemoveNode (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *currNodePtr) {
+	Index position;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of RemoveNode (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_REMOVE_NODE);
+	if (prevNodePtr == NULL) {
+		position = 0;
+	}
+	else if (currNodePtr == listPtr->tailPtr) {
+		position = (listPtr->numNodes)-1;
+	}
+	else {
+		position = -1;
+	}
+
+	UnlinkNode (listPtr, prevNodePtr, currNodePtr, position);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.8
  * Function to remove given data from the linked list
  * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int)
  * Return value: none
  * Pre-condition: list has some (or no) nodes
  * Post-condition: All occurrences of data in list are removed, if data is present at least once, 
- * size of linked list is reduced by number of nodes removed
+ * size of linked list is reduced by number of nodes removed. The list is then compacted if it has become too fragmented
+ * (see SetAutoCompact). With a value index, only the nodes holding data are visited.
  * Assumptions: listPtr != NULL, data is present at least once, all occurrences of data need to be removed
- * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Time complexity: O(listPtr->numNodes) [just before function is called],
+ * O(number of nodes removed) expected with a value index
  * Space complexity: O(1)
  */
 void RemoveData (LinkedList *listPtr, Data data) {
 	ListNode *prevNodePtr, *currNodePtr, *tempNodePtr;
 	Length numNodesFound = 0;
+	Index position = 0;
 
 	if (listPtr == NULL) {
 		printf ("Error: Argument 1 of RemoveData (LinkedList *listPtr) cannot be NULL\n");
 		return;
 	}
 
-	prevNodePtr = NULL;
-	currNodePtr = listPtr->headPtr;
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_REMOVE_DATA);
+	if (listPtr->valueIndexPtr != NULL) {
+		while ((currNodePtr = ValueIndexFind (listPtr, data, &prevNodePtr)) != NULL) {
+			if (prevNodePtr == NULL) {
+				position = 0;
+			}
+			else if (currNodePtr == listPtr->tailPtr) {
+				position = (listPtr->numNodes)-1;
+			}
+			else {
+				position = -1;
+			}
 
-	while (currNodePtr != NULL) {
-		if (currNodePtr->data == data) {
 			numNodesFound++;
-			tempNodePtr = currNodePtr;
-			currNodePtr = currNodePtr->nextNodePtr;
-			RemoveNode (listPtr, prevNodePtr, tempNodePtr);
+			UnlinkNode (listPtr, prevNodePtr, currNodePtr, position);
 		}
+		LIST_STATS_TRAVERSED (listPtr, numNodesFound);
+	}
 
-		else {
-			prevNodePtr = currNodePtr;
-			currNodePtr = currNodePtr->nextNodePtr;
+	else {
+		prevNodePtr = NULL;
+		currNodePtr = listPtr->headPtr;
+
+		while (currNodePtr != NULL) {
+			if (currNodePtr->data == data) {
+				numNodesFound++;
+				tempNodePtr = currNodePtr;
+				currNodePtr = currNodePtr->nextNodePtr;
+				UnlinkNode (listPtr, prevNodePtr, tempNodePtr, position);
+			}
+
+			else {
+				prevNodePtr = currNodePtr;
+				currNodePtr = currNodePtr->nextNodePtr;
+				position++;
+			}
 		}
+		LIST_STATS_TRAVERSED (listPtr, position + numNodesFound);
 	}
+	CompactIfFragmented (listPtr);
 
 	#if DEBUG
 		printf ("RemoveData: ");
@@ -321,17 +1015,211 @@ void RemoveData (LinkedList *listPtr, Data data) {
 			printf ("data found and deleted %d times in list\n", numNodesFound);
 		}
 	#endif
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 15th May 2019, v1.0
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Helper function to remove (and free) all nodes of a linked list whose data satisfies a predicate, in one pass
+ * The removed nodes are collected into a chain while the list is traversed, and freed together at the end.
+ * The list is then compacted if it has become too fragmented (see SetAutoCompact).
+ * Inputs: listPtr (LinkedList *): pointer to linked list, predicate (bool (*) (Data, void *)): returns TRUE for data
+ * to be removed, contextPtr (void *): passed on to every call of predicate
+ * Return value: number of nodes removed (Length) (int)
+ * Assumptions: listPtr != NULL, predicate != NULL
+ * Time complexity: O(listPtr->numNodes) calls of predicate
+ * Space complexity: O(1)
+ */
+static Length RemoveMatchingNodes (LinkedList *listPtr, bool (*predicate) (Data data, void *contextPtr), void *contextPtr) {
+	ListNode *prevNodePtr, *currNodePtr, *removedNodePtr;
+	ListNode *firstRemovedNodePtr = NULL, *lastRemovedNodePtr = NULL;
+	Length numNodesRemoved = 0;
+	Index position = 0;
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	while (currNodePtr != NULL) {
+		if (predicate (currNodePtr->data, contextPtr)) {
+			removedNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+			DetachNode (listPtr, prevNodePtr, removedNodePtr, position);
+
+			if (firstRemovedNodePtr == NULL) {
+				lastRemovedNodePtr = removedNodePtr;
+			}
+			removedNodePtr->nextNodePtr = firstRemovedNodePtr;
+			firstRemovedNodePtr = removedNodePtr;
+			numNodesRemoved++;
+		}
+
+		else {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+			position++;
+		}
+	}
+
+	LIST_STATS_TRAVERSED (listPtr, position + numNodesRemoved);
+	if (numNodesRemoved > 0) {
+		DeleteNodeChain (listPtr, firstRemovedNodePtr, lastRemovedNodePtr, numNodesRemoved);
+	}
+	CompactIfFragmented (listPtr);
+
+	return numNodesRemoved;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to remove all data satisfying a predicate from the linked list
+ * Inputs: listPtr (LinkedList *): pointer to linked list, predicate (bool (*) (Data, void *)): returns TRUE for data
+ * to be removed, contextPtr (void *): passed on to every call of predicate
+ * Return value: number of nodes removed (Length) (int)
+ * Pre-condition: list has some (or no) nodes
+ * Post-condition: every node whose data satisfies predicate is removed, in a single traversal of the list
+ * Assumptions: listPtr != NULL, predicate != NULL, predicate does not change the list
+ * Time complexity: O(listPtr->numNodes) [just before function is called] calls of predicate
+ * Space complexity: O(1)
+ */
+Length RemoveIf (LinkedList *listPtr, bool (*predicate) (Data data, void *contextPtr), void *contextPtr) {
+	Length numNodesRemoved;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of RemoveIf (LinkedList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	if (predicate == NULL) {
+		printf ("Error: Argument 2 of RemoveIf (bool (*predicate) (Data, void *)) cannot be NULL\n");
+		return 0;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_REMOVE_IF);
+	numNodesRemoved = RemoveMatchingNodes (listPtr, predicate, contextPtr);
+	LIST_STATS_END (listPtr);
+
+	return numNodesRemoved;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to compare two data values, for qsort
+ * Inputs: firstPtr (const void *), secondPtr (const void *): pointers to data
+ * Return value: negative, zero or positive, as *firstPtr is less than, equal to or greater than *secondPtr
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static int CompareData (const void *firstPtr, const void *secondPtr) {
+	Data first = *((const Data *) firstPtr), second = *((const Data *) secondPtr);
+	return (first > second) - (first < second);
+}
+
+// For the sorted set of values probed by RemoveDataSet
+struct dataset {
+	const Data *sortedValues;
+	Length numValues;
+};
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to test whether data is in a sorted set of values
+ * Small sets are scanned; larger ones are searched by binary search.
+ * Inputs: data (Data) (int), contextPtr (void *): pointer to the set (struct dataset)
+ * Return value: TRUE if data is in the set, FALSE otherwise
+ * Time complexity: O(log numValues)
+ * Space complexity: O(1)
+ */
+static bool IsInDataSet (Data data, void *contextPtr) {
+	const struct dataset *setPtr = (const struct dataset *) contextPtr;
+	Index low = 0, high = (setPtr->numValues)-1, middle;
+
+	if (setPtr->numValues <= 8) {
+		for (middle = 0; middle < setPtr->numValues; middle++) {
+			if (setPtr->sortedValues[middle] == data) {
+				return TRUE;
+			}
+		}
+		return FALSE;
+	}
+
+	while (low <= high) {
+		middle = low + (high-low)/2;
+		if (setPtr->sortedValues[middle] == data) {
+			return TRUE;
+		}
+		else if (setPtr->sortedValues[middle] < data) {
+			low = middle+1;
+		}
+		else {
+			high = middle-1;
+		}
+	}
+
+	return FALSE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Function to remove all occurrences of several data values from the linked list, in a single traversal
+ * Inputs: listPtr (LinkedList *): pointer to linked list, dataArray (const Data *): values to remove,
+ * numData (Length) (int): number of elements in dataArray (duplicates are allowed)
+ * Return value: number of nodes removed (Length) (int)
+ * Pre-condition: list has some (or no) nodes
+ * Post-condition: all occurrences of every value in dataArray are removed from the list
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless numData == 0)
+ * Time complexity: O(numData log numData + listPtr->numNodes log numData)
+ * Space complexity: O(numData)
+ */
+Length RemoveDataSet (LinkedList *listPtr, const Data *dataArray, Length numData) {
+	struct dataset set;
+	Data *sortedValues;
+	Length numNodesRemoved;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of RemoveDataSet (LinkedList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	if (numData < 0) {
+		printf ("Error: Argument 3 of RemoveDataSet (Length numData) cannot be negative\n");
+		return 0;
+	}
+
+	if (numData == 0 || listPtr->headPtr == NULL) {
+		return 0;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_REMOVE_DATA_SET);
+	sortedValues = (Data *) malloc (numData * sizeof (Data));
+	if (sortedValues == NULL) {
+		printf ("Error: RemoveDataSet could not allocate a copy of %d values\n", numData);
+		LIST_STATS_END (listPtr);
+		return 0;
+	}
+
+	memcpy (sortedValues, dataArray, numData * sizeof (Data));
+	qsort (sortedValues, numData, sizeof (Data), CompareData);
+
+	set.sortedValues = sortedValues;
+	set.numValues = numData;
+	numNodesRemoved = RemoveMatchingNodes (listPtr, IsInDataSet, &set);
+
+	free (sortedValues);
+	LIST_STATS_END (listPtr);
+	return numNodesRemoved;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.5
  * Function to remove (and free) all nodes in a linked list
+ * If the list has a node pool and owns every node in use in that pool, all slabs of the pool are released at once
+ * instead of freeing the nodes one at a time.
  * Input: listPtr (LinkedList *): pointer to linked list
  * Return value: none
  * Pre-condition: list contains some (or no) nodes
  * Post-condition: list contains zero nodes, listPtr->headPtr = listPtr->tailPtr = NULL, listPtr->numNodes = 0
  * Assumption: listPtr != NULL
- * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Time complexity: O(listPtr->numNodes) [just before function is called], O(number of slabs) if the pool is released
  * Space complexity: O(1)
  */
 void RemoveAllNodes (LinkedList *listPtr) {
@@ -342,14 +1230,25 @@ void RemoveAllNodes (LinkedList *listPtr) {
 		return;
 	}
 
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_REMOVE_ALL_NODES);
+	// every node in use in the pool belongs to this list
+	if (listPtr->poolPtr != NULL && listPtr->poolPtr->numNodesInUse == listPtr->numNodes) {
+		ReleaseAllSlabs (listPtr->poolPtr);
+		LIST_STATS_FREED (listPtr, listPtr->numNodes);
+		listPtr->headPtr = NULL;
+	}
+	else {
+		LIST_STATS_TRAVERSED (listPtr, listPtr->numNodes);
+	}
+
 	while (listPtr->headPtr != NULL) {
 		prevNodePtr = listPtr->headPtr;
 		listPtr->headPtr = listPtr->headPtr->nextNodePtr;
-		free (prevNodePtr);
+		DeleteNode (listPtr, prevNodePtr);
 	}
 
-	listPtr->tailPtr = NULL;
-	listPtr->numNodes = 0;
+	ForgetAllNodes (listPtr);
+	LIST_STATS_END (listPtr);
 
 	#if DEBUG
 		printf ("RemoveAllNodes: Removed all nodes from list\n");
@@ -357,7 +1256,83 @@ void RemoveAllNodes (LinkedList *listPtr) {
 }
 
 /*
- * G V Vishwanath, 16th May 2019, v1.0
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to copy the contents of a linked list into an array
+ * Inputs: listPtr (LinkedList *): pointer to linked list, dataArray (Data *): array to copy into,
+ * arrayLength (Length) (int): number of elements dataArray can hold
+ * Return value: number of elements copied (Length) (int) = min(listPtr->numNodes, arrayLength)
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: dataArray[i] holds the data of the i-th node (from the head), for each element copied. The list is unchanged.
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless arrayLength == 0)
+ * Time complexity: O(min(listPtr->numNodes, arrayLength))
+ * Space complexity: O(1)
+ */
+Length ListToArray (LinkedList *listPtr, Data *dataArray, Length arrayLength) {
+	ListNode *currNodePtr;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ListToArray (LinkedList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_LIST_TO_ARRAY);
+	currNodePtr = listPtr->headPtr;
+
+	for (i = 0; i < arrayLength && currNodePtr != NULL; i++) {
+		dataArray[i] = currNodePtr->data;
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+
+	LIST_STATS_TRAVERSED (listPtr, i);
+	LIST_STATS_END (listPtr);
+	return i;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to find the node at a certain position w.r.t. the head of a linked list
+ * Inputs: listPtr (LinkedList *): pointer to linked list, position (Index) (int): like an array index, from 0 (head)
+ * to (listPtr->numNodes)-1 (tail)
+ * Return value: pointer to the node at offset 'position' from the beginning, or NULL if position is out of bounds
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: list is unchanged
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(position), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+ListNode *GetNodeAtPosition (LinkedList *listPtr, Index position) {
+	ListNode *currNodePtr;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of GetNodeAtPosition (LinkedList *listPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	if (position < 0 || position >= (listPtr->numNodes)) {
+		printf ("Error:	Argument 2 of GetNodeAtPosition (Index position) is out of bounds\n");
+		return NULL;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_GET_NODE_AT_POSITION);
+	if (listPtr->indexPtr != NULL) {
+		currNodePtr = PositionIndexFind (listPtr, position);
+	}
+	else {
+		currNodePtr = listPtr->headPtr;
+		for (i = 0; i < position; i++) {
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+		LIST_STATS_TRAVERSED (listPtr, position);
+	}
+
+	LIST_STATS_END (listPtr);
+	return currNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.2
  * Function to reverse a linked list
  * Input: listPtr (LinkedList *): pointer to linked list
  * Return value: none
@@ -375,6 +1350,7 @@ void ReverseList (LinkedList *listPtr) {
 		return;
 	}
 
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_REVERSE);
 	originalHeadPtr = listPtr->headPtr;
 	prevNodePtr = NULL;
 	currNodePtr = listPtr->headPtr;
@@ -389,10 +1365,13 @@ void ReverseList (LinkedList *listPtr) {
 
 	listPtr->headPtr = prevNodePtr;
 	listPtr->tailPtr = originalHeadPtr;
+	NoteRestructuring (listPtr);
+	LIST_STATS_TRAVERSED (listPtr, listPtr->numNodes);
+	LIST_STATS_END (listPtr);
 }
 
 /*
- * G V Vishwanath, 16th May 2019, v1.0
+ * G V Vishwanath, 18th October 2026, v1.3
  * Function to rotate a linked list by a given amount
  * Inputs: listPtr (LinkedList *): pointer to linked list, rotation (Index) (int): amount by which to rotate
  * rotation > 0 => right rotation, rotation < 0 => left rotation
@@ -403,10 +1382,11 @@ void ReverseList (LinkedList *listPtr) {
  * [For +r: (n_(numNodes-1-r))->(n_(numNodes-r))->... (n_(numNodes-1))->(n_0)->...(n_(numNodes-2-r))->NULL]
  *
  * Assumptions: listPtr != NULL, -numNodes+1 <= rotation <= numNodes-1
- * Time complexity: O(index) [ = min ( |rotation| , listPtr->numNodes - |rotation| )]
+ * Time complexity: O(index) [ = min ( |rotation| , listPtr->numNodes - |rotation| )],
+ * O(log listPtr->numNodes) expected with a positional index
  */
 void RotateList (LinkedList *listPtr, Index rotation) {
-	ListNode *prevNodePtr, *currNodePtr;
+	ListNode *prevNodePtr, *currNodePtr, *originalTailPtr;
 	Index index, i;
 
 	if (listPtr == NULL) {
@@ -428,18 +1408,1313 @@ void RotateList (LinkedList *listPtr, Index rotation) {
 		index = (listPtr->numNodes)-rotation;
 	}
 
-	prevNodePtr = NULL;
-	currNodePtr = listPtr->headPtr;
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ROTATE);
+	if (listPtr->indexPtr != NULL) {
+		prevNodePtr = PositionIndexFind (listPtr, index-1);
+		currNodePtr = prevNodePtr->nextNodePtr;
+	}
+	else {
+		prevNodePtr = NULL;
+		currNodePtr = listPtr->headPtr;
 
-	for (i = 0; i < index; i++) {
-		prevNodePtr = currNodePtr;
-		currNodePtr = currNodePtr->nextNodePtr;
+		for (i = 0; i < index; i++) {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+		LIST_STATS_TRAVERSED (listPtr, index);
 	}
 	
+	originalTailPtr = listPtr->tailPtr;
 	listPtr->tailPtr->nextNodePtr = listPtr->headPtr;
 	prevNodePtr->nextNodePtr = NULL;
 	listPtr->headPtr = currNodePtr;
 	listPtr->tailPtr = prevNodePtr;
+
+	if (listPtr->indexPtr != NULL) {
+		PositionIndexRotate (listPtr, index);
+	}
+	if (listPtr->valueIndexPtr != NULL) {
+		ValueIndexRelink (listPtr, currNodePtr, NULL);
+		ValueIndexRelink (listPtr, originalTailPtr->nextNodePtr, originalTailPtr);
+	}
+	ResetCursors (listPtr);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to cut a chain of nodes after a given number of nodes
+ * Inputs: headPtr (ListNode *): first node of the chain (may be NULL), numNodes (Length) (int): number of nodes to keep
+ * Return value: pointer to the first node after the cut (NULL if the chain has at most numNodes nodes)
+ * Post-condition: the chain starting at headPtr has at most numNodes nodes
+ * Assumptions: numNodes > 0
+ * Time complexity: O(numNodes)
+ * Space complexity: O(1)
+ */
+static ListNode *CutChain (ListNode *headPtr, Length numNodes) {
+	ListNode *restPtr;
+
+	while (headPtr != NULL && numNodes > 1) {
+		headPtr = headPtr->nextNodePtr;
+		numNodes--;
+	}
+
+	if (headPtr == NULL) {
+		return NULL;
+	}
+
+	restPtr = headPtr->nextNodePtr;
+	headPtr->nextNodePtr = NULL;
+	return restPtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to merge two sorted chains of nodes into one, by relinking the nodes
+ * On equal data, nodes of the first chain come first (the merge is stable).
+ * Inputs: firstPtr (ListNode *), secondPtr (ListNode *): sorted NULL-terminated chains (either may be NULL),
+ * tailPtrPtr (ListNode **): receives the last node of the merged chain
+ * Return value: pointer to the first node of the merged chain
+ * Time complexity: O(length of both chains)
+ * Space complexity: O(1)
+ */
+static ListNode *MergeChains (ListNode *firstPtr, ListNode *secondPtr, ListNode **tailPtrPtr) {
+	ListNode dummyNode, *lastNodePtr;
+
+	lastNodePtr = &dummyNode;
+
+	while (firstPtr != NULL && secondPtr != NULL) {
+		if (secondPtr->data < firstPtr->data) {
+			lastNodePtr->nextNodePtr = secondPtr;
+			secondPtr = secondPtr->nextNodePtr;
+		}
+		else {
+			lastNodePtr->nextNodePtr = firstPtr;
+			firstPtr = firstPtr->nextNodePtr;
+		}
+		lastNodePtr = lastNodePtr->nextNodePtr;
+	}
+
+	lastNodePtr->nextNodePtr = (firstPtr != NULL) ? firstPtr : secondPtr;
+	while (lastNodePtr->nextNodePtr != NULL) {
+		lastNodePtr = lastNodePtr->nextNodePtr;
+	}
+
+	*tailPtrPtr = (lastNodePtr == &dummyNode) ? NULL : lastNodePtr;
+	return dummyNode.nextNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to sort a chain of nodes in ascending order of data, by bottom-up merge sort
+ * Runs of width 1, 2, 4, ... are merged pairwise along the chain, so no recursion and no extra memory is needed.
+ * Inputs: headPtr (ListNode *): first node of a NULL-terminated chain, numNodes (Length) (int): number of nodes in the chain,
+ * tailPtrPtr (ListNode **): receives the last node of the sorted chain
+ * Return value: pointer to the first node of the sorted chain
+ * Time complexity: O(numNodes log numNodes)
+ * Space complexity: O(1)
+ */
+static ListNode *SortChain (ListNode *headPtr, Length numNodes, ListNode **tailPtrPtr) {
+	ListNode dummyNode, *lastNodePtr, *currNodePtr, *leftPtr, *rightPtr, *mergedTailPtr;
+	Length width;
+
+	dummyNode.nextNodePtr = headPtr;
+	lastNodePtr = headPtr;
+
+	for (width = 1; width < numNodes; width *= 2) {
+		lastNodePtr = &dummyNode;
+		currNodePtr = dummyNode.nextNodePtr;
+
+		while (currNodePtr != NULL) {
+			leftPtr = currNodePtr;
+			rightPtr = CutChain (leftPtr, width);
+			currNodePtr = CutChain (rightPtr, width);
+
+			lastNodePtr->nextNodePtr = MergeChains (leftPtr, rightPtr, &mergedTailPtr);
+			lastNodePtr = mergedTailPtr;
+		}
+	}
+
+	*tailPtrPtr = lastNodePtr;
+	return dummyNode.nextNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Function to sort a linked list in ascending order of data
+ * The nodes are relinked in place (bottom-up merge sort); no node is allocated, freed or copied, unless the list is
+ * compacted afterwards because it has become too fragmented (see SetAutoCompact).
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: list contains the same nodes in ascending order of data (equal data keeps its original order),
+ * listPtr->tailPtr is the last node. Cursors move back to the head.
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes log listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+void SortList (LinkedList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SortList (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->numNodes < 2) {
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_SORT);
+	listPtr->headPtr = SortChain (listPtr->headPtr, listPtr->numNodes, &(listPtr->tailPtr));
+	NoteRestructuring (listPtr);
+	LIST_STATS_TRAVERSED (listPtr, listPtr->numNodes);
+	CompactIfFragmented (listPtr);
+	LIST_STATS_END (listPtr);
+}
+
+// For one chunk of a list sorted by its own thread in SortListParallel
+struct sorttask {
+	ListNode *headPtr;
+	ListNode *tailPtr;
+	Length numNodes;
+};
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function run by each thread of SortListParallel, to sort one chunk of the list
+ * Input: argPtr (void *): pointer to the chunk (struct sorttask)
+ * Return value: NULL
+ * Time complexity: O(numNodes log numNodes) for the chunk
+ * Space complexity: O(1)
+ */
+static void *SortTask (void *argPtr) {
+	struct sorttask *taskPtr = (struct sorttask *) argPtr;
+
+	taskPtr->headPtr = SortChain (taskPtr->headPtr, taskPtr->numNodes, &(taskPtr->tailPtr));
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.3
+ * Function to sort a linked list in ascending order of data, using several threads
+ * The list is cut into numThreads chunks of about equal length, each chunk is sorted by its own thread,
+ * and the sorted chunks are then merged pairwise.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, numThreads (Length) (int): number of threads to use
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: as for SortList
+ * Assumption: listPtr != NULL. Short lists (and numThreads <= 1) are sorted by SortList on the calling thread.
+ * Time complexity: O((numNodes/numThreads) log numNodes + numNodes log numThreads)
+ * Space complexity: O(numThreads)
+ */
+void SortListParallel (LinkedList *listPtr, Length numThreads) {
+	struct sorttask *tasks;
+	pthread_t *threads;
+	bool *isThreadStarted;
+	ListNode *restPtr;
+	Length chunkSize;
+	Index i, step;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SortListParallel (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_SORT_PARALLEL);
+	// divided rather than multiplied, so that a large numThreads cannot overflow; every chunk then has nodes
+	if (numThreads <= 1 || listPtr->numNodes / PARALLEL_SORT_MIN_CHUNK < numThreads) {
+		SortList (listPtr);
+		LIST_STATS_END (listPtr);
+		return;
+	}
+
+	tasks = (struct sorttask *) malloc (numThreads * sizeof (struct sorttask));
+	threads = (pthread_t *) malloc (numThreads * sizeof (pthread_t));
+	isThreadStarted = (bool *) malloc (numThreads * sizeof (bool));
+	if (tasks == NULL || threads == NULL || isThreadStarted == NULL) {
+		free (tasks);
+		free (threads);
+		free (isThreadStarted);
+		SortList (listPtr);
+		LIST_STATS_END (listPtr);
+		return;
+	}
+
+	// cut the list into chunks; the last chunk takes the remainder
+	chunkSize = (listPtr->numNodes) / numThreads;
+	restPtr = listPtr->headPtr;
+	for (i = 0; i < numThreads; i++) {
+		tasks[i].headPtr = restPtr;
+		tasks[i].numNodes = (i < numThreads-1) ? chunkSize : (listPtr->numNodes) - chunkSize * (numThreads-1);
+		restPtr = CutChain (restPtr, tasks[i].numNodes);
+	}
+
+	// a chunk whose thread cannot be started is sorted on this thread
+	for (i = 0; i < numThreads; i++) {
+		isThreadStarted[i] = (pthread_create (&(threads[i]), NULL, SortTask, &(tasks[i])) == 0);
+		if (!isThreadStarted[i]) {
+			SortTask (&(tasks[i]));
+		}
+	}
+	for (i = 0; i < numThreads; i++) {
+		if (isThreadStarted[i]) {
+			pthread_join (threads[i], NULL);
+		}
+	}
+
+	// merge the sorted chunks pairwise: 0+1, 2+3, ..., then 0+2, 4+6, ...
+	for (step = 1; step < numThreads; step *= 2) {
+		for (i = 0; i + step < numThreads; i += 2*step) {
+			tasks[i].headPtr = MergeChains (tasks[i].headPtr, tasks[i+step].headPtr, &(tasks[i].tailPtr));
+		}
+	}
+
+	listPtr->headPtr = tasks[0].headPtr;
+	listPtr->tailPtr = tasks[0].tailPtr;
+	NoteRestructuring (listPtr);
+	LIST_STATS_TRAVERSED (listPtr, listPtr->numNodes);
+	CompactIfFragmented (listPtr);
+
+	free (tasks);
+	free (threads);
+	free (isThreadStarted);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to add data to a sorted linked list, keeping it sorted
+ * The walk stops at the first node with greater data; data not smaller than the tail is appended in O(1).
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int)
+ * Return value: none
+ * Pre-condition: list is sorted in ascending order of data (e.g. by SortList)
+ * Post-condition: a node containing data is inserted after all nodes with data <= data, and the list is still sorted
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of nodes with data <= data), O(1) if data >= data of the tail
+ * Space complexity: O(1)
+ */
+void AddDataInOrder (LinkedList *listPtr, Data data) {
+	ListNode *prevNodePtr, *currNodePtr, *newNodePtr;
+	Index position;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AddDataInOrder (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_ADD_DATA_IN_ORDER);
+	newNodePtr = NewNode (listPtr, data);
+	if (newNodePtr == NULL) {
+		LIST_STATS_END (listPtr);
+		return;
+	}
+
+	if (listPtr->headPtr == NULL || listPtr->tailPtr->data <= data) {
+		InsertNode (listPtr, listPtr->tailPtr, newNodePtr, listPtr->numNodes);
+		LIST_STATS_END (listPtr);
+		return;
+	}
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+	position = 0;
+
+	while (currNodePtr->data <= data) {
+		prevNodePtr = currNodePtr;
+		currNodePtr = currNodePtr->nextNodePtr;
+		position++;
+	}
+	LIST_STATS_TRAVERSED (listPtr, position);
+
+	InsertNode (listPtr, prevNodePtr, newNodePtr, position);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.4
+ * Function to merge a sorted linked list into another, by relinking the nodes
+ * Inputs: dstListPtr (LinkedList *): pointer to sorted linked list that receives the nodes,
+ * srcListPtr (LinkedList *): pointer to sorted linked list that gives up its nodes
+ * Return value: none
+ * Pre-condition: both lists are sorted in ascending order of data, and take their nodes from the same node pool (or none)
+ * Post-condition: dstListPtr holds all nodes of both lists in ascending order (on equal data, nodes that were in dstListPtr
+ * come first), srcListPtr is empty. No node is allocated, freed or copied, unless dstListPtr is compacted afterwards
+ * because it has become too fragmented (see SetAutoCompact).
+ * Assumptions: dstListPtr != NULL, srcListPtr != NULL, dstListPtr != srcListPtr
+ * Time complexity: O(dstListPtr->numNodes + srcListPtr->numNodes)
+ * Space complexity: O(1)
+ */
+void MergeSortedLists (LinkedList *dstListPtr, LinkedList *srcListPtr) {
+	if (dstListPtr == NULL) {
+		printf ("Error: Argument 1 of MergeSortedLists (LinkedList *dstListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (srcListPtr == NULL) {
+		printf ("Error: Argument 2 of MergeSortedLists (LinkedList *srcListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (dstListPtr == srcListPtr || srcListPtr->numNodes == 0) {
+		return;
+	}
+
+	if (dstListPtr->poolPtr != srcListPtr->poolPtr) {
+		printf ("Error: MergeSortedLists can only merge lists that share a node pool\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (dstListPtr, LIST_OPERATION_MERGE);
+	LIST_STATS_TRAVERSED (dstListPtr, dstListPtr->numNodes + srcListPtr->numNodes);
+	dstListPtr->headPtr = MergeChains (dstListPtr->headPtr, srcListPtr->headPtr, &(dstListPtr->tailPtr));
+	dstListPtr->numNodes += srcListPtr->numNodes;
+	NoteRestructuring (dstListPtr);
+	CompactIfFragmented (dstListPtr);
+
+	ForgetAllNodes (srcListPtr);
+	LIST_STATS_END (dstListPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to make an empty linked list take its nodes from a node pool
+ * Inputs: listPtr (LinkedList *): pointer to linked list, poolPtr (NodePool *): pointer to node pool
+ * (NULL => nodes are malloc-ed one at a time again)
+ * Return value: none
+ * Pre-condition: list contains zero nodes
+ * Post-condition: nodes added to the list from now on are taken from poolPtr, and removed nodes are returned to it
+ * Assumption: listPtr != NULL. Several lists may share one pool.
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void AttachPool (LinkedList *listPtr, NodePool *poolPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachPool (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->numNodes != 0) {
+		printf ("Error: AttachPool can only be used on an empty list\n");
+		return;
+	}
+
+	listPtr->poolPtr = poolPtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to attach a cursor to a linked list
+ * A cursor remembers a position in the list (the current node, the node before it, and its index), so that
+ * consecutive operations near the same position do not have to walk from the head each time. An attached cursor
+ * is kept valid by every operation on the list: it stays on its current node when other nodes are added or removed,
+ * moves on to the next node when its current node is removed, and moves back to the head when the list is
+ * reordered (ReverseList, RotateList) or emptied.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, cursorPtr (ListCursor *): cursor to attach
+ * Return value: none
+ * Post-condition: cursor is at the head (index 0; past the end if the list is empty)
+ * Assumptions: listPtr != NULL, cursorPtr != NULL, cursorPtr is not attached to a list. The cursor must be detached
+ * (DetachCursor) before its memory is reused.
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void AttachCursor (LinkedList *listPtr, ListCursor *cursorPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachCursor (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (cursorPtr == NULL) {
+		printf ("Error: Argument 2 of AttachCursor (ListCursor *cursorPtr) cannot be NULL\n");
+		return;
+	}
+
+	cursorPtr->listPtr = listPtr;
+	cursorPtr->prevNodePtr = NULL;
+	cursorPtr->currNodePtr = listPtr->headPtr;
+	cursorPtr->index = 0;
+	cursorPtr->isIndexKnown = TRUE;
+
+	cursorPtr->nextCursorPtr = listPtr->cursorListPtr;
+	listPtr->cursorListPtr = cursorPtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to detach a cursor from its linked list
+ * Input: cursorPtr (ListCursor *): cursor to detach
+ * Return value: none
+ * Post-condition: the list no longer updates the cursor, cursorPtr->listPtr = NULL
+ * Assumptions: cursorPtr != NULL
+ * Time complexity: O(number of cursors attached to the list)
+ * Space complexity: O(1)
+ */
+void DetachCursor (ListCursor *cursorPtr) {
+	ListCursor **linkPtrPtr;
+
+	if (cursorPtr == NULL) {
+		printf ("Error: Argument 1 of DetachCursor (ListCursor *cursorPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (cursorPtr->listPtr == NULL) {
+		return;
+	}
+
+	linkPtrPtr = &(cursorPtr->listPtr->cursorListPtr);
+	while (*linkPtrPtr != NULL && *linkPtrPtr != cursorPtr) {
+		linkPtrPtr = &((*linkPtrPtr)->nextCursorPtr);
+	}
+
+	if (*linkPtrPtr == cursorPtr) {
+		*linkPtrPtr = cursorPtr->nextCursorPtr;
+	}
+
+	cursorPtr->listPtr = NULL;
+	cursorPtr->nextCursorPtr = NULL;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to move a cursor on to the next node
+ * Input: cursorPtr (ListCursor *): attached cursor
+ * Return value: TRUE if the cursor moved, FALSE if it was already past the end of the list
+ * Assumptions: cursorPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool CursorAdvance (ListCursor *cursorPtr) {
+	if (cursorPtr == NULL || cursorPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of CursorAdvance (ListCursor *cursorPtr) must be an attached cursor\n");
+		return FALSE;
+	}
+
+	if (cursorPtr->currNodePtr == NULL) {
+		return FALSE;
+	}
+
+	cursorPtr->prevNodePtr = cursorPtr->currNodePtr;
+	cursorPtr->currNodePtr = cursorPtr->currNodePtr->nextNodePtr;
+	(cursorPtr->index)++;
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to find the index of the current node of a cursor
+ * If an AddNode or RemoveNode call in the middle of the list left the index unknown, it is recomputed.
+ * Input: cursorPtr (ListCursor *): attached cursor
+ * Return value: index (Index) (int) of the current node; (listPtr->numNodes) if the cursor is past the end
+ * Assumptions: cursorPtr != NULL
+ * Time complexity: O(1), O(index) if the index has to be recomputed
+ * Space complexity: O(1)
+ */
+Index CursorPosition (ListCursor *cursorPtr) {
+	ListNode *currNodePtr;
+	Index index = 0;
+
+	if (cursorPtr == NULL || cursorPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of CursorPosition (ListCursor *cursorPtr) must be an attached cursor\n");
+		return -1;
+	}
+
+	LIST_STATS_BEGIN (cursorPtr->listPtr, LIST_OPERATION_CURSOR_POSITION);
+	if (!(cursorPtr->isIndexKnown)) {
+		currNodePtr = cursorPtr->listPtr->headPtr;
+		while (currNodePtr != cursorPtr->currNodePtr) {
+			currNodePtr = currNodePtr->nextNodePtr;
+			index++;
+		}
+
+		cursorPtr->index = index;
+		cursorPtr->isIndexKnown = TRUE;
+		LIST_STATS_TRAVERSED (cursorPtr->listPtr, index);
+	}
+
+	LIST_STATS_END (cursorPtr->listPtr);
+	return cursorPtr->index;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to move a cursor to a certain position w.r.t. the head of its linked list
+ * Moving forward continues from where the cursor is; moving backward starts again from the head
+ * (or uses the positional index, if the list has one).
+ * Inputs: cursorPtr (ListCursor *): attached cursor, position (Index) (int): like an array index, from 0 (head)
+ * to (listPtr->numNodes) (past the end)
+ * Return value: none
+ * Post-condition: the current node of the cursor is the node at offset 'position' from the beginning
+ * Assumptions: cursorPtr != NULL, position is in range [0, (listPtr->numNodes)]
+ * Time complexity: O(position - current index) when moving forward, O(position) or O(log numNodes) otherwise
+ * Space complexity: O(1)
+ */
+void CursorSeek (ListCursor *cursorPtr, Index position) {
+	LinkedList *listPtr;
+
+	if (cursorPtr == NULL || cursorPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of CursorSeek (ListCursor *cursorPtr) must be an attached cursor\n");
+		return;
+	}
+
+	listPtr = cursorPtr->listPtr;
+
+	if (position < 0 || position > (listPtr->numNodes)) {
+		printf ("Error:	Argument 2 of CursorSeek (Index position) is out of bounds\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_CURSOR_SEEK);
+	if (!(cursorPtr->isIndexKnown) || position < cursorPtr->index) {
+		if (listPtr->indexPtr != NULL && position > 0) {
+			cursorPtr->prevNodePtr = PositionIndexFind (listPtr, position-1);
+			cursorPtr->currNodePtr = cursorPtr->prevNodePtr->nextNodePtr;
+			cursorPtr->index = position;
+			cursorPtr->isIndexKnown = TRUE;
+			LIST_STATS_END (listPtr);
+			return;
+		}
+
+		cursorPtr->prevNodePtr = NULL;
+		cursorPtr->currNodePtr = listPtr->headPtr;
+		cursorPtr->index = 0;
+		cursorPtr->isIndexKnown = TRUE;
+	}
+
+	LIST_STATS_TRAVERSED (listPtr, position - cursorPtr->index);
+	while (cursorPtr->index < position) {
+		cursorPtr->prevNodePtr = cursorPtr->currNodePtr;
+		cursorPtr->currNodePtr = cursorPtr->currNodePtr->nextNodePtr;
+		(cursorPtr->index)++;
+	}
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to add data just before the current node of a cursor
+ * The cursor stays on its current node, so repeated calls add data at consecutive positions.
+ * Inputs: cursorPtr (ListCursor *): attached cursor, data (Data) (int)
+ * Return value: none
+ * Post-condition: a node containing data is inserted at the index of the cursor; the index of the cursor
+ * is incremented by 1
+ * Assumptions: cursorPtr != NULL
+ * Time complexity: O(1), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+void CursorInsertBefore (ListCursor *cursorPtr, Data data) {
+	ListNode *newNodePtr;
+
+	if (cursorPtr == NULL || cursorPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of CursorInsertBefore (ListCursor *cursorPtr) must be an attached cursor\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (cursorPtr->listPtr, LIST_OPERATION_CURSOR_INSERT_BEFORE);
+	newNodePtr = NewNode (cursorPtr->listPtr, data);
+	if (newNodePtr == NULL) {
+		LIST_STATS_END (cursorPtr->listPtr);
+		return;
+	}
+
+	InsertNode (cursorPtr->listPtr, cursorPtr->prevNodePtr, newNodePtr,
+		(cursorPtr->isIndexKnown) ? cursorPtr->index : -1);
+	LIST_STATS_END (cursorPtr->listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to add data just after the current node of a cursor
+ * Inputs: cursorPtr (ListCursor *): attached cursor, data (Data) (int)
+ * Return value: none
+ * Post-condition: a node containing data is inserted after the current node; the cursor does not move
+ * Assumptions: cursorPtr != NULL, the cursor is not past the end of the list
+ * Time complexity: O(1), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+void CursorInsertAfter (ListCursor *cursorPtr, Data data) {
+	ListNode *newNodePtr;
+
+	if (cursorPtr == NULL || cursorPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of CursorInsertAfter (ListCursor *cursorPtr) must be an attached cursor\n");
+		return;
+	}
+
+	if (cursorPtr->currNodePtr == NULL) {
+		printf ("Error: CursorInsertAfter cannot be used past the end of the list\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (cursorPtr->listPtr, LIST_OPERATION_CURSOR_INSERT_AFTER);
+	newNodePtr = NewNode (cursorPtr->listPtr, data);
+	if (newNodePtr == NULL) {
+		LIST_STATS_END (cursorPtr->listPtr);
+		return;
+	}
+
+	InsertNode (cursorPtr->listPtr, cursorPtr->currNodePtr, newNodePtr,
+		(cursorPtr->isIndexKnown) ? (cursorPtr->index)+1 : -1);
+	LIST_STATS_END (cursorPtr->listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.1
+ * Function to remove (and free) the current node of a cursor
+ * Input: cursorPtr (ListCursor *): attached cursor
+ * Return value: none
+ * Post-condition: the current node is removed; the cursor is on the node after it, with the same index
+ * Assumptions: cursorPtr != NULL, the cursor is not past the end of the list
+ * Time complexity: O(1), O(log listPtr->numNodes) expected with a positional index
+ * Space complexity: O(1)
+ */
+void CursorRemove (ListCursor *cursorPtr) {
+	if (cursorPtr == NULL || cursorPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of CursorRemove (ListCursor *cursorPtr) must be an attached cursor\n");
+		return;
+	}
+
+	if (cursorPtr->currNodePtr == NULL) {
+		printf ("Error: CursorRemove cannot be used past the end of the list\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (cursorPtr->listPtr, LIST_OPERATION_CURSOR_REMOVE);
+	UnlinkNode (cursorPtr->listPtr, cursorPtr->prevNodePtr, cursorPtr->currNodePtr,
+		(cursorPtr->isIndexKnown) ? cursorPtr->index : -1);
+	LIST_STATS_END (cursorPtr->listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to compare the addresses of two nodes, for qsort
+ * Inputs: firstPtr (const void *), secondPtr (const void *): pointers to node pointers
+ * Return value: negative, zero or positive, as the first node is before, at or after the second one in memory
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static int CompareNodeAddresses (const void *firstPtr, const void *secondPtr) {
+	uintptr_t first = (uintptr_t) *((ListNode * const *) firstPtr), second = (uintptr_t) *((ListNode * const *) secondPtr);
+	return (first > second) - (first < second);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.1
+ * Helper function to compact a linked list that takes its nodes from a node pool
+ * The data is copied, in list order, into one contiguous block of the pool, and the old nodes are returned to the pool.
+ * A cursor stays at the same position, on the new node there.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: TRUE if the list was compacted, FALSE if the block could not be allocated (the list is then unchanged)
+ * Assumptions: listPtr != NULL, listPtr->poolPtr != NULL, listPtr->numNodes > 0, the newest slab of the pool has room
+ * for listPtr->numNodes nodes (so that no slab is allocated)
+ * Time complexity: O(listPtr->numNodes * (1 + number of cursors))
+ * Space complexity: O(1) (besides the new nodes)
+ */
+static bool CompactIntoBlock (LinkedList *listPtr) {
+	ListNode *blockPtr, *oldNodePtr;
+	ListCursor *cursorPtr;
+	Length numNodes = listPtr->numNodes;
+	Index i;
+
+	blockPtr = AllocateNodeBlock (listPtr->poolPtr, numNodes);
+	if (blockPtr == NULL) {
+		return FALSE;
+	}
+	LIST_STATS_ALLOCATED (listPtr, numNodes);
+
+	oldNodePtr = listPtr->headPtr;
+	for (i = 0; i < numNodes; i++) {
+		blockPtr[i].data = oldNodePtr->data;
+		blockPtr[i].nextNodePtr = &(blockPtr[i+1]);
+
+		// the block is a fresh allocation, so a cursor moved into it cannot match a later old node
+		for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+			if (cursorPtr->currNodePtr == oldNodePtr) {
+				cursorPtr->currNodePtr = &(blockPtr[i]);
+				cursorPtr->prevNodePtr = (i > 0) ? &(blockPtr[i-1]) : NULL;
+			}
+		}
+
+		oldNodePtr = oldNodePtr->nextNodePtr;
+	}
+	blockPtr[numNodes-1].nextNodePtr = NULL;
+
+	// cursors past the end follow the new tail
+	for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+		if (cursorPtr->currNodePtr == NULL) {
+			cursorPtr->prevNodePtr = &(blockPtr[numNodes-1]);
+		}
+	}
+
+	DeleteNodeChain (listPtr, listPtr->headPtr, listPtr->tailPtr, numNodes);
+	listPtr->headPtr = blockPtr;
+	listPtr->tailPtr = &(blockPtr[numNodes-1]);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.1
+ * Helper function to compact a linked list in place
+ * Used for malloc-ed nodes, since malloc gives no control over where new nodes go (freed nodes are handed back in any
+ * order), and for pooled nodes when the pool has no room for a block without a new slab. The list keeps its nodes:
+ * they are sorted by address, and the data is moved so that the i-th node in memory holds the i-th value.
+ * A cursor stays at the same position, on the node that is there now.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: TRUE if the list was compacted, FALSE if the scratch arrays could not be allocated (the list is then
+ * unchanged)
+ * Assumptions: listPtr != NULL, listPtr->numNodes > 0
+ * Time complexity: O(listPtr->numNodes * (log listPtr->numNodes + number of cursors))
+ * Space complexity: O(listPtr->numNodes)
+ */
+static bool CompactByAddress (LinkedList *listPtr) {
+	ListNode **nodes, *currNodePtr;
+	ListCursor *cursorPtr;
+	Data *dataArray;
+	Length numNodes = listPtr->numNodes;
+	Index i;
+
+	nodes = (ListNode **) malloc (numNodes * sizeof (ListNode *));
+	dataArray = (Data *) malloc (numNodes * sizeof (Data));
+	if (nodes == NULL || dataArray == NULL) {
+		printf ("Error: CompactList could not allocate scratch space for %d nodes\n", numNodes);
+		free (nodes);
+		free (dataArray);
+		return FALSE;
+	}
+
+	// the positions of the cursors are recorded on the way, for the nodes to be looked up again after sorting
+	currNodePtr = listPtr->headPtr;
+	for (i = 0; i < numNodes; i++) {
+		nodes[i] = currNodePtr;
+		dataArray[i] = currNodePtr->data;
+
+		for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+			if (cursorPtr->currNodePtr == currNodePtr) {
+				cursorPtr->index = i;
+				cursorPtr->isIndexKnown = TRUE;
+			}
+		}
+
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+
+	qsort (nodes, numNodes, sizeof (ListNode *), CompareNodeAddresses);
+
+	for (i = 0; i < numNodes-1; i++) {
+		nodes[i]->data = dataArray[i];
+		nodes[i]->nextNodePtr = nodes[i+1];
+	}
+	nodes[numNodes-1]->data = dataArray[numNodes-1];
+	nodes[numNodes-1]->nextNodePtr = NULL;
+
+	for (cursorPtr = listPtr->cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+		if (cursorPtr->currNodePtr == NULL) {
+			cursorPtr->index = numNodes;
+			cursorPtr->isIndexKnown = TRUE;
+		}
+		cursorPtr->currNodePtr = (cursorPtr->index < numNodes) ? nodes[cursorPtr->index] : NULL;
+		cursorPtr->prevNodePtr = (cursorPtr->index > 0) ? nodes[(cursorPtr->index)-1] : NULL;
+	}
+
+	listPtr->headPtr = nodes[0];
+	listPtr->tailPtr = nodes[numNodes-1];
+
+	free (nodes);
+	free (dataArray);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.2
+ * Function to lay the nodes of a linked list out in memory in list order
+ * After many insertions, removals and rotations (or a sort), consecutive nodes can be far apart in memory, so that
+ * every step of a walk is a cache miss. With a node pool attached whose newest slab has room for the whole list, the
+ * data is copied in list order into one contiguous block of the pool, and the old nodes are returned to the pool.
+ * Otherwise the list keeps its nodes, relinked in address order, with the data moved to match: a new slab for each
+ * compaction would grow the pool by a whole list every time, as the old nodes it frees are scattered.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: list holds the same data in the same order, with consecutive nodes in increasing order in memory.
+ * Cursors stay at the same positions. If memory runs out, the list is unchanged.
+ * Assumptions: listPtr != NULL, no pointers to the nodes of the list are kept outside it (other than by cursors)
+ * Time complexity: O(listPtr->numNodes * (1 + number of cursors)) into a block of the pool,
+ * O(listPtr->numNodes * (log listPtr->numNodes + number of cursors)) otherwise
+ * Space complexity: O(1) (besides the new nodes) into a block of the pool, O(listPtr->numNodes) otherwise
+ */
+void CompactList (LinkedList *listPtr) {
+	bool isCompacted;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of CompactList (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->numNodes == 0) {
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_COMPACT);
+	if (listPtr->poolPtr != NULL && listPtr->poolPtr->numUnusedInSlab >= listPtr->numNodes) {
+		isCompacted = CompactIntoBlock (listPtr);
+	}
+	else {
+		isCompacted = CompactByAddress (listPtr);
+	}
+
+	if (isCompacted && listPtr->indexPtr != NULL) {
+		InvalidatePositionIndex (listPtr);
+	}
+	if (isCompacted && listPtr->valueIndexPtr != NULL) {
+		InvalidateValueIndex (listPtr);
+	}
+	LIST_STATS_TRAVERSED (listPtr, listPtr->numNodes);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to measure how far the nodes of a linked list are from list order in memory
+ * A link from a node to the next is counted as far if the next node starts more than COMPACT_NEAR_BYTES away (in
+ * either direction, since walking a list laid out backwards is just as cache friendly).
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: fraction of the links of the list that are far, in range [0, 1]: 0 just after CompactList,
+ * close to 1 for nodes scattered over the heap; 0 for lists with fewer than 2 nodes
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+double ListFragmentation (LinkedList *listPtr) {
+	ListNode *currNodePtr, *nextNodePtr;
+	Length numFarLinks = 0;
+	intptr_t distance;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ListFragmentation (LinkedList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	if (listPtr->numNodes < 2) {
+		return 0;
+	}
+
+	currNodePtr = listPtr->headPtr;
+	while ((nextNodePtr = currNodePtr->nextNodePtr) != NULL) {
+		distance = (intptr_t) nextNodePtr - (intptr_t) currNodePtr;
+		if (distance > COMPACT_NEAR_BYTES || distance < -COMPACT_NEAR_BYTES) {
+			numFarLinks++;
+		}
+		currNodePtr = nextNodePtr;
+	}
+
+	return (double) numFarLinks / ((listPtr->numNodes)-1);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to make a linked list compact itself when it becomes too fragmented
+ * The operations that walk or reorder the whole list anyway (RemoveData, RemoveIf, RemoveDataSet, SortList,
+ * SortListParallel, MergeSortedLists) measure ListFragmentation when they are done, and call CompactList if it is
+ * above maxFragmentation. The check costs one more walk of the list; other operations are not affected.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, maxFragmentation (double): in range [0, 1)
+ * (0 => never compact automatically, the default)
+ * Return value: none
+ * Post-condition: listPtr->maxFragmentation = maxFragmentation
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void SetAutoCompact (LinkedList *listPtr, double maxFragmentation) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SetAutoCompact (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (maxFragmentation < 0 || maxFragmentation >= 1) {
+		printf ("Error: Argument 2 of SetAutoCompact (double maxFragmentation) must be in range [0, 1)\n");
+		return;
+	}
+
+	listPtr->maxFragmentation = maxFragmentation;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to find a node holding given data in a linked list, and the node before it
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int),
+ * prevNodePtrPtr (ListNode **): receives the node before the node found (NULL => head; may be NULL if not wanted),
+ * so that the node can be passed on to RemoveNode
+ * Return value: pointer to the first node holding data, NULL if there is none. With a value index, a node holding data
+ * (not necessarily the first).
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: the list is unchanged
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(position of the node found), O(1) expected with a value index
+ * Space complexity: O(1)
+ */
+ListNode *FindData (LinkedList *listPtr, Data data, ListNode **prevNodePtrPtr) {
+	ListNode *prevNodePtr = NULL, *currNodePtr;
+	Length numNodesVisited = 0;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of FindData (LinkedList *listPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_FIND_DATA);
+	if (listPtr->valueIndexPtr != NULL) {
+		currNodePtr = ValueIndexFind (listPtr, data, &prevNodePtr);
+	}
+	else {
+		currNodePtr = listPtr->headPtr;
+		while (currNodePtr != NULL && currNodePtr->data != data) {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+			numNodesVisited++;
+		}
+	}
+
+	if (prevNodePtrPtr != NULL) {
+		*prevNodePtrPtr = prevNodePtr;
+	}
+	LIST_STATS_TRAVERSED (listPtr, numNodesVisited);
+	LIST_STATS_END (listPtr);
+
+	return currNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to check whether a linked list holds given data
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int)
+ * Return value: TRUE if some node of the list holds data, FALSE otherwise
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: the list is unchanged
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes), O(1) expected with a value index
+ * Space complexity: O(1)
+ */
+bool ContainsData (LinkedList *listPtr, Data data) {
+	bool isFound;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ContainsData (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_CONTAINS_DATA);
+	isFound = (FindData (listPtr, data, NULL) != NULL);
+	LIST_STATS_END (listPtr);
+
+	return isFound;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to count the nodes of a linked list holding given data
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int)
+ * Return value: number of nodes holding data (Length) (int)
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: the list is unchanged
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes), O(1) expected with a value index
+ * Space complexity: O(1)
+ */
+Length CountData (LinkedList *listPtr, Data data) {
+	ListNode *currNodePtr;
+	Length numNodesFound = 0;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of CountData (LinkedList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_COUNT_DATA);
+	if (listPtr->valueIndexPtr != NULL) {
+		numNodesFound = ValueIndexCount (listPtr, data);
+	}
+	else {
+		for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+			if (currNodePtr->data == data) {
+				numNodesFound++;
+			}
+		}
+		LIST_STATS_TRAVERSED (listPtr, listPtr->numNodes);
+	}
+	LIST_STATS_END (listPtr);
+
+	return numNodesFound;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to move a run of nodes from one linked list into another, by relinking them
+ * Inputs: dstListPtr (LinkedList *): pointer to linked list receiving the nodes, dstPrevNodePtr (ListNode *): node of
+ * dstListPtr after which they go (NULL => at the head), dstPosition (Index) (int): position the first node will have
+ * in dstListPtr (-1 => not known), srcListPtr (LinkedList *): pointer to linked list giving up the nodes,
+ * srcPrevNodePtr (ListNode *): node of srcListPtr before them (NULL => head), firstNodePtr (ListNode *),
+ * lastNodePtr (ListNode *): first and last node moved, numNodes (Length) (int): number of nodes moved,
+ * srcPosition (Index) (int): position the first node had in srcListPtr (-1 => not known)
+ * Return value: none
+ * Post-condition: both lists, and the structures attached to them, are consistent again
+ * Assumptions: dstListPtr != srcListPtr, both take their nodes from the same node pool (or none), numNodes >= 1
+ * Time complexity: O(number of cursors), plus O(numNodes) expected with a value index on either list (see
+ * NoteRangeRemoval for cursors of srcListPtr at unknown positions)
+ * Space complexity: O(1)
+ */
+static void MoveNodes (LinkedList *dstListPtr, ListNode *dstPrevNodePtr, Index dstPosition, LinkedList *srcListPtr,
+	ListNode *srcPrevNodePtr, ListNode *firstNodePtr, ListNode *lastNodePtr, Length numNodes, Index srcPosition) {
+	ListNode *nextNodePtr = lastNodePtr->nextNodePtr;
+
+	// all nodes of the source list are moved
+	if (numNodes == srcListPtr->numNodes) {
+		ForgetAllNodes (srcListPtr);
+	}
+	else {
+		NoteRangeRemoval (srcListPtr, srcPrevNodePtr, firstNodePtr, lastNodePtr, numNodes, srcPosition);
+		if (srcPrevNodePtr == NULL) {
+			srcListPtr->headPtr = nextNodePtr;
+		}
+		else {
+			srcPrevNodePtr->nextNodePtr = nextNodePtr;
+		}
+		if (nextNodePtr == NULL) {
+			srcListPtr->tailPtr = srcPrevNodePtr;
+		}
+		srcListPtr->numNodes -= numNodes;
+	}
+
+	if (dstPrevNodePtr == NULL) {
+		lastNodePtr->nextNodePtr = dstListPtr->headPtr;
+		dstListPtr->headPtr = firstNodePtr;
+	}
+	else {
+		lastNodePtr->nextNodePtr = dstPrevNodePtr->nextNodePtr;
+		dstPrevNodePtr->nextNodePtr = firstNodePtr;
+	}
+	if (dstPrevNodePtr == dstListPtr->tailPtr) {
+		dstListPtr->tailPtr = lastNodePtr;
+	}
+	dstListPtr->numNodes += numNodes;
+	NoteInsertion (dstListPtr, dstPrevNodePtr, firstNodePtr, lastNodePtr, numNodes, dstPosition);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to move all nodes of a linked list to the end of another, by relinking them
+ * Inputs: dstListPtr (LinkedList *): pointer to linked list that receives the nodes,
+ * srcListPtr (LinkedList *): pointer to linked list that gives up its nodes
+ * Return value: none
+ * Pre-condition: both lists take their nodes from the same node pool (or none)
+ * Post-condition: dstListPtr holds its own nodes followed by those of srcListPtr, srcListPtr is empty. No node is
+ * allocated, freed or copied. The fragmentation of dstListPtr is not checked (see SetAutoCompact), since that takes
+ * a walk of the list.
+ * Assumptions: dstListPtr != NULL, srcListPtr != NULL
+ * Time complexity: O(1) (plus O(number of cursors) of both lists, and O(srcListPtr->numNodes) expected with a value
+ * index on dstListPtr)
+ * Space complexity: O(1)
+ */
+void ConcatLists (LinkedList *dstListPtr, LinkedList *srcListPtr) {
+	if (dstListPtr == NULL) {
+		printf ("Error: Argument 1 of ConcatLists (LinkedList *dstListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (srcListPtr == NULL) {
+		printf ("Error: Argument 2 of ConcatLists (LinkedList *srcListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (dstListPtr == srcListPtr || srcListPtr->numNodes == 0) {
+		return;
+	}
+
+	if (dstListPtr->poolPtr != srcListPtr->poolPtr) {
+		printf ("Error: ConcatLists can only join lists that share a node pool\n");
+		return;
+	}
+
+	LIST_STATS_BEGIN (dstListPtr, LIST_OPERATION_CONCAT);
+	MoveNodes (dstListPtr, dstListPtr->tailPtr, dstListPtr->numNodes, srcListPtr, NULL, srcListPtr->headPtr,
+		srcListPtr->tailPtr, srcListPtr->numNodes, 0);
+	LIST_STATS_END (dstListPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to split a linked list in two at a given position, by relinking the nodes
+ * Inputs: listPtr (LinkedList *): pointer to linked list, position (Index) (int): position of the first node to move,
+ * outListPtr (LinkedList *): pointer to linked list that receives the nodes from position onwards, at its end
+ * Return value: none
+ * Pre-condition: say list is (n_0) -> ... (n_(numNodes-1))->NULL; both lists take their nodes from the same node pool
+ * (or none)
+ * Post-condition: list is (n_0) -> ... (n_(position-1))->NULL, and (n_position) -> ... (n_(numNodes-1)) are added at
+ * the end of outListPtr. No node is allocated, freed or copied. Cursors on the moved nodes move to the end of listPtr.
+ * Assumptions: listPtr != NULL, outListPtr != NULL, listPtr != outListPtr, 0 <= position <= listPtr->numNodes
+ * Time complexity: O(position), O(log listPtr->numNodes) expected with a positional index (plus as for ConcatLists)
+ * Space complexity: O(1)
+ */
+void SplitList (LinkedList *listPtr, Index position, LinkedList *outListPtr) {
+	ListNode *prevNodePtr, *currNodePtr;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SplitList (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > listPtr->numNodes) {
+		printf ("Error: Argument 2 of SplitList (Index position) is not a position in the list\n");
+		return;
+	}
+
+	if (outListPtr == NULL) {
+		printf ("Error: Argument 3 of SplitList (LinkedList *outListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (outListPtr == listPtr) {
+		printf ("Error: SplitList cannot split a list into itself\n");
+		return;
+	}
+
+	if (listPtr->poolPtr != outListPtr->poolPtr) {
+		printf ("Error: SplitList can only move nodes between lists that share a node pool\n");
+		return;
+	}
+
+	if (position == listPtr->numNodes) {
+		return;
+	}
+
+	LIST_STATS_BEGIN (listPtr, LIST_OPERATION_SPLIT);
+	if (position == 0) {
+		prevNodePtr = NULL;
+		currNodePtr = listPtr->headPtr;
+	}
+	else if (listPtr->indexPtr != NULL) {
+		prevNodePtr = PositionIndexFind (listPtr, position-1);
+		currNodePtr = prevNodePtr->nextNodePtr;
+	}
+	else {
+		prevNodePtr = NULL;
+		currNodePtr = listPtr->headPtr;
+		for (i = 0; i < position; i++) {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+		LIST_STATS_TRAVERSED (listPtr, position);
+	}
+
+	MoveNodes (outListPtr, outListPtr->tailPtr, outListPtr->numNodes, listPtr, prevNodePtr, currNodePtr,
+		listPtr->tailPtr, (listPtr->numNodes)-position, position);
+	LIST_STATS_END (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to move a run of consecutive nodes from one linked list into another, by relinking them
+ * Inputs: dstListPtr (LinkedList *): pointer to linked list that receives the nodes, dstPrevNodePtr (ListNode *): node
+ * of dstListPtr after which they go (NULL => at the head), srcListPtr (LinkedList *): pointer to linked list that gives
+ * them up, srcPrevNodePtr (ListNode *): node of srcListPtr just before them (NULL => they start at the head),
+ * numNodes (Length) (int): number of nodes to move
+ * Return value: none
+ * Pre-condition: both lists take their nodes from the same node pool (or none)
+ * Post-condition: the numNodes nodes after srcPrevNodePtr are unlinked from srcListPtr and linked into dstListPtr after
+ * dstPrevNodePtr, in the same order. No node is allocated, freed or copied. Cursors on the moved nodes move on to the
+ * node after them in srcListPtr; other cursors stay on their nodes.
+ * Assumptions: dstListPtr != NULL, srcListPtr != NULL, dstListPtr != srcListPtr, dstPrevNodePtr is a node of
+ * dstListPtr (or NULL), srcPrevNodePtr is a node of srcListPtr (or NULL) followed by at least numNodes nodes
+ * Time complexity: O(numNodes) to find the last node moved (plus as for ConcatLists)
+ * Space complexity: O(1)
+ */
+void SpliceRange (LinkedList *dstListPtr, ListNode *dstPrevNodePtr, LinkedList *srcListPtr, ListNode *srcPrevNodePtr,
+	Length numNodes) {
+	ListNode *firstNodePtr, *lastNodePtr;
+	Index dstPosition, i;
+
+	if (dstListPtr == NULL) {
+		printf ("Error: Argument 1 of SpliceRange (LinkedList *dstListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (srcListPtr == NULL) {
+		printf ("Error: Argument 3 of SpliceRange (LinkedList *srcListPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (dstListPtr == srcListPtr) {
+		printf ("Error: SpliceRange can only move nodes between two different lists\n");
+		return;
+	}
+
+	if (dstListPtr->poolPtr != srcListPtr->poolPtr) {
+		printf ("Error: SpliceRange can only move nodes between lists that share a node pool\n");
+		return;
+	}
+
+	if (numNodes < 0) {
+		printf ("Error: Argument 5 of SpliceRange (Length numNodes) cannot be negative\n");
+		return;
+	}
+
+	if (numNodes == 0) {
+		return;
+	}
+
+	LIST_STATS_BEGIN (dstListPtr, LIST_OPERATION_SPLICE);
+	firstNodePtr = (srcPrevNodePtr == NULL) ? srcListPtr->headPtr : srcPrevNodePtr->nextNodePtr;
+	lastNodePtr = firstNodePtr;
+	for (i = 1; i < numNodes && lastNodePtr != NULL; i++) {
+		lastNodePtr = lastNodePtr->nextNodePtr;
+	}
+	LIST_STATS_TRAVERSED (dstListPtr, numNodes);
+
+	if (lastNodePtr == NULL) {
+		printf ("Error: Argument 5 of SpliceRange (Length numNodes) is more than the nodes after srcPrevNodePtr\n");
+		LIST_STATS_END (dstListPtr);
+		return;
+	}
+
+	// the position of the nodes in dstListPtr is known at either end of it
+	if (dstPrevNodePtr == NULL) {
+		dstPosition = 0;
+	}
+	else if (dstPrevNodePtr == dstListPtr->tailPtr) {
+		dstPosition = dstListPtr->numNodes;
+	}
+	else {
+		dstPosition = -1;
+	}
+
+	MoveNodes (dstListPtr, dstPrevNodePtr, dstPosition, srcListPtr, srcPrevNodePtr, firstNodePtr, lastNodePtr, numNodes,
+		(srcPrevNodePtr == NULL) ? 0 : -1);
+	LIST_STATS_END (dstListPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to make a linked list recycle its nodes through a node cache
+ * Unlike a node pool, a node cache hands out malloc-ed nodes, so it can be attached to a list that already has nodes,
+ * and lists with and without it can exchange nodes. Lists used by different threads can share one cache: nodes freed
+ * on one thread are then reused by another, in batches, without going through malloc and free.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, cachePtr (NodeCache *): pointer to node cache
+ * (NULL => nodes are malloc-ed and free-d one at a time again)
+ * Return value: none
+ * Post-condition: nodes added to the list from now on are taken from cachePtr, and removed nodes are returned to it
+ * Assumption: listPtr != NULL, the list does not take its nodes from a node pool
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void AttachNodeCache (LinkedList *listPtr, NodeCache *cachePtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachNodeCache (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->poolPtr != NULL) {
+		printf ("Error: AttachNodeCache cannot be used on a list that takes its nodes from a node pool\n");
+		return;
+	}
+
+	listPtr->cachePtr = cachePtr;
 }
 
 /*
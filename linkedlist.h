@@ -4,10 +4,17 @@
  *
  * The following types are declared in this file:
  * a) Data: the type of the data in a linked list node. Another name for int.
- * b) bool: a Boolean flag (TRUE/FALSE). Another name for int.
+ * b) bool: a Boolean flag (TRUE/FALSE). Another name for _Bool (in C++, the built-in bool, which has the same size).
  * c) struct listnode (ListNode): a structure representing one list node.
  * d) struct linkedlist (LinkedList): a structure representing a linked list. Wrapper around ListNode;
- *    contains a head pointer, a tail pointer, and information about the length of the list
+ *    contains a head pointer, a tail pointer, information about the length of the list,
+ *    the node pool its nodes are taken from (NULL => nodes are malloc-ed one at a time),
+ *    the node cache its malloc-ed nodes are recycled through (NULL => none, see "nodecache.h"),
+ *    its positional index (NULL => none, see "positionindex.h"), its value index (NULL => none, see "valueindex.h"),
+ *    the cursors attached to it, the fragmentation above which it compacts itself (0 => never, see SetAutoCompact),
+ *    and, with LIST_STATS 1, the statistics it records into (NULL => none, see "liststats.h")
+ * e) struct listcursor (ListCursor): a structure representing a position in a linked list. Contains the current node,
+ *    the node before it and its index, and is kept valid by the operations on the list it is attached to
  *
  * The following functions are declared in this file:
  *
@@ -34,6 +41,55 @@
  * Related to permutation of a linked list
  * m) ReverseList: Function to reverse a linked list
  * n) RotateList: Function to rotate a linked list by a given amount
+ *
+ * Related to node allocation
+ * o) AttachPool: Function to make an empty linked list take its nodes from a node pool (see "nodepool.h")
+ *
+ * Related to bulk transfer of data between arrays and a linked list
+ * p) AddArrayAtEnd: Function to add the elements of an array at the end of a linked list
+ * q) AddArrayAtBeginning: Function to add the elements of an array at the beginning of a linked list
+ * r) ListToArray: Function to copy the contents of a linked list into an array
+ *
+ * Related to positional access
+ * s) GetNodeAtPosition: Function to find the node at a certain position w.r.t. the head of a linked list
+ *
+ * Related to cursors
+ * t) AttachCursor: Function to attach a cursor to a linked list
+ * u) DetachCursor: Function to detach a cursor from its linked list
+ * v) CursorAdvance: Function to move a cursor on to the next node
+ * w) CursorPosition: Function to find the index of the current node of a cursor
+ * x) CursorSeek: Function to move a cursor to a certain position w.r.t. the head of its linked list
+ * y) CursorInsertBefore: Function to add data just before the current node of a cursor
+ * z) CursorInsertAfter: Function to add data just after the current node of a cursor
+ * aa) CursorRemove: Function to remove (and free) the current node of a cursor
+ *
+ * Related to removing many data values (nodes) in one pass
+ * ab) RemoveIf: Function to remove all data satisfying a predicate from the linked list
+ * ac) RemoveDataSet: Function to remove all occurrences of several data values from the linked list
+ *
+ * Related to sorting a linked list
+ * ad) SortList: Function to sort a linked list in ascending order of data
+ * ae) SortListParallel: Function to sort a linked list in ascending order of data, using several threads
+ * af) AddDataInOrder: Function to add data to a sorted linked list, keeping it sorted
+ * ag) MergeSortedLists: Function to merge a sorted linked list into another, by relinking the nodes
+ *
+ * Related to the layout of a linked list in memory
+ * ah) CompactList: Function to lay the nodes of a linked list out in memory in list order
+ * ai) ListFragmentation: Function to measure how far the nodes of a linked list are from list order in memory
+ * aj) SetAutoCompact: Function to make a linked list compact itself when it becomes too fragmented
+ *
+ * Related to searching a linked list
+ * ak) FindData: Function to find a node holding given data in a linked list, and the node before it
+ * al) ContainsData: Function to check whether a linked list holds given data
+ * am) CountData: Function to count the nodes of a linked list holding given data
+ *
+ * Related to moving nodes between linked lists
+ * an) ConcatLists: Function to move all nodes of a linked list to the end of another, by relinking them
+ * ao) SplitList: Function to split a linked list in two at a given position, by relinking the nodes
+ * ap) SpliceRange: Function to move a run of consecutive nodes from one linked list into another, by relinking them
+ *
+ * Related to node caches
+ * aq) AttachNodeCache: Function to make a linked list recycle its nodes through a node cache (see "nodecache.h")
  * 
  * All of the above functions are defined in "Linked List/linkedlist.c". For more details, see there.
  */
@@ -43,11 +99,28 @@
 
 	#include "basictypes.h"
 
+	// Condition to record operation statistics (see "liststats.h"). Changes struct linkedlist, so must be the same for every file.
+	#ifndef LIST_STATS
+		#define LIST_STATS 0
+	#endif
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
 	// For linked list node data
 	typedef int Data;
 
-	// For Boolean flags
-	typedef int bool;
+	// For Boolean flags. _Bool rather than int, so that structures and functions look the same from C++ (see "linkedlist.hpp")
+	#if !defined (__cplusplus) && !defined (__bool_true_false_are_defined)
+		typedef _Bool bool;
+	#endif
+	#ifndef TRUE
+		#define TRUE 1
+	#endif
+	#ifndef FALSE
+		#define FALSE 0
+	#endif
 
 	// For one node in linked list
 	struct listnode {
@@ -56,11 +129,46 @@
 	};
 	typedef struct listnode ListNode;
 
+	// Node pool, declared in "nodepool.h"
+	struct nodepool;
+
+	// Node cache, declared in "nodecache.h"
+	struct nodecache;
+
+	// Positional index, declared in "positionindex.h"
+	struct positionindex;
+
+	// Value index, declared in "valueindex.h"
+	struct valueindex;
+
+	// Operation statistics, declared in "liststats.h"
+	struct liststats;
+
+	// For a position in a linked list
+	struct listcursor {
+		struct linkedlist *listPtr;
+		ListNode *prevNodePtr;
+		ListNode *currNodePtr;
+		Index index;
+		bool isIndexKnown;
+		struct listcursor *nextCursorPtr;
+	};
+	typedef struct listcursor ListCursor;
+
 	// Wrapper for linked list node
 	struct linkedlist {
 		ListNode *headPtr;
 		ListNode *tailPtr;
 		Length numNodes;
+		struct nodepool *poolPtr;
+		struct nodecache *cachePtr;
+		struct positionindex *indexPtr;
+		struct valueindex *valueIndexPtr;
+		ListCursor *cursorListPtr;
+		double maxFragmentation;
+		#if LIST_STATS
+			struct liststats *statsPtr;
+		#endif
 	};
 	typedef struct linkedlist LinkedList;
 
@@ -93,4 +201,58 @@
 	void ReverseList (LinkedList *listPtr);
 	void RotateList (LinkedList *listPtr, Index rotation);
 
+	// Related to node allocation
+	void AttachPool (LinkedList *listPtr, struct nodepool *poolPtr);
+
+	// Related to bulk transfer of data between arrays and a linked list
+	void AddArrayAtEnd (LinkedList *listPtr, const Data *dataArray, Length numData);
+	void AddArrayAtBeginning (LinkedList *listPtr, const Data *dataArray, Length numData);
+	Length ListToArray (LinkedList *listPtr, Data *dataArray, Length arrayLength);
+
+	// Related to positional access
+	ListNode *GetNodeAtPosition (LinkedList *listPtr, Index position);
+
+	// Related to cursors
+	void AttachCursor (LinkedList *listPtr, ListCursor *cursorPtr);
+	void DetachCursor (ListCursor *cursorPtr);
+	bool CursorAdvance (ListCursor *cursorPtr);
+	Index CursorPosition (ListCursor *cursorPtr);
+	void CursorSeek (ListCursor *cursorPtr, Index position);
+	void CursorInsertBefore (ListCursor *cursorPtr, Data data);
+	void CursorInsertAfter (ListCursor *cursorPtr, Data data);
+	void CursorRemove (ListCursor *cursorPtr);
+
+	// Related to removing many data values (nodes) in one pass
+	Length RemoveIf (LinkedList *listPtr, bool (*predicate) (Data data, void *contextPtr), void *contextPtr);
+	Length RemoveDataSet (LinkedList *listPtr, const Data *dataArray, Length numData);
+
+	// Related to sorting a linked list
+	void SortList (LinkedList *listPtr);
+	void SortListParallel (LinkedList *listPtr, Length numThreads);
+	void AddDataInOrder (LinkedList *listPtr, Data data);
+	void MergeSortedLists (LinkedList *dstListPtr, LinkedList *srcListPtr);
+
+	// Related to the layout of a linked list in memory
+	void CompactList (LinkedList *listPtr);
+	double ListFragmentation (LinkedList *listPtr);
+	void SetAutoCompact (LinkedList *listPtr, double maxFragmentation);
+
+	// Related to searching a linked list
+	ListNode *FindData (LinkedList *listPtr, Data data, ListNode **prevNodePtrPtr);
+	bool ContainsData (LinkedList *listPtr, Data data);
+	Length CountData (LinkedList *listPtr, Data data);
+
+	// Related to moving nodes between linked lists
+	void ConcatLists (LinkedList *dstListPtr, LinkedList *srcListPtr);
+	void SplitList (LinkedList *listPtr, Index position, LinkedList *outListPtr);
+	void SpliceRange (LinkedList *dstListPtr, ListNode *dstPrevNodePtr, LinkedList *srcListPtr, ListNode *srcPrevNodePtr,
+		Length numNodes);
+
+	// Related to node caches
+	void AttachNodeCache (LinkedList *listPtr, struct nodecache *cachePtr);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
 #endif
@@ -0,0 +1,266 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing a C++ class wrapping the linked list data structure of "linkedlist.h".
+ * The class owns its LinkedList: the nodes are freed by the destructor, the list can be moved but not copied,
+ * and forward iterators walk the nodes in place, so standard algorithms and range-for loops need no copy of the data.
+ * Every member calls the C function of the same purpose; the class adds no data of its own.
+ *
+ * The following types are declared in this file (in namespace ll; "linkedlist" is already taken by the C structure):
+ * a) List: a class owning one LinkedList
+ * b) List::iterator, List::const_iterator: forward iterators over the data of the list
+ *
+ * The following members of List are declared in this file:
+ *
+ * Related to construction and ownership
+ * a) List (), ~List (): create an empty list, and free all its nodes
+ * b) List (List &&), operator= (List &&): take over the nodes (and node pool, indices, cursors) of another list
+ * c) get: the underlying LinkedList, to pass to the C functions
+ *
+ * Related to iteration and access
+ * d) begin, end, cbegin, cend: iterators over the data
+ * e) size, empty, front, back
+ *
+ * Related to adding and removing data
+ * f) push_back, push_front, emplace_back, emplace_front: add data at the end or beginning
+ * g) pop_front, remove, remove_if, clear: remove data
+ * h) splice: move all nodes of another list to the end of this one
+ *
+ * Related to permutation
+ * i) reverse, sort, rotate
+ *
+ * Related to the layout in memory
+ * j) compact: lay the nodes out in memory in list order
+ *
+ * Related to searching
+ * k) contains, count: whether the list holds some data, and how many times
+ *
+ * Only this header is needed; the C functions are defined in "Linked List/linkedlist.c".
+ */
+
+#ifndef LINKEDLIST_HPP
+#define LINKEDLIST_HPP
+
+	#include <cstddef>
+	#include <iterator>
+	#include <memory>
+	#include <utility>
+	#include "linkedlist.h"
+	#include "positionindex.h"
+	#include "valueindex.h"
+
+	namespace ll {
+
+		// For a linked list owning its nodes
+		class List {
+		public:
+			// For iterating over the data of a list; Value is Data or const Data
+			template <typename Value>
+			class Iterator {
+			public:
+				typedef std::forward_iterator_tag iterator_category;
+				typedef Data value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef Value *pointer;
+				typedef Value &reference;
+
+				Iterator () : nodePtr (NULL) {}
+				explicit Iterator (ListNode *nodePtr) : nodePtr (nodePtr) {}
+
+				// an iterator converts to a const_iterator, not the other way round
+				operator Iterator<const Data> () const { return Iterator<const Data> (nodePtr); }
+
+				reference operator* () const { return nodePtr->data; }
+				pointer operator-> () const { return &(nodePtr->data); }
+				Iterator &operator++ () { nodePtr = nodePtr->nextNodePtr; return *this; }
+				Iterator operator++ (int) { Iterator oldIterator (*this); nodePtr = nodePtr->nextNodePtr; return oldIterator; }
+
+				// an iterator and a const_iterator compare either way round, as for the standard containers
+				template <typename OtherValue>
+				friend bool operator== (const Iterator &first, const Iterator<OtherValue> &second) {
+					return first.nodePtr == second.node ();
+				}
+				template <typename OtherValue>
+				friend bool operator!= (const Iterator &first, const Iterator<OtherValue> &second) {
+					return first.nodePtr != second.node ();
+				}
+
+				// the node the iterator is at (NULL at the end)
+				ListNode *node () const { return nodePtr; }
+
+			private:
+				ListNode *nodePtr;
+			};
+
+			typedef Iterator<Data> iterator;
+			typedef Iterator<const Data> const_iterator;
+			typedef Data value_type;
+			typedef Data &reference;
+			typedef const Data &const_reference;
+			typedef Length size_type;
+
+			/*
+			 * G V Vishwanath, 17th October 2026, v1.0
+			 * Constructor to create an empty list, optionally taking its nodes from a node pool (see AttachPool)
+			 * Time complexity: O(1)
+			 */
+			List () : list (InitialiseList ()) {}
+			explicit List (struct nodepool *poolPtr) : list (InitialiseList ()) { AttachPool (&list, poolPtr); }
+
+			/*
+			 * G V Vishwanath, 18th October 2026, v1.1
+			 * Destructor to free all nodes of the list (and its positional and value indices, if any)
+			 * Time complexity: O(size ())
+			 */
+			~List () {
+				Release ();
+			}
+
+			/*
+			 * G V Vishwanath, 17th October 2026, v1.0
+			 * Move constructor and move assignment: take over the nodes of another list, which is left empty
+			 * Cursors attached to the other list are moved over with its nodes.
+			 * Time complexity: O(number of cursors), plus O(size ()) for the nodes freed by assignment
+			 */
+			List (List &&other) : list (other.list) {
+				other.list = InitialiseList ();
+				AdoptCursors ();
+			}
+
+			List &operator= (List &&other) {
+				if (this != &other) {
+					Release ();
+					list = other.list;
+					other.list = InitialiseList ();
+					AdoptCursors ();
+				}
+				return *this;
+			}
+
+			List (const List &) = delete;
+			List &operator= (const List &) = delete;
+
+			// The underlying list, for the C functions
+			LinkedList *get () { return &list; }
+			const LinkedList *get () const { return &list; }
+
+			// Iterators over the data
+			iterator begin () { return iterator (list.headPtr); }
+			iterator end () { return iterator (); }
+			const_iterator begin () const { return const_iterator (list.headPtr); }
+			const_iterator end () const { return const_iterator (); }
+			const_iterator cbegin () const { return const_iterator (list.headPtr); }
+			const_iterator cend () const { return const_iterator (); }
+
+			// Size and ends of the list (front and back assume a non-empty list)
+			size_type size () const { return list.numNodes; }
+			bool empty () const { return list.numNodes == 0; }
+			reference front () { return list.headPtr->data; }
+			const_reference front () const { return list.headPtr->data; }
+			reference back () { return list.tailPtr->data; }
+			const_reference back () const { return list.tailPtr->data; }
+
+			// Adding data at the ends
+			void push_back (Data data) { AddDataAtEnd (&list, data); }
+			void push_front (Data data) { AddDataAtBeginning (&list, data); }
+
+			template <typename... Args>
+			reference emplace_back (Args &&... args) {
+				AddDataAtEnd (&list, Data (std::forward<Args> (args)...));
+				return back ();
+			}
+
+			template <typename... Args>
+			reference emplace_front (Args &&... args) {
+				AddDataAtBeginning (&list, Data (std::forward<Args> (args)...));
+				return front ();
+			}
+
+			// Removing data
+			void pop_front () { RemoveNode (&list, NULL, list.headPtr); }
+			void remove (Data data) { RemoveData (&list, data); }
+			void clear () { RemoveAllNodes (&list); }
+
+			/*
+			 * G V Vishwanath, 17th October 2026, v1.0
+			 * Function to remove all data satisfying a predicate, in one pass (see RemoveIf)
+			 * Input: predicate: callable taking Data and returning something convertible to bool
+			 * Return value: number of nodes removed
+			 * Time complexity: O(size ())
+			 */
+			template <typename Predicate>
+			Length remove_if (Predicate predicate) {
+				return RemoveIf (&list, &CallPredicate<Predicate>, &predicate);
+			}
+
+			/*
+			 * G V Vishwanath, 18th October 2026, v1.1
+			 * Function to move all nodes of another list to the end of this one
+			 * Lists sharing a node pool (or both without one) are joined by relinking (see ConcatLists); otherwise the
+			 * data is copied over and the nodes of other are freed.
+			 * Input: other (List &): list to take the data from; it is left empty
+			 * Time complexity: O(1) if the lists share a node pool, O(other.size ()) otherwise
+			 * Space complexity: O(1) if the lists share a node pool, O(other.size ()) otherwise
+			 */
+			void splice (List &other) {
+				std::unique_ptr<Data[]> dataArray;
+
+				if (this == &other || other.empty ()) {
+					return;
+				}
+
+				if (list.poolPtr == other.list.poolPtr) {
+					ConcatLists (&list, &(other.list));
+					return;
+				}
+
+				dataArray.reset (new Data[other.size ()]);
+				ListToArray (&(other.list), dataArray.get (), other.size ());
+				AddArrayAtEnd (&list, dataArray.get (), other.size ());
+				other.clear ();
+			}
+
+			// Permutation
+			void reverse () { ReverseList (&list); }
+			void sort () { SortList (&list); }
+			void rotate (Index rotation) { RotateList (&list, rotation); }
+
+			// Layout in memory
+			void compact () { CompactList (&list); }
+
+			// Searching (O(1) expected with a value index, see AttachValueIndex)
+			bool contains (Data data) { return ContainsData (&list, data); }
+			size_type count (Data data) { return CountData (&list, data); }
+
+		private:
+			LinkedList list;
+
+			// Frees the nodes and the indices
+			void Release () {
+				if (list.indexPtr != NULL) {
+					DetachPositionIndex (&list);
+				}
+				if (list.valueIndexPtr != NULL) {
+					DetachValueIndex (&list);
+				}
+				RemoveAllNodes (&list);
+			}
+
+			// Points the cursors moved over from another list at this one
+			void AdoptCursors () {
+				ListCursor *cursorPtr;
+
+				for (cursorPtr = list.cursorListPtr; cursorPtr != NULL; cursorPtr = cursorPtr->nextCursorPtr) {
+					cursorPtr->listPtr = &list;
+				}
+			}
+
+			// Calls a C++ predicate through the C interface of RemoveIf
+			template <typename Predicate>
+			static bool CallPredicate (Data data, void *contextPtr) {
+				return (*static_cast<Predicate *> (contextPtr)) (data);
+			}
+		};
+
+	}
+
+#endif
@@ -0,0 +1,833 @@
+#include <stdio.h>  		// For input/output
+#include <string.h> 		// For copying formatted text
+#include <errno.h>  		// For retrying interrupted writes
+#include <limits.h> 		// For the largest possible list length
+#include <unistd.h> 		// For writing to and reading from file descriptors
+#include <fcntl.h>  		// For opening snapshot files
+#include <sys/mman.h>		// For mapping snapshot files into memory
+#include <sys/stat.h>		// For the size of a snapshot file
+#include "../listio.h"		// For type declarations and function declarations related to writing out and reading in a linked list
+
+#define LIST_IO_MAX_NODE_CHARS 16	// Most characters one node can take: a separator, sign, 10 digits and " -> "
+
+// Two-digit groups "00" to "99", so that the formatter needs one division by 100 per two digits
+static const char digitPairs[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to format data as decimal text
+ * Inputs: data (Data) (int), textPtr (char *): where to write the text (not terminated with '\0')
+ * Return value: number of characters written (at most 11)
+ * Time complexity: O(number of digits)
+ * Space complexity: O(1)
+ */
+static size_t FormatData (Data data, char *textPtr) {
+	char digits[12], *digitPtr;
+	unsigned int value, pairIndex;
+	size_t numChars, numDigits;
+
+	// negating in unsigned arithmetic is well-defined for the most negative value too
+	value = (data < 0) ? 0u - (unsigned int) data : (unsigned int) data;
+	digitPtr = digits + sizeof (digits);
+
+	while (value >= 100) {
+		pairIndex = (value % 100) * 2;
+		value /= 100;
+		*--digitPtr = digitPairs[pairIndex + 1];
+		*--digitPtr = digitPairs[pairIndex];
+	}
+	if (value >= 10) {
+		*--digitPtr = digitPairs[value * 2 + 1];
+		*--digitPtr = digitPairs[value * 2];
+	}
+	else {
+		*--digitPtr = (char) ('0' + value);
+	}
+
+	numChars = 0;
+	if (data < 0) {
+		textPtr[numChars++] = '-';
+	}
+
+	numDigits = (size_t) (digits + sizeof (digits) - digitPtr);
+	memcpy (textPtr + numChars, digitPtr, numDigits);
+	return numChars + numDigits;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to format one node of a list in a given format
+ * Inputs: textPtr (char *): where to write the text (room for LIST_IO_MAX_NODE_CHARS characters), data (Data) (int),
+ * isFirst (bool): whether this is the first node of the list, format (ListFormat) (int)
+ * Return value: number of characters written
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static size_t FormatNode (char *textPtr, Data data, bool isFirst, ListFormat format) {
+	size_t numChars;
+
+	numChars = 0;
+	if (format == LIST_FORMAT_CSV && !isFirst) {
+		textPtr[numChars++] = ',';
+	}
+
+	numChars += FormatData (data, textPtr + numChars);
+
+	if (format == LIST_FORMAT_ARROW) {
+		memcpy (textPtr + numChars, " -> ", 4);
+		numChars += 4;
+	}
+	else if (format == LIST_FORMAT_LINES) {
+		textPtr[numChars++] = '\n';
+	}
+
+	return numChars;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to find the text that ends a list in a given format
+ * Input: format (ListFormat) (int)
+ * Return value: the ending text ("NULL\n" for arrows, "\n" for CSV, "" for lines)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static const char *ListEnding (ListFormat format) {
+	if (format == LIST_FORMAT_ARROW) {
+		return "NULL\n";
+	}
+	if (format == LIST_FORMAT_CSV) {
+		return "\n";
+	}
+	return "";
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to copy text into a buffer at a given offset, as far as it fits (leaving room for a '\0')
+ * Inputs: buffer (char *), capacity (size_t): size of buffer, offset (size_t): where the text goes,
+ * textPtr (const char *), numChars (size_t): length of text
+ * Return value: none
+ * Time complexity: O(numChars)
+ * Space complexity: O(1)
+ */
+static void CopyClipped (char *buffer, size_t capacity, size_t offset, const char *textPtr, size_t numChars) {
+	if (capacity == 0 || offset >= capacity - 1) {
+		return;
+	}
+
+	if (numChars > capacity - 1 - offset) {
+		numChars = capacity - 1 - offset;
+	}
+	memcpy (buffer + offset, textPtr, numChars);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to write a whole buffer to a file descriptor
+ * Writes that are cut short or interrupted by a signal are continued.
+ * Inputs: fileDescriptor (int), buffer (const char *), numChars (size_t)
+ * Return value: TRUE if everything was written, FALSE on error
+ * Time complexity: O(numChars)
+ * Space complexity: O(1)
+ */
+static bool WriteAll (int fileDescriptor, const char *buffer, size_t numChars) {
+	ssize_t numWritten;
+
+	while (numChars > 0) {
+		numWritten = write (fileDescriptor, buffer, numChars);
+		if (numWritten < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return FALSE;
+		}
+		buffer += numWritten;
+		numChars -= (size_t) numWritten;
+	}
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to write the contents of a linked list into a caller-supplied buffer
+ * Like snprintf, the text is cut short if it does not fit, and the full length is returned, so the caller can size
+ * the buffer and try again.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, buffer (char *): where to write the text,
+ * capacity (size_t): size of buffer in bytes (may be 0), format (ListFormat) (int): one of the LIST_FORMAT_ values
+ * Return value: length of the full text (not counting the '\0'), or 0 on error
+ * Post-condition: buffer holds as much of the text as fits in capacity-1 bytes, terminated with '\0' (if capacity > 0)
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(1)
+ */
+size_t SerialiseList (LinkedList *listPtr, char *buffer, size_t capacity, ListFormat format) {
+	ListNode *currNodePtr;
+	char nodeText[LIST_IO_MAX_NODE_CHARS];
+	const char *endingPtr;
+	size_t totalChars, numChars;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SerialiseList (LinkedList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	if (buffer == NULL && capacity > 0) {
+		printf ("Error: Argument 2 of SerialiseList (char *buffer) cannot be NULL\n");
+		return 0;
+	}
+
+	if (format != LIST_FORMAT_ARROW && format != LIST_FORMAT_CSV && format != LIST_FORMAT_LINES) {
+		printf ("Error: Argument 4 of SerialiseList (ListFormat format) is not a valid format\n");
+		return 0;
+	}
+
+	totalChars = 0;
+	for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+		// format straight into the buffer while a whole node still fits, through nodeText near the end
+		if (totalChars + LIST_IO_MAX_NODE_CHARS < capacity) {
+			totalChars += FormatNode (buffer + totalChars, currNodePtr->data, currNodePtr == listPtr->headPtr, format);
+		}
+		else {
+			numChars = FormatNode (nodeText, currNodePtr->data, currNodePtr == listPtr->headPtr, format);
+			CopyClipped (buffer, capacity, totalChars, nodeText, numChars);
+			totalChars += numChars;
+		}
+	}
+
+	endingPtr = ListEnding (format);
+	numChars = strlen (endingPtr);
+	CopyClipped (buffer, capacity, totalChars, endingPtr, numChars);
+	totalChars += numChars;
+
+	if (capacity > 0) {
+		buffer[(totalChars < capacity) ? totalChars : capacity - 1] = '\0';
+	}
+
+	return totalChars;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to write the contents of a linked list to a file descriptor
+ * The text is built in a LIST_IO_CHUNK_SIZE buffer on the stack and written one full chunk at a time with write(2),
+ * bypassing stdio. Pending stdio output on the same descriptor should be flushed first.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, fileDescriptor (int): descriptor open for writing,
+ * format (ListFormat) (int): one of the LIST_FORMAT_ values
+ * Return value: TRUE if everything was written, FALSE on error
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(LIST_IO_CHUNK_SIZE)
+ */
+bool SerialiseListToFile (LinkedList *listPtr, int fileDescriptor, ListFormat format) {
+	ListNode *currNodePtr;
+	char chunk[LIST_IO_CHUNK_SIZE];
+	const char *endingPtr;
+	size_t numUsed, numChars;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SerialiseListToFile (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (format != LIST_FORMAT_ARROW && format != LIST_FORMAT_CSV && format != LIST_FORMAT_LINES) {
+		printf ("Error: Argument 3 of SerialiseListToFile (ListFormat format) is not a valid format\n");
+		return FALSE;
+	}
+
+	numUsed = 0;
+	for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+		if (numUsed + LIST_IO_MAX_NODE_CHARS > LIST_IO_CHUNK_SIZE) {
+			if (!WriteAll (fileDescriptor, chunk, numUsed)) {
+				return FALSE;
+			}
+			numUsed = 0;
+		}
+		numUsed += FormatNode (chunk + numUsed, currNodePtr->data, currNodePtr == listPtr->headPtr, format);
+	}
+
+	endingPtr = ListEnding (format);
+	numChars = strlen (endingPtr);
+	if (numUsed + numChars > LIST_IO_CHUNK_SIZE) {
+		if (!WriteAll (fileDescriptor, chunk, numUsed)) {
+			return FALSE;
+		}
+		numUsed = 0;
+	}
+	memcpy (chunk + numUsed, endingPtr, numChars);
+	numUsed += numChars;
+
+	return WriteAll (fileDescriptor, chunk, numUsed);
+}
+
+// For the running checksum of a snapshot: two sums, the second weighting each value by its distance from the end
+struct checksum {
+	uint64_t sum;
+	uint64_t weightedSum;
+};
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to add an array of data to a running checksum
+ * Inputs: checksumPtr (struct checksum *): running checksum, dataArray (const Data *), numData (size_t)
+ * Return value: none
+ * Time complexity: O(numData)
+ * Space complexity: O(1)
+ */
+static void UpdateChecksum (struct checksum *checksumPtr, const Data *dataArray, size_t numData) {
+	uint64_t sum, weightedSum;
+	size_t i;
+
+	sum = checksumPtr->sum;
+	weightedSum = checksumPtr->weightedSum;
+	for (i = 0; i < numData; i++) {
+		sum += (uint32_t) dataArray[i];
+		weightedSum += sum;
+	}
+	checksumPtr->sum = sum;
+	checksumPtr->weightedSum = weightedSum;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to combine the two sums of a running checksum into the value stored in a snapshot
+ * Input: checksumPtr (struct checksum *): running checksum
+ * Return value: checksum value
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static uint64_t FinalChecksum (struct checksum *checksumPtr) {
+	return checksumPtr->sum ^ (checksumPtr->weightedSum * 0x9E3779B97F4A7C15ull);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to read into a whole buffer from a file descriptor
+ * Reads that are cut short or interrupted by a signal are continued.
+ * Inputs: fileDescriptor (int), buffer (void *), numBytes (size_t)
+ * Return value: number of bytes read: numBytes, or less at end of file or on error
+ * Time complexity: O(numBytes)
+ * Space complexity: O(1)
+ */
+static size_t ReadAll (int fileDescriptor, void *buffer, size_t numBytes) {
+	ssize_t numRead;
+	size_t totalRead;
+
+	totalRead = 0;
+	while (totalRead < numBytes) {
+		numRead = read (fileDescriptor, (char *) buffer + totalRead, numBytes - totalRead);
+		if (numRead < 0 && errno == EINTR) {
+			continue;
+		}
+		if (numRead <= 0) {
+			break;
+		}
+		totalRead += (size_t) numRead;
+	}
+
+	return totalRead;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to check that a snapshot header can be loaded into a list
+ * Inputs: headerPtr (const ListFileHeader *), listPtr (LinkedList *): list the data is to be added to,
+ * fileName (const char *): for error messages
+ * Return value: TRUE if the header is valid and the data fits in the list, FALSE otherwise (an error is printed)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static bool CheckHeader (const ListFileHeader *headerPtr, LinkedList *listPtr, const char *fileName) {
+	if (headerPtr->magic != LIST_FILE_MAGIC) {
+		printf ("Error: %s is not a list snapshot (or was saved with a different byte order)\n", fileName);
+		return FALSE;
+	}
+
+	if (headerPtr->version != LIST_FILE_VERSION) {
+		printf ("Error: %s has snapshot version %u, expected %u\n", fileName, (unsigned int) headerPtr->version, LIST_FILE_VERSION);
+		return FALSE;
+	}
+
+	if (headerPtr->dataType != LIST_FILE_TYPE_SIGNED_INTEGER || headerPtr->dataSize != sizeof (Data)) {
+		printf ("Error: %s holds data of a different type\n", fileName);
+		return FALSE;
+	}
+
+	if (headerPtr->numData > (uint64_t) (INT_MAX - listPtr->numNodes)) {
+		printf ("Error: %s holds more data than fits in the list\n", fileName);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to save the contents of a linked list to a binary snapshot file
+ * The data is gathered into a LIST_IO_CHUNK_SIZE buffer and written one chunk at a time; the header, with the checksum
+ * worked out along the way, is written last.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, fileName (const char *): file to create (or overwrite)
+ * Return value: TRUE if the snapshot was written, FALSE on error
+ * Post-condition: file holds a ListFileHeader followed by the data of the list, in list order
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(LIST_IO_CHUNK_SIZE)
+ */
+bool SaveList (LinkedList *listPtr, const char *fileName) {
+	ListFileHeader header;
+	struct checksum checksum;
+	ListNode *currNodePtr;
+	Data chunk[LIST_IO_CHUNK_SIZE / sizeof (Data)];
+	size_t numUsed;
+	int fileDescriptor;
+	bool isWritten;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of SaveList (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (fileName == NULL) {
+		printf ("Error: Argument 2 of SaveList (const char *fileName) cannot be NULL\n");
+		return FALSE;
+	}
+
+	fileDescriptor = open (fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fileDescriptor < 0) {
+		printf ("Error: could not create %s\n", fileName);
+		return FALSE;
+	}
+
+	header.magic = LIST_FILE_MAGIC;
+	header.version = LIST_FILE_VERSION;
+	header.dataType = LIST_FILE_TYPE_SIGNED_INTEGER;
+	header.dataSize = sizeof (Data);
+	header.numData = (uint64_t) listPtr->numNodes;
+	header.checksum = 0;
+	checksum.sum = 0;
+	checksum.weightedSum = 0;
+
+	// the header is written again at the end, with the checksum
+	isWritten = WriteAll (fileDescriptor, (const char *) &header, sizeof (header));
+
+	numUsed = 0;
+	for (currNodePtr = listPtr->headPtr; currNodePtr != NULL && isWritten; currNodePtr = currNodePtr->nextNodePtr) {
+		chunk[numUsed++] = currNodePtr->data;
+		if (numUsed == LIST_IO_CHUNK_SIZE / sizeof (Data)) {
+			UpdateChecksum (&checksum, chunk, numUsed);
+			isWritten = WriteAll (fileDescriptor, (const char *) chunk, numUsed * sizeof (Data));
+			numUsed = 0;
+		}
+	}
+
+	if (isWritten) {
+		UpdateChecksum (&checksum, chunk, numUsed);
+		isWritten = WriteAll (fileDescriptor, (const char *) chunk, numUsed * sizeof (Data));
+	}
+
+	if (isWritten) {
+		header.checksum = FinalChecksum (&checksum);
+		isWritten = (pwrite (fileDescriptor, &header, sizeof (header), 0) == (ssize_t) sizeof (header));
+	}
+
+	if (close (fileDescriptor) != 0) {
+		isWritten = FALSE;
+	}
+
+	if (!isWritten) {
+		printf ("Error: could not write %s\n", fileName);
+	}
+	return isWritten;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add the contents of a binary snapshot file at the end of a linked list, reading it in chunks
+ * Each chunk read is appended with one AddArrayAtEnd call; nothing is parsed.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, fileName (const char *): snapshot written by SaveList
+ * Return value: TRUE if the snapshot was loaded, FALSE on error
+ * Post-condition: the data of the snapshot is added at the end of the list, in order. On error (bad header, short file,
+ * checksum mismatch, allocation failure) the list is left as it was.
+ * Time complexity: O(number of data values in the file)
+ * Space complexity: O(LIST_IO_CHUNK_SIZE)
+ */
+bool LoadList (LinkedList *listPtr, const char *fileName) {
+	ListFileHeader header;
+	struct checksum checksum;
+	ListNode *oldTailPtr;
+	Data chunk[LIST_IO_CHUNK_SIZE / sizeof (Data)];
+	uint64_t numLeft;
+	size_t numWanted, numRead;
+	Length oldNumNodes;
+	int fileDescriptor;
+	bool isLoaded;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of LoadList (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (fileName == NULL) {
+		printf ("Error: Argument 2 of LoadList (const char *fileName) cannot be NULL\n");
+		return FALSE;
+	}
+
+	fileDescriptor = open (fileName, O_RDONLY);
+	if (fileDescriptor < 0) {
+		printf ("Error: could not open %s\n", fileName);
+		return FALSE;
+	}
+
+	if (ReadAll (fileDescriptor, &header, sizeof (header)) != sizeof (header)) {
+		printf ("Error: %s is not a list snapshot\n", fileName);
+		close (fileDescriptor);
+		return FALSE;
+	}
+
+	if (!CheckHeader (&header, listPtr, fileName)) {
+		close (fileDescriptor);
+		return FALSE;
+	}
+
+	oldTailPtr = listPtr->tailPtr;
+	oldNumNodes = listPtr->numNodes;
+	checksum.sum = 0;
+	checksum.weightedSum = 0;
+	isLoaded = TRUE;
+
+	for (numLeft = header.numData; numLeft > 0 && isLoaded; numLeft -= numRead) {
+		numWanted = (numLeft < LIST_IO_CHUNK_SIZE / sizeof (Data)) ? (size_t) numLeft : LIST_IO_CHUNK_SIZE / sizeof (Data);
+		numRead = ReadAll (fileDescriptor, chunk, numWanted * sizeof (Data)) / sizeof (Data);
+		if (numRead != numWanted) {
+			printf ("Error: %s is shorter than its header says\n", fileName);
+			isLoaded = FALSE;
+			break;
+		}
+
+		UpdateChecksum (&checksum, chunk, numRead);
+		AddArrayAtEnd (listPtr, chunk, (Length) numRead);
+		isLoaded = (listPtr->numNodes == oldNumNodes + (Length) (header.numData - numLeft + numRead));
+	}
+	close (fileDescriptor);
+
+	if (isLoaded && FinalChecksum (&checksum) != header.checksum) {
+		printf ("Error: checksum of %s does not match its data\n", fileName);
+		isLoaded = FALSE;
+	}
+
+	// take off whatever was added
+	if (!isLoaded) {
+		if (oldTailPtr == NULL) {
+			RemoveAllNodes (listPtr);
+		}
+		else {
+			while (oldTailPtr->nextNodePtr != NULL) {
+				RemoveNode (listPtr, oldTailPtr, oldTailPtr->nextNodePtr);
+			}
+		}
+	}
+
+	return isLoaded;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add the contents of a binary snapshot file at the end of a linked list, mapping it into memory
+ * The file is mapped read-only (and pre-faulted where the system allows), its checksum is checked in place, and the whole
+ * data array is appended with a single AddArrayAtEnd call. With a node pool attached to the list, the nodes are then
+ * carved out of one contiguous block, so loading costs about one page fault per page of the file plus one pass over the data.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, fileName (const char *): snapshot written by SaveList
+ * Return value: TRUE if the snapshot was loaded, FALSE on error
+ * Post-condition: as for LoadList. The file is unmapped again before returning; the list does not refer to it.
+ * Time complexity: O(number of data values in the file)
+ * Space complexity: O(1) (besides the mapping and the nodes)
+ */
+bool MapList (LinkedList *listPtr, const char *fileName) {
+	const ListFileHeader *headerPtr;
+	const Data *dataArray;
+	struct checksum checksum;
+	struct stat fileStatus;
+	void *mappingPtr;
+	Length oldNumNodes;
+	int fileDescriptor, mapFlags;
+	bool isLoaded;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of MapList (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (fileName == NULL) {
+		printf ("Error: Argument 2 of MapList (const char *fileName) cannot be NULL\n");
+		return FALSE;
+	}
+
+	fileDescriptor = open (fileName, O_RDONLY);
+	if (fileDescriptor < 0) {
+		printf ("Error: could not open %s\n", fileName);
+		return FALSE;
+	}
+
+	if (fstat (fileDescriptor, &fileStatus) != 0 || (size_t) fileStatus.st_size < sizeof (ListFileHeader)) {
+		printf ("Error: %s is not a list snapshot\n", fileName);
+		close (fileDescriptor);
+		return FALSE;
+	}
+
+	mapFlags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+	mapFlags |= MAP_POPULATE;
+#endif
+	mappingPtr = mmap (NULL, (size_t) fileStatus.st_size, PROT_READ, mapFlags, fileDescriptor, 0);
+	close (fileDescriptor);
+	if (mappingPtr == MAP_FAILED) {
+		printf ("Error: could not map %s\n", fileName);
+		return FALSE;
+	}
+
+	headerPtr = (const ListFileHeader *) mappingPtr;
+	dataArray = (const Data *) (headerPtr + 1);
+	isLoaded = CheckHeader (headerPtr, listPtr, fileName);
+
+	if (isLoaded && (uint64_t) fileStatus.st_size != sizeof (ListFileHeader) + headerPtr->numData * sizeof (Data)) {
+		printf ("Error: size of %s does not match its header\n", fileName);
+		isLoaded = FALSE;
+	}
+
+	if (isLoaded) {
+		checksum.sum = 0;
+		checksum.weightedSum = 0;
+		UpdateChecksum (&checksum, dataArray, (size_t) headerPtr->numData);
+		if (FinalChecksum (&checksum) != headerPtr->checksum) {
+			printf ("Error: checksum of %s does not match its data\n", fileName);
+			isLoaded = FALSE;
+		}
+	}
+
+	if (isLoaded) {
+		oldNumNodes = listPtr->numNodes;
+		AddArrayAtEnd (listPtr, dataArray, (Length) headerPtr->numData);
+		isLoaded = (listPtr->numNodes == oldNumNodes + (Length) headerPtr->numData);
+	}
+
+	munmap (mappingPtr, (size_t) fileStatus.st_size);
+	return isLoaded;
+}
+
+#define CHAR_OTHER 0		// Character that cannot appear in integer text
+#define CHAR_SEPARATOR 1	// Whitespace or comma, between integers
+#define CHAR_DIGIT 2		// '0' to '9'
+
+// Class of every character, so that the parser needs one table lookup per character
+static const unsigned char charClasses[256] = {
+	[' '] = CHAR_SEPARATOR, ['\t'] = CHAR_SEPARATOR, ['\n'] = CHAR_SEPARATOR, ['\r'] = CHAR_SEPARATOR,
+	['\v'] = CHAR_SEPARATOR, ['\f'] = CHAR_SEPARATOR, [','] = CHAR_SEPARATOR,
+	['0'] = CHAR_DIGIT, ['1'] = CHAR_DIGIT, ['2'] = CHAR_DIGIT, ['3'] = CHAR_DIGIT, ['4'] = CHAR_DIGIT,
+	['5'] = CHAR_DIGIT, ['6'] = CHAR_DIGIT, ['7'] = CHAR_DIGIT, ['8'] = CHAR_DIGIT, ['9'] = CHAR_DIGIT
+};
+
+// For integers parsed but not yet added to the list
+struct ingest {
+	LinkedList *listPtr;
+	Data batch[LIST_IO_CHUNK_SIZE / sizeof (Data)];
+	Length numBatched;
+	Length numAdded;
+};
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to add the parsed integers of a batch at the end of the list
+ * Input: ingestPtr (struct ingest *)
+ * Return value: TRUE if the batch was added, FALSE if the nodes could not be allocated
+ * Time complexity: O(ingestPtr->numBatched)
+ * Space complexity: O(1)
+ */
+static bool FlushBatch (struct ingest *ingestPtr) {
+	Length oldNumNodes;
+
+	if (ingestPtr->numBatched == 0) {
+		return TRUE;
+	}
+
+	oldNumNodes = ingestPtr->listPtr->numNodes;
+	AddArrayAtEnd (ingestPtr->listPtr, ingestPtr->batch, ingestPtr->numBatched);
+	if (ingestPtr->listPtr->numNodes != oldNumNodes + ingestPtr->numBatched) {
+		return FALSE;
+	}
+
+	ingestPtr->numAdded += ingestPtr->numBatched;
+	ingestPtr->numBatched = 0;
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to parse integers out of text that holds only whole tokens
+ * Integers are separated by whitespace or commas, and may have a sign. Full batches are added to the list on the way.
+ * Inputs: ingestPtr (struct ingest *), text (const char *), length (size_t): length of text
+ * Return value: TRUE if all of the text was parsed, FALSE on a malformed or out-of-range token, or allocation failure
+ * (an error is printed; integers before the bad token are kept)
+ * Time complexity: O(length)
+ * Space complexity: O(1)
+ */
+static bool ParseText (struct ingest *ingestPtr, const char *text, size_t length) {
+	const unsigned char *charPtr, *endPtr;
+	unsigned long long value, limit;
+	bool isNegative;
+
+	charPtr = (const unsigned char *) text;
+	endPtr = charPtr + length;
+
+	while (charPtr < endPtr) {
+		if (charClasses[*charPtr] == CHAR_SEPARATOR) {
+			charPtr++;
+			continue;
+		}
+
+		isNegative = (*charPtr == '-');
+		if (*charPtr == '-' || *charPtr == '+') {
+			charPtr++;
+		}
+		if (charPtr == endPtr || charClasses[*charPtr] != CHAR_DIGIT) {
+			printf ("Error: malformed integer in input\n");
+			return FALSE;
+		}
+
+		// the magnitude of the most negative value is one more than the most positive
+		limit = isNegative ? (unsigned long long) INT_MAX + 1 : (unsigned long long) INT_MAX;
+		value = 0;
+		while (charPtr < endPtr && charClasses[*charPtr] == CHAR_DIGIT) {
+			value = value * 10 + (unsigned long long) (*charPtr - '0');
+			if (value > limit) {
+				printf ("Error: integer in input is out of range\n");
+				return FALSE;
+			}
+			charPtr++;
+		}
+
+		if (charPtr < endPtr && charClasses[*charPtr] != CHAR_SEPARATOR) {
+			printf ("Error: malformed integer in input\n");
+			return FALSE;
+		}
+
+		ingestPtr->batch[ingestPtr->numBatched++] = isNegative ? (Data) (-(long long) value) : (Data) value;
+		if (ingestPtr->numBatched == (Length) (sizeof (ingestPtr->batch) / sizeof (Data)) && !FlushBatch (ingestPtr)) {
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add integers written in a buffer at the end of a linked list
+ * Inputs: listPtr (LinkedList *): pointer to linked list, text (const char *): integers separated by whitespace or commas,
+ * length (size_t): length of text (need not be terminated with '\0')
+ * Return value: number of integers added, or -1 on a malformed or out-of-range token, or allocation failure
+ * Post-condition: the integers are added at the end of the list in order, in batches of up to
+ * LIST_IO_CHUNK_SIZE / sizeof (Data). On error, the integers before the bad token are kept.
+ * Time complexity: O(length)
+ * Space complexity: O(LIST_IO_CHUNK_SIZE)
+ */
+Length ParseListFromBuffer (LinkedList *listPtr, const char *text, size_t length) {
+	struct ingest ingest;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ParseListFromBuffer (LinkedList *listPtr) cannot be NULL\n");
+		return -1;
+	}
+
+	if (text == NULL && length > 0) {
+		printf ("Error: Argument 2 of ParseListFromBuffer (const char *text) cannot be NULL\n");
+		return -1;
+	}
+
+	ingest.listPtr = listPtr;
+	ingest.numBatched = 0;
+	ingest.numAdded = 0;
+
+	if (!ParseText (&ingest, text, length)) {
+		FlushBatch (&ingest);
+		return -1;
+	}
+
+	if (!FlushBatch (&ingest)) {
+		return -1;
+	}
+	return ingest.numAdded;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add integers read from a file descriptor at the end of a linked list
+ * The input is read LIST_IO_CHUNK_SIZE bytes at a time. Each chunk is parsed up to its last separator; a token cut off
+ * by the end of the chunk is moved to the front and completed by the next read. So memory use is bounded however
+ * long the input is, and a pipe (such as standard input) works as well as a file.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, fileDescriptor (int): descriptor open for reading
+ * Return value: number of integers added, or -1 on a read error, a malformed or out-of-range token, or allocation failure
+ * Post-condition: as for ParseListFromBuffer. The descriptor has been read up to end of file (or the error).
+ * Time complexity: O(length of input)
+ * Space complexity: O(LIST_IO_CHUNK_SIZE)
+ */
+Length ReadListFromFile (LinkedList *listPtr, int fileDescriptor) {
+	struct ingest ingest;
+	char chunk[LIST_IO_CHUNK_SIZE];
+	size_t numCarried, numFilled, parseEnd;
+	ssize_t numRead;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of ReadListFromFile (LinkedList *listPtr) cannot be NULL\n");
+		return -1;
+	}
+
+	ingest.listPtr = listPtr;
+	ingest.numBatched = 0;
+	ingest.numAdded = 0;
+	numCarried = 0;
+
+	while (TRUE) {
+		numRead = read (fileDescriptor, chunk + numCarried, sizeof (chunk) - numCarried);
+		if (numRead < 0 && errno == EINTR) {
+			continue;
+		}
+		if (numRead < 0) {
+			printf ("Error: could not read input\n");
+			FlushBatch (&ingest);
+			return -1;
+		}
+
+		// at end of input, the carried token is complete
+		if (numRead == 0) {
+			if (!ParseText (&ingest, chunk, numCarried)) {
+				FlushBatch (&ingest);
+				return -1;
+			}
+			if (!FlushBatch (&ingest)) {
+				return -1;
+			}
+			return ingest.numAdded;
+		}
+
+		numFilled = numCarried + (size_t) numRead;
+		parseEnd = numFilled;
+		while (parseEnd > 0 && charClasses[(unsigned char) chunk[parseEnd-1]] != CHAR_SEPARATOR) {
+			parseEnd--;
+		}
+
+		if (parseEnd == 0 && numFilled == sizeof (chunk)) {
+			printf ("Error: token in input is longer than %d characters\n", LIST_IO_CHUNK_SIZE);
+			FlushBatch (&ingest);
+			return -1;
+		}
+
+		if (!ParseText (&ingest, chunk, parseEnd)) {
+			FlushBatch (&ingest);
+			return -1;
+		}
+
+		numCarried = numFilled - parseEnd;
+		memmove (chunk, chunk + parseEnd, numCarried);
+	}
+}
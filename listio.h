@@ -0,0 +1,95 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to writing out and reading in the contents
+ * of a linked list.
+ * As text, the data is formatted with a hand-rolled integer formatter into a buffer, and written to a file descriptor
+ * one large chunk at a time, instead of with one printf call per node. Nothing is allocated.
+ * As a binary snapshot, the data is stored as a header followed by the raw array of data, so that loading it back needs
+ * no parsing: the array is appended to a list in bulk (see AddArrayAtEnd), straight out of a memory-mapped file if wanted.
+ * As text coming in (from a file, a pipe or a buffer), integers are parsed by hand one fixed-size chunk at a time and
+ * appended in bounded batches, so memory use does not grow with the input.
+ *
+ * The following types are declared in this file:
+ * a) ListFormat: For the format to write a list in. Another name for int, taking one of the values below:
+ *    LIST_FORMAT_ARROW: "1 -> 2 -> 3 -> NULL" followed by a newline (the format of PrintList)
+ *    LIST_FORMAT_CSV:   "1,2,3" followed by a newline
+ *    LIST_FORMAT_LINES: one data value per line
+ * b) struct listfileheader (ListFileHeader): a structure representing the header of a binary snapshot. Contains a magic
+ *    number, the format version, the type and size of one data value, the number of data values and their checksum.
+ *    Fields are stored in the byte order of the machine that saved the file.
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to writing out a linked list as text
+ * a) SerialiseList: Function to write the contents of a linked list into a caller-supplied buffer
+ * b) SerialiseListToFile: Function to write the contents of a linked list to a file descriptor
+ *
+ * Related to binary snapshots of a linked list
+ * c) SaveList: Function to save the contents of a linked list to a binary snapshot file
+ * d) LoadList: Function to add the contents of a binary snapshot file at the end of a linked list, reading it in chunks
+ * e) MapList: Function to add the contents of a binary snapshot file at the end of a linked list, mapping it into memory
+ *
+ * Related to reading in a linked list as text
+ * f) ParseListFromBuffer: Function to add integers written in a buffer at the end of a linked list
+ * g) ReadListFromFile: Function to add integers read from a file descriptor at the end of a linked list
+ *
+ * All of the above functions are defined in "Linked List/listio.c". For more details, see there.
+ */
+
+#ifndef LISTIO_H
+#define LISTIO_H
+
+	#include <stddef.h>
+	#include <stdint.h>
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// For the format to write a list in
+	typedef int ListFormat;
+	#define LIST_FORMAT_ARROW 0
+	#define LIST_FORMAT_CSV 1
+	#define LIST_FORMAT_LINES 2
+
+	// Size in bytes of the chunks written to (or read from) a file descriptor
+	#define LIST_IO_CHUNK_SIZE 65536
+
+	// For the header of a binary snapshot
+	#define LIST_FILE_MAGIC 0x4C4C5354u	// "LLST"; read with the wrong byte order, it does not match
+	#define LIST_FILE_VERSION 1
+	#define LIST_FILE_TYPE_SIGNED_INTEGER 1
+	struct listfileheader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t dataType;
+		uint32_t dataSize;
+		uint64_t numData;
+		uint64_t checksum;
+	};
+	typedef struct listfileheader ListFileHeader;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/listio.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to writing out a linked list as text
+	size_t SerialiseList (LinkedList *listPtr, char *buffer, size_t capacity, ListFormat format);
+	bool SerialiseListToFile (LinkedList *listPtr, int fileDescriptor, ListFormat format);
+
+	// Related to binary snapshots of a linked list
+	bool SaveList (LinkedList *listPtr, const char *fileName);
+	bool LoadList (LinkedList *listPtr, const char *fileName);
+	bool MapList (LinkedList *listPtr, const char *fileName);
+
+	// Related to reading in a linked list as text
+	Length ParseListFromBuffer (LinkedList *listPtr, const char *text, size_t length);
+	Length ReadListFromFile (LinkedList *listPtr, int fileDescriptor);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
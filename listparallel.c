@@ -0,0 +1,898 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <limits.h> 		// For the starting points of the smallest and largest data
+#include "../listparallel.h"	// For type declarations and function declarations related to parallel operations on a linked list
+#include "../valueindex.h"	// For marking the value index out of date after ParallelMap
+
+#define SEGMENT_IMBALANCE 2		// A segment longer than this many times the average makes the boundaries be found again
+#define FIND_CHECK_INTERVAL 4096	// Nodes a segment walks between checks whether an earlier segment has found the data
+
+// For the kind of a parallel job
+typedef int ParallelJobKind;
+#define PARALLEL_JOB_FIND 0
+#define PARALLEL_JOB_COUNT 1
+#define PARALLEL_JOB_REDUCE 2
+#define PARALLEL_JOB_SUM 3
+#define PARALLEL_JOB_MIN_MAX 4
+#define PARALLEL_JOB_MAP 5
+
+// For one parallel operation. Results go into the arrays of the segments, one element (two for MIN_MAX) per segment.
+struct paralleljob {
+	ParallelJobKind kind;
+	ListSegments *segmentsPtr;
+	Data data;
+	long long identity;
+	long long (*accumulate) (long long result, Data data, void *contextPtr);
+	Data (*transform) (Data data, void *contextPtr);
+	void *contextPtr;
+	_Atomic Index firstFoundSegment;
+};
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to pack a run of segments into the word of a worker queue
+ * Inputs: first (Index) (int), last (Index) (int): the run is segments [first, last)
+ * Return value: first in the high 32 bits, last in the low 32 bits (uint64_t)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static uint64_t PackRange (Index first, Index last) {
+	return ((uint64_t) (uint32_t) first << 32) | (uint64_t) (uint32_t) last;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to take one segment from a worker queue
+ * The owner of the queue takes from the front, other threads (stealing) from the back, so that the owner walks its
+ * run in list order and a thief takes the work the owner would have reached last.
+ * Inputs: queuePtr (WorkerQueue *): pointer to worker queue, isOwner (bool): TRUE if the queue is the caller's own,
+ * segmentPtr (Index *): receives the segment taken
+ * Return value: TRUE if a segment was taken, FALSE if the queue is empty
+ * Assumptions: queuePtr != NULL, segmentPtr != NULL
+ * Time complexity: O(1) (lock-free: retried only when another thread took a segment from the same queue meanwhile)
+ * Space complexity: O(1)
+ */
+static bool TakeSegment (WorkerQueue *queuePtr, bool isOwner, Index *segmentPtr) {
+	uint64_t range, newRange;
+	Index first, last;
+
+	range = atomic_load_explicit (&(queuePtr->range), memory_order_acquire);
+	while (TRUE) {
+		first = (Index) (range >> 32);
+		last = (Index) (range & UINT32_MAX);
+		if (first >= last) {
+			return FALSE;
+		}
+
+		if (isOwner) {
+			newRange = PackRange (first+1, last);
+			*segmentPtr = first;
+		}
+		else {
+			newRange = PackRange (first, last-1);
+			*segmentPtr = last-1;
+		}
+
+		if (atomic_compare_exchange_weak_explicit (&(queuePtr->range), &range, newRange,
+			memory_order_acq_rel, memory_order_acquire)) {
+			return TRUE;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to record that a segment has found the data a job is looking for
+ * Inputs: jobPtr (struct paralleljob *): pointer to job, segment (Index) (int): the segment
+ * Return value: none
+ * Post-condition: jobPtr->firstFoundSegment is the smaller of its old value and segment
+ * Assumptions: jobPtr != NULL
+ * Time complexity: O(1) (lock-free)
+ * Space complexity: O(1)
+ */
+static void LowerFirstFoundSegment (struct paralleljob *jobPtr, Index segment) {
+	Index firstFoundSegment;
+
+	firstFoundSegment = atomic_load_explicit (&(jobPtr->firstFoundSegment), memory_order_relaxed);
+	while (segment < firstFoundSegment) {
+		if (atomic_compare_exchange_weak_explicit (&(jobPtr->firstFoundSegment), &firstFoundSegment, segment,
+			memory_order_relaxed, memory_order_relaxed)) {
+			return;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to run a job on one segment of a linked list
+ * Input: jobPtr (struct paralleljob *): pointer to job, segment (Index) (int): the segment
+ * Return value: none
+ * Post-condition: the result of the segment is in the arrays of jobPtr->segmentsPtr. The length of the segment is
+ * recorded too, unless the walk was cut short (PARALLEL_JOB_FIND)
+ * Assumptions: jobPtr != NULL, 0 <= segment < jobPtr->segmentsPtr->numSegments, no other thread runs the same segment
+ * Time complexity: O(length of the segment)
+ * Space complexity: O(1)
+ */
+static void RunSegment (struct paralleljob *jobPtr, Index segment) {
+	ListSegments *segmentsPtr = jobPtr->segmentsPtr;
+	ListNode *prevNodePtr, *currNodePtr, *endNodePtr;
+	Length numNodes = 0;
+	long long result, minData, maxData;
+
+	if (segment == 0) {
+		prevNodePtr = NULL;
+		currNodePtr = segmentsPtr->listPtr->headPtr;
+	}
+	else {
+		prevNodePtr = segmentsPtr->boundaryCursors[segment-1].prevNodePtr;
+		currNodePtr = segmentsPtr->boundaryCursors[segment-1].currNodePtr;
+	}
+	endNodePtr = (segment == (segmentsPtr->numSegments)-1) ? NULL : segmentsPtr->boundaryCursors[segment].currNodePtr;
+
+	if (jobPtr->kind == PARALLEL_JOB_FIND) {
+		segmentsPtr->foundNodePtrs[segment] = NULL;
+		while (currNodePtr != endNodePtr) {
+			// an earlier segment has found the data already
+			if (numNodes % FIND_CHECK_INTERVAL == 0
+				&& atomic_load_explicit (&(jobPtr->firstFoundSegment), memory_order_relaxed) < segment) {
+				return;
+			}
+
+			if (currNodePtr->data == jobPtr->data) {
+				segmentsPtr->foundNodePtrs[segment] = currNodePtr;
+				segmentsPtr->foundPrevNodePtrs[segment] = prevNodePtr;
+				LowerFirstFoundSegment (jobPtr, segment);
+				return;
+			}
+
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+			numNodes++;
+		}
+	}
+
+	else if (jobPtr->kind == PARALLEL_JOB_COUNT) {
+		result = 0;
+		for (; currNodePtr != endNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			result += (currNodePtr->data == jobPtr->data);
+			numNodes++;
+		}
+		segmentsPtr->segmentResults[segment] = result;
+	}
+
+	else if (jobPtr->kind == PARALLEL_JOB_REDUCE) {
+		result = jobPtr->identity;
+		for (; currNodePtr != endNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			result = jobPtr->accumulate (result, currNodePtr->data, jobPtr->contextPtr);
+			numNodes++;
+		}
+		segmentsPtr->segmentResults[segment] = result;
+	}
+
+	else if (jobPtr->kind == PARALLEL_JOB_SUM) {
+		result = 0;
+		for (; currNodePtr != endNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			result += currNodePtr->data;
+			numNodes++;
+		}
+		segmentsPtr->segmentResults[segment] = result;
+	}
+
+	else if (jobPtr->kind == PARALLEL_JOB_MIN_MAX) {
+		// an empty segment leaves minData > maxData
+		minData = LLONG_MAX;
+		maxData = LLONG_MIN;
+		for (; currNodePtr != endNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			if (currNodePtr->data < minData) {
+				minData = currNodePtr->data;
+			}
+			if (currNodePtr->data > maxData) {
+				maxData = currNodePtr->data;
+			}
+			numNodes++;
+		}
+		segmentsPtr->segmentResults[2*segment] = minData;
+		segmentsPtr->segmentResults[2*segment + 1] = maxData;
+	}
+
+	else {
+		for (; currNodePtr != endNodePtr; currNodePtr = currNodePtr->nextNodePtr) {
+			currNodePtr->data = jobPtr->transform (currNodePtr->data, jobPtr->contextPtr);
+			numNodes++;
+		}
+	}
+
+	segmentsPtr->segmentLengths[segment] = numNodes;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to run segments of the current job of a worker pool until none are left
+ * The thread first empties its own queue, then steals from the queues of the other threads in turn.
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, thread (Index) (int): the thread calling
+ * Return value: none
+ * Assumptions: poolPtr != NULL, poolPtr->jobPtr points to the current job, 0 <= thread < poolPtr->numThreads
+ * Time complexity: O(length of the segments run + numThreads)
+ * Space complexity: O(1)
+ */
+static void DoWork (ListWorkerPool *poolPtr, Index thread) {
+	Index segment, victim, i;
+
+	while (TakeSegment (&(poolPtr->queues[thread]), TRUE, &segment)) {
+		RunSegment (poolPtr->jobPtr, segment);
+	}
+
+	for (i = 1; i < poolPtr->numThreads; i++) {
+		victim = (thread + i) % (poolPtr->numThreads);
+		while (TakeSegment (&(poolPtr->queues[victim]), FALSE, &segment)) {
+			RunSegment (poolPtr->jobPtr, segment);
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function run by each helper thread of a worker pool: waits for jobs and works on them, until the pool stops
+ * Input: argPtr (void *): pointer to the WorkerQueue of the thread
+ * Return value: NULL
+ * Time complexity: O(work done)
+ * Space complexity: O(1)
+ */
+static void *HelperThread (void *argPtr) {
+	WorkerQueue *queuePtr = (WorkerQueue *) argPtr;
+	ListWorkerPool *poolPtr = queuePtr->poolPtr;
+	Index thread = (Index) (queuePtr - poolPtr->queues);
+	unsigned long jobNumber = 0;
+
+	pthread_mutex_lock (&(poolPtr->lock));
+	while (TRUE) {
+		while (!(poolPtr->isStopping) && poolPtr->jobNumber == jobNumber) {
+			pthread_cond_wait (&(poolPtr->jobReady), &(poolPtr->lock));
+		}
+		if (poolPtr->isStopping) {
+			break;
+		}
+		jobNumber = poolPtr->jobNumber;
+		pthread_mutex_unlock (&(poolPtr->lock));
+
+		DoWork (poolPtr, thread);
+
+		pthread_mutex_lock (&(poolPtr->lock));
+		(poolPtr->numBusyHelpers)--;
+		if (poolPtr->numBusyHelpers == 0) {
+			pthread_cond_signal (&(poolPtr->jobDone));
+		}
+	}
+	pthread_mutex_unlock (&(poolPtr->lock));
+
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to check whether the longest segment of a linked list is too long
+ * Input: segmentsPtr (ListSegments *): pointer to segments, with segmentsPtr->segmentLengths filled in
+ * Return value: TRUE if some segment is more than SEGMENT_IMBALANCE times as long as the average (rounded up)
+ * Assumptions: segmentsPtr != NULL
+ * Time complexity: O(segmentsPtr->numSegments)
+ * Space complexity: O(1)
+ */
+static bool IsUnbalanced (ListSegments *segmentsPtr) {
+	Length numSegments = segmentsPtr->numSegments;
+	Length averageLength = ((segmentsPtr->listPtr->numNodes) + numSegments - 1) / numSegments;
+	Index i;
+
+	for (i = 0; i < numSegments; i++) {
+		if (segmentsPtr->segmentLengths[i] > SEGMENT_IMBALANCE * averageLength) {
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to find the boundaries of the segments of a linked list again, if they are out of date
+ * They are if the last full walk found the segments unbalanced, or if the positions of the boundary cursors are all
+ * known and show them unbalanced (as after an operation that reorders the list, which moves all cursors to the head).
+ * Input: segmentsPtr (ListSegments *): pointer to segments
+ * Return value: none
+ * Assumptions: segmentsPtr != NULL, segmentsPtr->listPtr != NULL
+ * Time complexity: O(segmentsPtr->numSegments), O(segmentsPtr->listPtr->numNodes) if the boundaries are found again
+ * Space complexity: O(1)
+ */
+static void RefreshSegments (ListSegments *segmentsPtr) {
+	ListCursor *cursors = segmentsPtr->boundaryCursors;
+	Length numSegments = segmentsPtr->numSegments;
+	Index i, startPosition, endPosition;
+
+	if (!(segmentsPtr->isStale)) {
+		for (i = 0; i < numSegments-1; i++) {
+			if (!(cursors[i].isIndexKnown)) {
+				break;
+			}
+		}
+
+		// every boundary position is known
+		if (i == numSegments-1) {
+			for (i = 0; i < numSegments; i++) {
+				startPosition = (i == 0) ? 0 : cursors[i-1].index;
+				endPosition = (i == numSegments-1) ? segmentsPtr->listPtr->numNodes : cursors[i].index;
+				segmentsPtr->segmentLengths[i] = endPosition - startPosition;
+			}
+			segmentsPtr->isStale = IsUnbalanced (segmentsPtr);
+		}
+	}
+
+	if (segmentsPtr->isStale) {
+		RebuildSegments (segmentsPtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to run a job on every segment of a linked list, using a worker pool
+ * The boundaries are found again first if they are out of date. Each thread is given a contiguous run of segments;
+ * lists shorter than LIST_PARALLEL_MIN_NODES are walked by the calling thread alone.
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, jobPtr (struct paralleljob *): pointer to job
+ * Return value: none
+ * Post-condition: every segment has been run. For jobs that walk every node, segments found unbalanced are marked
+ * to have their boundaries found again before the next job.
+ * Assumptions: poolPtr != NULL, jobPtr != NULL, jobPtr->segmentsPtr is attached to a list
+ * Time complexity: O(listPtr->numNodes / poolPtr->numThreads + numSegments) in the best case
+ * Space complexity: O(1)
+ */
+static void RunJob (ListWorkerPool *poolPtr, struct paralleljob *jobPtr) {
+	ListSegments *segmentsPtr = jobPtr->segmentsPtr;
+	Length numSegments = segmentsPtr->numSegments, numThreads = poolPtr->numThreads;
+	Index thread;
+
+	RefreshSegments (segmentsPtr);
+	atomic_init (&(jobPtr->firstFoundSegment), numSegments);
+	poolPtr->jobPtr = jobPtr;
+
+	if (numThreads == 1 || segmentsPtr->listPtr->numNodes < LIST_PARALLEL_MIN_NODES) {
+		atomic_store_explicit (&(poolPtr->queues[0].range), PackRange (0, numSegments), memory_order_relaxed);
+		DoWork (poolPtr, 0);
+	}
+	else {
+		for (thread = 0; thread < numThreads; thread++) {
+			atomic_store_explicit (&(poolPtr->queues[thread].range),
+				PackRange (thread * numSegments / numThreads, (thread+1) * numSegments / numThreads), memory_order_relaxed);
+		}
+
+		pthread_mutex_lock (&(poolPtr->lock));
+		(poolPtr->jobNumber)++;
+		poolPtr->numBusyHelpers = numThreads-1;
+		pthread_cond_broadcast (&(poolPtr->jobReady));
+		pthread_mutex_unlock (&(poolPtr->lock));
+
+		DoWork (poolPtr, 0);
+
+		pthread_mutex_lock (&(poolPtr->lock));
+		while (poolPtr->numBusyHelpers > 0) {
+			pthread_cond_wait (&(poolPtr->jobDone), &(poolPtr->lock));
+		}
+		pthread_mutex_unlock (&(poolPtr->lock));
+	}
+
+	if (jobPtr->kind != PARALLEL_JOB_FIND) {
+		segmentsPtr->isStale = IsUnbalanced (segmentsPtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to check the arguments shared by all parallel operations
+ * Inputs: poolPtr (ListWorkerPool *), segmentsPtr (ListSegments *): the first two arguments,
+ * functionName (const char *): name of the parallel operation, for error messages
+ * Return value: TRUE if the operation can go ahead, FALSE (after printing an error) otherwise
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static bool CheckParallelArguments (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, const char *functionName) {
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of %s (ListWorkerPool *poolPtr) cannot be NULL\n", functionName);
+		return FALSE;
+	}
+
+	if (segmentsPtr == NULL) {
+		printf ("Error: Argument 2 of %s (ListSegments *segmentsPtr) cannot be NULL\n", functionName);
+		return FALSE;
+	}
+
+	if (segmentsPtr->listPtr == NULL) {
+		printf ("Error: Argument 2 of %s (ListSegments *segmentsPtr) is not attached to a linked list\n", functionName);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to start a pool of worker threads
+ * The calling thread of each parallel operation counts as one of the threads, so numThreads-1 helper threads are
+ * started. They sleep between operations. One pool can serve any number of lists, one operation at a time.
+ * Inputs: poolPtr (ListWorkerPool *): pointer to the pool to initialise, numThreads (Length) (int): number of threads
+ * Return value: TRUE if the pool was made (with fewer threads than asked if some could not be started; see
+ * poolPtr->numThreads), FALSE if it could not be allocated
+ * Post-condition: if TRUE, the pool is ready for parallel operations, and must be stopped with DestroyWorkerPool
+ * Assumptions: poolPtr != NULL, numThreads >= 1
+ * Time complexity: O(numThreads)
+ * Space complexity: O(numThreads)
+ */
+bool InitialiseWorkerPool (ListWorkerPool *poolPtr, Length numThreads) {
+	Index i;
+
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of InitialiseWorkerPool (ListWorkerPool *poolPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (numThreads < 1) {
+		printf ("Error: Argument 2 of InitialiseWorkerPool (Length numThreads) must be at least 1\n");
+		return FALSE;
+	}
+
+	poolPtr->queues = (WorkerQueue *) aligned_alloc (LIST_PARALLEL_CACHE_LINE_SIZE, numThreads * sizeof (WorkerQueue));
+	poolPtr->helperThreads = (pthread_t *) malloc (numThreads * sizeof (pthread_t));
+	if (poolPtr->queues == NULL || poolPtr->helperThreads == NULL) {
+		printf ("Error: could not allocate a worker pool\n");
+		free (poolPtr->queues);
+		free (poolPtr->helperThreads);
+		return FALSE;
+	}
+
+	pthread_mutex_init (&(poolPtr->lock), NULL);
+	pthread_cond_init (&(poolPtr->jobReady), NULL);
+	pthread_cond_init (&(poolPtr->jobDone), NULL);
+	poolPtr->jobPtr = NULL;
+	poolPtr->jobNumber = 0;
+	poolPtr->numBusyHelpers = 0;
+	poolPtr->isStopping = FALSE;
+
+	for (i = 0; i < numThreads; i++) {
+		atomic_init (&(poolPtr->queues[i].range), PackRange (0, 0));
+		poolPtr->queues[i].poolPtr = poolPtr;
+	}
+
+	// helper i works on queue i; the pool only counts the helpers that did start
+	poolPtr->numThreads = 1;
+	for (i = 1; i < numThreads; i++) {
+		if (pthread_create (&(poolPtr->helperThreads[i-1]), NULL, HelperThread, &(poolPtr->queues[i])) != 0) {
+			printf ("Error: could only start %d of %d threads of a worker pool\n", i, numThreads);
+			break;
+		}
+		(poolPtr->numThreads)++;
+	}
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to stop (and free) the threads of a worker pool
+ * Input: poolPtr (ListWorkerPool *): pointer to worker pool
+ * Return value: none
+ * Pre-condition: no parallel operation is running on the pool
+ * Post-condition: the helper threads have finished, and the memory of the pool is freed
+ * Assumptions: poolPtr != NULL, the pool was made by InitialiseWorkerPool
+ * Time complexity: O(poolPtr->numThreads)
+ * Space complexity: O(1)
+ */
+void DestroyWorkerPool (ListWorkerPool *poolPtr) {
+	Index i;
+
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of DestroyWorkerPool (ListWorkerPool *poolPtr) cannot be NULL\n");
+		return;
+	}
+
+	pthread_mutex_lock (&(poolPtr->lock));
+	poolPtr->isStopping = TRUE;
+	pthread_cond_broadcast (&(poolPtr->jobReady));
+	pthread_mutex_unlock (&(poolPtr->lock));
+
+	for (i = 0; i < (poolPtr->numThreads)-1; i++) {
+		pthread_join (poolPtr->helperThreads[i], NULL);
+	}
+
+	pthread_mutex_destroy (&(poolPtr->lock));
+	pthread_cond_destroy (&(poolPtr->jobReady));
+	pthread_cond_destroy (&(poolPtr->jobDone));
+	free (poolPtr->queues);
+	free (poolPtr->helperThreads);
+	poolPtr->queues = NULL;
+	poolPtr->helperThreads = NULL;
+	poolPtr->numThreads = 0;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to cut a linked list into segments, for parallel operations
+ * numSegments-1 cursors are attached to the list as boundaries, and placed numNodes/numSegments nodes apart.
+ * A few segments per thread of the pools used (e.g. 4 to 8) leave room for stealing work.
+ * Like any cursors, the boundaries add O(numSegments) to each addition and removal of a node.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, segmentsPtr (ListSegments *): pointer to the segments to
+ * initialise, numSegments (Length) (int): number of segments
+ * Return value: TRUE if the segments were made, FALSE if they could not be allocated
+ * Post-condition: if TRUE, segmentsPtr is attached to the list, and must be detached (DetachSegments) before the list
+ * or segmentsPtr goes away
+ * Assumptions: listPtr != NULL, segmentsPtr != NULL, numSegments >= 1
+ * Time complexity: O(listPtr->numNodes + numSegments)
+ * Space complexity: O(numSegments)
+ */
+bool AttachSegments (LinkedList *listPtr, ListSegments *segmentsPtr, Length numSegments) {
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachSegments (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (segmentsPtr == NULL) {
+		printf ("Error: Argument 2 of AttachSegments (ListSegments *segmentsPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (numSegments < 1) {
+		printf ("Error: Argument 3 of AttachSegments (Length numSegments) must be at least 1\n");
+		return FALSE;
+	}
+
+	segmentsPtr->boundaryCursors = (ListCursor *) malloc (numSegments * sizeof (ListCursor));
+	segmentsPtr->segmentLengths = (Length *) malloc (numSegments * sizeof (Length));
+	segmentsPtr->segmentResults = (long long *) malloc (2 * numSegments * sizeof (long long));
+	segmentsPtr->foundNodePtrs = (ListNode **) malloc (numSegments * sizeof (ListNode *));
+	segmentsPtr->foundPrevNodePtrs = (ListNode **) malloc (numSegments * sizeof (ListNode *));
+	if (segmentsPtr->boundaryCursors == NULL || segmentsPtr->segmentLengths == NULL || segmentsPtr->segmentResults == NULL
+		|| segmentsPtr->foundNodePtrs == NULL || segmentsPtr->foundPrevNodePtrs == NULL) {
+		printf ("Error: could not allocate the segments of a linked list\n");
+		free (segmentsPtr->boundaryCursors);
+		free (segmentsPtr->segmentLengths);
+		free (segmentsPtr->segmentResults);
+		free (segmentsPtr->foundNodePtrs);
+		free (segmentsPtr->foundPrevNodePtrs);
+		segmentsPtr->listPtr = NULL;
+		return FALSE;
+	}
+
+	segmentsPtr->listPtr = listPtr;
+	segmentsPtr->numSegments = numSegments;
+	for (i = 0; i < numSegments-1; i++) {
+		AttachCursor (listPtr, &(segmentsPtr->boundaryCursors[i]));
+	}
+
+	RebuildSegments (segmentsPtr);
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to remove the segments of a linked list
+ * Input: segmentsPtr (ListSegments *): pointer to segments
+ * Return value: none
+ * Post-condition: the boundary cursors are detached from the list, the memory of the segments is freed,
+ * segmentsPtr->listPtr = NULL. The list is not changed.
+ * Assumptions: segmentsPtr != NULL
+ * Time complexity: O(numSegments * number of cursors of the list)
+ * Space complexity: O(1)
+ */
+void DetachSegments (ListSegments *segmentsPtr) {
+	Index i;
+
+	if (segmentsPtr == NULL) {
+		printf ("Error: Argument 1 of DetachSegments (ListSegments *segmentsPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (segmentsPtr->listPtr == NULL) {
+		return;
+	}
+
+	for (i = 0; i < (segmentsPtr->numSegments)-1; i++) {
+		DetachCursor (&(segmentsPtr->boundaryCursors[i]));
+	}
+
+	free (segmentsPtr->boundaryCursors);
+	free (segmentsPtr->segmentLengths);
+	free (segmentsPtr->segmentResults);
+	free (segmentsPtr->foundNodePtrs);
+	free (segmentsPtr->foundPrevNodePtrs);
+	segmentsPtr->listPtr = NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to find the boundaries of the segments of a linked list again, in one walk of the list
+ * The parallel operations do this themselves when the segments have become unbalanced; calling it directly is only
+ * needed after many additions or removals at positions the list did not know (e.g. AddNode in the middle).
+ * Input: segmentsPtr (ListSegments *): pointer to segments
+ * Return value: none
+ * Post-condition: segment i holds the nodes at positions [i*numNodes/numSegments, (i+1)*numNodes/numSegments)
+ * Assumptions: segmentsPtr != NULL
+ * Time complexity: O(segmentsPtr->listPtr->numNodes + numSegments)
+ * Space complexity: O(1)
+ */
+void RebuildSegments (ListSegments *segmentsPtr) {
+	LinkedList *listPtr;
+	ListCursor *cursorPtr;
+	ListNode *prevNodePtr, *currNodePtr;
+	Length numSegments;
+	Index i, position, boundaryPosition;
+
+	if (segmentsPtr == NULL) {
+		printf ("Error: Argument 1 of RebuildSegments (ListSegments *segmentsPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (segmentsPtr->listPtr == NULL) {
+		printf ("Error: Argument 1 of RebuildSegments (ListSegments *segmentsPtr) is not attached to a linked list\n");
+		return;
+	}
+
+	listPtr = segmentsPtr->listPtr;
+	numSegments = segmentsPtr->numSegments;
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+	position = 0;
+
+	for (i = 0; i < numSegments-1; i++) {
+		boundaryPosition = (Index) ((long long) (i+1) * (listPtr->numNodes) / numSegments);
+		while (position < boundaryPosition) {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+			position++;
+		}
+
+		cursorPtr = &(segmentsPtr->boundaryCursors[i]);
+		cursorPtr->prevNodePtr = prevNodePtr;
+		cursorPtr->currNodePtr = currNodePtr;
+		cursorPtr->index = position;
+		cursorPtr->isIndexKnown = TRUE;
+	}
+
+	for (i = 0; i < numSegments; i++) {
+		segmentsPtr->segmentLengths[i] = (Index) ((long long) (i+1) * (listPtr->numNodes) / numSegments)
+			- (Index) ((long long) i * (listPtr->numNodes) / numSegments);
+	}
+	segmentsPtr->isStale = FALSE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to find the first node holding given data in a linked list, using a worker pool
+ * Every segment is searched at once; a segment stops early once an earlier segment has found the data.
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list,
+ * data (Data) (int), prevNodePtrPtr (ListNode **): receives the node before the node found (NULL => head;
+ * may be NULL if not wanted)
+ * Return value: pointer to the first node holding data, NULL if there is none
+ * Post-condition: the list is unchanged
+ * Assumptions: poolPtr != NULL, segmentsPtr != NULL and attached to a list
+ * Time complexity: O(numNodes / numThreads) if the data is not in the list
+ * Space complexity: O(1)
+ */
+ListNode *ParallelFindData (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data data, ListNode **prevNodePtrPtr) {
+	struct paralleljob job;
+	Index i;
+
+	if (prevNodePtrPtr != NULL) {
+		*prevNodePtrPtr = NULL;
+	}
+
+	if (!CheckParallelArguments (poolPtr, segmentsPtr, "ParallelFindData")) {
+		return NULL;
+	}
+
+	job.kind = PARALLEL_JOB_FIND;
+	job.segmentsPtr = segmentsPtr;
+	job.data = data;
+	RunJob (poolPtr, &job);
+
+	for (i = 0; i < segmentsPtr->numSegments; i++) {
+		if (segmentsPtr->foundNodePtrs[i] != NULL) {
+			if (prevNodePtrPtr != NULL) {
+				*prevNodePtrPtr = segmentsPtr->foundPrevNodePtrs[i];
+			}
+			return segmentsPtr->foundNodePtrs[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to count the nodes of a linked list holding given data, using a worker pool
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list,
+ * data (Data) (int)
+ * Return value: number of nodes holding data (Length) (int)
+ * Post-condition: the list is unchanged
+ * Assumptions: poolPtr != NULL, segmentsPtr != NULL and attached to a list
+ * Time complexity: O(numNodes / numThreads + numSegments)
+ * Space complexity: O(1)
+ */
+Length ParallelCountData (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data data) {
+	struct paralleljob job;
+	Length numNodesFound = 0;
+	Index i;
+
+	if (!CheckParallelArguments (poolPtr, segmentsPtr, "ParallelCountData")) {
+		return 0;
+	}
+
+	job.kind = PARALLEL_JOB_COUNT;
+	job.segmentsPtr = segmentsPtr;
+	job.data = data;
+	RunJob (poolPtr, &job);
+
+	for (i = 0; i < segmentsPtr->numSegments; i++) {
+		numNodesFound += (Length) segmentsPtr->segmentResults[i];
+	}
+
+	return numNodesFound;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to combine the data of all nodes of a linked list into one value, using a worker pool
+ * Each segment folds its data into identity with accumulate, in list order; the results of the segments are then
+ * folded together with combine, in list order, starting from identity.
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list,
+ * identity (long long): result for no data, accumulate (long long (*) (long long, Data, void *)): adds one data value
+ * to a result, combine (long long (*) (long long, long long, void *)): joins the results of two consecutive runs of
+ * nodes, contextPtr (void *): passed on to every call of accumulate and combine
+ * Return value: the combined result (long long)
+ * Post-condition: the list is unchanged
+ * Assumptions: poolPtr != NULL, segmentsPtr != NULL and attached to a list, accumulate != NULL, combine != NULL,
+ * combine is associative with identity as its identity, accumulate and combine are safe to call from several threads
+ * Time complexity: O(numNodes / numThreads + numSegments) calls of accumulate and combine
+ * Space complexity: O(1)
+ */
+long long ParallelReduce (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, long long identity,
+	long long (*accumulate) (long long result, Data data, void *contextPtr),
+	long long (*combine) (long long firstResult, long long secondResult, void *contextPtr), void *contextPtr) {
+	struct paralleljob job;
+	long long result;
+	Index i;
+
+	if (!CheckParallelArguments (poolPtr, segmentsPtr, "ParallelReduce")) {
+		return identity;
+	}
+
+	if (accumulate == NULL || combine == NULL) {
+		printf ("Error: Arguments 4 and 5 of ParallelReduce (accumulate, combine) cannot be NULL\n");
+		return identity;
+	}
+
+	job.kind = PARALLEL_JOB_REDUCE;
+	job.segmentsPtr = segmentsPtr;
+	job.identity = identity;
+	job.accumulate = accumulate;
+	job.contextPtr = contextPtr;
+	RunJob (poolPtr, &job);
+
+	result = identity;
+	for (i = 0; i < segmentsPtr->numSegments; i++) {
+		result = combine (result, segmentsPtr->segmentResults[i], contextPtr);
+	}
+
+	return result;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to add up the data of all nodes of a linked list, using a worker pool
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list
+ * Return value: sum of the data (long long), 0 for an empty list
+ * Post-condition: the list is unchanged
+ * Assumptions: poolPtr != NULL, segmentsPtr != NULL and attached to a list
+ * Time complexity: O(numNodes / numThreads + numSegments)
+ * Space complexity: O(1)
+ */
+long long ParallelSum (ListWorkerPool *poolPtr, ListSegments *segmentsPtr) {
+	struct paralleljob job;
+	long long sum = 0;
+	Index i;
+
+	if (!CheckParallelArguments (poolPtr, segmentsPtr, "ParallelSum")) {
+		return 0;
+	}
+
+	job.kind = PARALLEL_JOB_SUM;
+	job.segmentsPtr = segmentsPtr;
+	RunJob (poolPtr, &job);
+
+	for (i = 0; i < segmentsPtr->numSegments; i++) {
+		sum += segmentsPtr->segmentResults[i];
+	}
+
+	return sum;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to find the smallest and largest data of a linked list, using a worker pool
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list,
+ * minDataPtr (Data *), maxDataPtr (Data *): receive the smallest and largest data
+ * Return value: TRUE if the list has data, FALSE if it is empty (*minDataPtr and *maxDataPtr are then not changed)
+ * Post-condition: the list is unchanged
+ * Assumptions: poolPtr != NULL, segmentsPtr != NULL and attached to a list, minDataPtr != NULL, maxDataPtr != NULL
+ * Time complexity: O(numNodes / numThreads + numSegments)
+ * Space complexity: O(1)
+ */
+bool ParallelMinMax (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data *minDataPtr, Data *maxDataPtr) {
+	struct paralleljob job;
+	long long minData = LLONG_MAX, maxData = LLONG_MIN;
+	Index i;
+
+	if (!CheckParallelArguments (poolPtr, segmentsPtr, "ParallelMinMax")) {
+		return FALSE;
+	}
+
+	if (minDataPtr == NULL || maxDataPtr == NULL) {
+		printf ("Error: Arguments 3 and 4 of ParallelMinMax (Data *minDataPtr, Data *maxDataPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	if (segmentsPtr->listPtr->numNodes == 0) {
+		return FALSE;
+	}
+
+	job.kind = PARALLEL_JOB_MIN_MAX;
+	job.segmentsPtr = segmentsPtr;
+	RunJob (poolPtr, &job);
+
+	for (i = 0; i < segmentsPtr->numSegments; i++) {
+		if (segmentsPtr->segmentResults[2*i] < minData) {
+			minData = segmentsPtr->segmentResults[2*i];
+		}
+		if (segmentsPtr->segmentResults[2*i + 1] > maxData) {
+			maxData = segmentsPtr->segmentResults[2*i + 1];
+		}
+	}
+
+	*minDataPtr = (Data) minData;
+	*maxDataPtr = (Data) maxData;
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to replace the data of every node of a linked list by a function of it, using a worker pool
+ * Inputs: poolPtr (ListWorkerPool *): pointer to worker pool, segmentsPtr (ListSegments *): segments of the list,
+ * transform (Data (*) (Data, void *)): gives the new data of a node from its old data,
+ * contextPtr (void *): passed on to every call of transform
+ * Return value: none
+ * Post-condition: each node holds transform (its old data). The nodes themselves and their order are unchanged;
+ * the value index of the list (if any) is marked out of date.
+ * Assumptions: poolPtr != NULL, segmentsPtr != NULL and attached to a list, transform != NULL,
+ * transform is safe to call from several threads
+ * Time complexity: O(numNodes / numThreads + numSegments) calls of transform
+ * Space complexity: O(1)
+ */
+void ParallelMap (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data (*transform) (Data data, void *contextPtr),
+	void *contextPtr) {
+	struct paralleljob job;
+
+	if (!CheckParallelArguments (poolPtr, segmentsPtr, "ParallelMap")) {
+		return;
+	}
+
+	if (transform == NULL) {
+		printf ("Error: Argument 3 of ParallelMap (transform) cannot be NULL\n");
+		return;
+	}
+
+	job.kind = PARALLEL_JOB_MAP;
+	job.segmentsPtr = segmentsPtr;
+	job.transform = transform;
+	job.contextPtr = contextPtr;
+	RunJob (poolPtr, &job);
+
+	if (segmentsPtr->listPtr->valueIndexPtr != NULL) {
+		InvalidateValueIndex (segmentsPtr->listPtr);
+	}
+}
@@ -0,0 +1,124 @@
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to parallel operations on a linked list.
+ * A linked list is cut into segments by boundary cursors attached to it (see AttachCursor), so the boundaries are found
+ * once and then kept valid by the list itself as nodes are added and removed; they are only found again when the
+ * segments have become unbalanced. Find, count, reduce and map run one task per segment on a worker pool: each thread
+ * starts with a contiguous run of segments, takes them from the front, and once out of work steals from the back of
+ * the other threads' runs, so a thread that got slow or long segments does not hold up the rest.
+ *
+ * The list must not be changed while a parallel operation runs on it (the calling thread takes part in the operation,
+ * so this only matters if other threads use the list). Parallel operations are not recorded in list statistics.
+ *
+ * The following types are declared in this file:
+ * a) struct listsegments (ListSegments): a structure representing the segments of a linked list. Contains the list,
+ *    the boundary cursors, the number of segments, the length of each segment found by the last full walk, the results
+ *    of each segment and whether the boundaries are to be found again
+ * b) struct workerqueue (WorkerQueue): a structure representing the run of segments still to be done by one thread,
+ *    packed into one atomic word, on a cache line of its own, and the pool it belongs to
+ * c) struct listworkerpool (ListWorkerPool): a structure representing a pool of threads running parallel operations.
+ *    Contains the helper threads, their queues, and the lock and conditions with which the calling thread hands them a job
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to worker pools
+ * a) InitialiseWorkerPool: Function to start a pool of worker threads
+ * b) DestroyWorkerPool: Function to stop (and free) the threads of a worker pool
+ *
+ * Related to segments of a linked list
+ * c) AttachSegments: Function to cut a linked list into segments
+ * d) DetachSegments: Function to remove the segments of a linked list
+ * e) RebuildSegments: Function to find the boundaries of the segments of a linked list again
+ *
+ * Related to parallel operations on a linked list
+ * f) ParallelFindData: Function to find the first node holding given data, using a worker pool
+ * g) ParallelCountData: Function to count the nodes holding given data, using a worker pool
+ * h) ParallelReduce: Function to combine the data of all nodes into one value, using a worker pool
+ * i) ParallelSum: Function to add up the data of all nodes, using a worker pool
+ * j) ParallelMinMax: Function to find the smallest and largest data, using a worker pool
+ * k) ParallelMap: Function to replace the data of every node by a function of it, using a worker pool
+ *
+ * All of the above functions are defined in "Linked List/listparallel.c". For more details, see there.
+ */
+
+#ifndef LISTPARALLEL_H
+#define LISTPARALLEL_H
+
+	#include <stdint.h>
+	#include <stdatomic.h>
+	#include <pthread.h>
+	#include "linkedlist.h"
+
+	// Size of a cache line in bytes, to keep the queues of different threads apart
+	#define LIST_PARALLEL_CACHE_LINE_SIZE 64
+
+	// Fewest nodes for which the helper threads are woken; shorter lists are walked by the calling thread alone
+	#define LIST_PARALLEL_MIN_NODES 65536
+
+	// For the segments of a linked list. Segment 0 starts at the head, segment i > 0 at the current node of
+	// boundaryCursors[i-1], and each segment ends where the next one starts.
+	struct listsegments {
+		LinkedList *listPtr;
+		ListCursor *boundaryCursors;
+		Length numSegments;
+		Length *segmentLengths;
+		long long *segmentResults;
+		ListNode **foundNodePtrs;
+		ListNode **foundPrevNodePtrs;
+		bool isStale;
+	};
+	typedef struct listsegments ListSegments;
+
+	// For the segments [first, last) still to be done by one thread: first in the high 32 bits, last in the low 32 bits.
+	// poolPtr lets the helper thread of the queue find its pool.
+	struct workerqueue {
+		_Alignas (LIST_PARALLEL_CACHE_LINE_SIZE) _Atomic uint64_t range;
+		struct listworkerpool *poolPtr;
+	};
+	typedef struct workerqueue WorkerQueue;
+
+	// One parallel operation, declared in "Linked List/listparallel.c"
+	struct paralleljob;
+
+	// For a pool of worker threads. Thread 0 is whichever thread calls a parallel operation; threads 1 .. numThreads-1
+	// are helpers, waiting for jobNumber to change.
+	struct listworkerpool {
+		pthread_t *helperThreads;
+		WorkerQueue *queues;
+		Length numThreads;
+		pthread_mutex_t lock;
+		pthread_cond_t jobReady;
+		pthread_cond_t jobDone;
+		struct paralleljob *jobPtr;
+		unsigned long jobNumber;
+		Length numBusyHelpers;
+		bool isStopping;
+	};
+	typedef struct listworkerpool ListWorkerPool;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/listparallel.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to worker pools
+	bool InitialiseWorkerPool (ListWorkerPool *poolPtr, Length numThreads);
+	void DestroyWorkerPool (ListWorkerPool *poolPtr);
+
+	// Related to segments of a linked list
+	bool AttachSegments (LinkedList *listPtr, ListSegments *segmentsPtr, Length numSegments);
+	void DetachSegments (ListSegments *segmentsPtr);
+	void RebuildSegments (ListSegments *segmentsPtr);
+
+	// Related to parallel operations on a linked list
+	ListNode *ParallelFindData (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data data, ListNode **prevNodePtrPtr);
+	Length ParallelCountData (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data data);
+	long long ParallelReduce (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, long long identity,
+		long long (*accumulate) (long long result, Data data, void *contextPtr),
+		long long (*combine) (long long firstResult, long long secondResult, void *contextPtr), void *contextPtr);
+	long long ParallelSum (ListWorkerPool *poolPtr, ListSegments *segmentsPtr);
+	bool ParallelMinMax (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data *minDataPtr, Data *maxDataPtr);
+	void ParallelMap (ListWorkerPool *poolPtr, ListSegments *segmentsPtr, Data (*transform) (Data data, void *contextPtr),
+		void *contextPtr);
+
+#endif
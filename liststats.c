@@ -0,0 +1,315 @@
+#include <stdio.h>  		// For input/output
+#include <string.h> 		// For copying and clearing statistics
+#include <time.h>   		// For the monotonic clock
+#include "../liststats.h"	// For type declarations and function declarations related to the statistics of linked list operations
+
+// Names of the operations, in the order of the LIST_OPERATION_ values
+static const char *operationNames[LIST_NUM_OPERATIONS] = {
+	"AddNode", "AddDataAtEnd", "AddDataAtBeginning", "AddDataFromBeginning", "AddDataFromEnd",
+	"AddArrayAtEnd", "AddArrayAtBeginning", "RemoveNode", "RemoveData", "RemoveIf", "RemoveDataSet", "RemoveAllNodes",
+	"ListToArray", "GetNodeAtPosition", "ReverseList", "RotateList", "SortList", "SortListParallel", "AddDataInOrder",
+	"MergeSortedLists", "CursorPosition", "CursorSeek", "CursorInsertBefore", "CursorInsertAfter", "CursorRemove", "CompactList",
+	"FindData", "ContainsData", "CountData", "ConcatLists", "SplitList", "SpliceRange"
+};
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create empty statistics
+ * The statistics are initialised in place (not returned by value, like InitialiseList), because of their size.
+ * Input: statsPtr (ListStats *): pointer to the statistics to initialise
+ * Return value: none
+ * Post-condition: every count and every bucket is 0, no call is in progress
+ * Time complexity: O(LIST_NUM_OPERATIONS * LIST_STATS_NUM_BUCKETS)
+ * Space complexity: O(1)
+ */
+void InitialiseListStats (ListStats *statsPtr) {
+	if (statsPtr == NULL) {
+		printf ("Error: Argument 1 of InitialiseListStats (ListStats *statsPtr) cannot be NULL\n");
+		return;
+	}
+
+	memset (statsPtr, 0, sizeof (ListStats));
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to make a linked list record its operations into given statistics
+ * Inputs: listPtr (LinkedList *): pointer to linked list, statsPtr (ListStats *): statistics to record into
+ * (NULL => stop recording)
+ * Return value: TRUE if the list now records into statsPtr, FALSE if statistics were not compiled in (LIST_STATS 0)
+ * Assumptions: no operation on the list is in progress; statsPtr outlives its use by the list
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool AttachListStats (LinkedList *listPtr, ListStats *statsPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachListStats (LinkedList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	#if LIST_STATS
+		listPtr->statsPtr = statsPtr;
+		return TRUE;
+	#else
+		(void) statsPtr;
+		printf ("Error: AttachListStats needs every file to be compiled with LIST_STATS defined to 1\n");
+		return FALSE;
+	#endif
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to copy statistics, so that they can be read (or compared with a later copy) while the list carries on
+ * Inputs: statsPtr (const ListStats *): statistics to copy, snapshotPtr (ListStats *): receives the copy
+ * Return value: none
+ * Post-condition: *snapshotPtr holds the counts of *statsPtr, with no call in progress
+ * Time complexity: O(LIST_NUM_OPERATIONS * LIST_STATS_NUM_BUCKETS)
+ * Space complexity: O(1)
+ */
+void SnapshotListStats (const ListStats *statsPtr, ListStats *snapshotPtr) {
+	if (statsPtr == NULL) {
+		printf ("Error: Argument 1 of SnapshotListStats (const ListStats *statsPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (snapshotPtr == NULL) {
+		printf ("Error: Argument 2 of SnapshotListStats (ListStats *snapshotPtr) cannot be NULL\n");
+		return;
+	}
+
+	memcpy (snapshotPtr, statsPtr, sizeof (ListStats));
+	snapshotPtr->callDepth = 0;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to empty statistics
+ * A call in progress is still recorded when it ends.
+ * Input: statsPtr (ListStats *): statistics to empty
+ * Return value: none
+ * Post-condition: every count and every bucket is 0
+ * Time complexity: O(LIST_NUM_OPERATIONS * LIST_STATS_NUM_BUCKETS)
+ * Space complexity: O(1)
+ */
+void ResetListStats (ListStats *statsPtr) {
+	if (statsPtr == NULL) {
+		printf ("Error: Argument 1 of ResetListStats (ListStats *statsPtr) cannot be NULL\n");
+		return;
+	}
+
+	memset (statsPtr->operations, 0, sizeof (statsPtr->operations));
+	statsPtr->numNodesAllocated = 0;
+	statsPtr->numNodesFreed = 0;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to find the latency bucket of a number of nanoseconds
+ * Input: nanoseconds (uint64_t)
+ * Return value: index of the bucket, in range [0, LIST_STATS_NUM_BUCKETS-1]
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static Index LatencyBucket (uint64_t nanoseconds) {
+	Index exponent, bucket;
+
+	if (nanoseconds < LIST_STATS_SUB_BUCKETS) {
+		return (Index) nanoseconds;
+	}
+
+	// nanoseconds is in [2^exponent, 2^(exponent+1)), split into 4 by the two bits below the top one
+	exponent = 63 - __builtin_clzll (nanoseconds);
+	bucket = LIST_STATS_SUB_BUCKETS * (exponent-1) + (Index) ((nanoseconds >> (exponent-2)) & (LIST_STATS_SUB_BUCKETS-1));
+
+	return (bucket < LIST_STATS_NUM_BUCKETS) ? bucket : LIST_STATS_NUM_BUCKETS-1;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to find the largest number of nanoseconds counted in a latency bucket
+ * Input: bucket (Index) (int): index of the bucket
+ * Return value: the largest value LatencyBucket maps to bucket (UINT64_MAX for the last bucket)
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static uint64_t BucketUpperBound (Index bucket) {
+	Index exponent;
+
+	if (bucket < LIST_STATS_SUB_BUCKETS) {
+		return (uint64_t) bucket;
+	}
+	if (bucket == LIST_STATS_NUM_BUCKETS-1) {
+		return UINT64_MAX;
+	}
+
+	exponent = bucket / LIST_STATS_SUB_BUCKETS + 1;
+	return ((uint64_t) (LIST_STATS_SUB_BUCKETS + bucket % LIST_STATS_SUB_BUCKETS + 1) << (exponent-2)) - 1;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find a percentile of the latency of an operation
+ * Inputs: operationStatsPtr (const ListOperationStats *): statistics of the operation,
+ * percentile (double): in range [0, 100]
+ * Return value: nanoseconds that at least percentile % of the calls took no longer than (the upper end of the bucket
+ * the percentile falls in, but never more than the longest call); 0 if there were no calls
+ * Time complexity: O(LIST_STATS_NUM_BUCKETS)
+ * Space complexity: O(1)
+ */
+uint64_t ListStatsPercentile (const ListOperationStats *operationStatsPtr, double percentile) {
+	uint64_t numBelow, target, upperBound;
+	Index bucket;
+
+	if (operationStatsPtr == NULL) {
+		printf ("Error: Argument 1 of ListStatsPercentile (const ListOperationStats *operationStatsPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	if (operationStatsPtr->numCalls == 0) {
+		return 0;
+	}
+
+	// the rank of the call at the percentile, from 1 to numCalls
+	target = (uint64_t) (percentile / 100 * operationStatsPtr->numCalls + 0.5);
+	if (target < 1) {
+		target = 1;
+	}
+
+	numBelow = 0;
+	for (bucket = 0; bucket < LIST_STATS_NUM_BUCKETS-1; bucket++) {
+		numBelow += operationStatsPtr->latencyBuckets[bucket];
+		if (numBelow >= target) {
+			break;
+		}
+	}
+
+	upperBound = BucketUpperBound (bucket);
+	return (upperBound < operationStatsPtr->maxNanoseconds) ? upperBound : operationStatsPtr->maxNanoseconds;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find the name of an operation
+ * Input: operation (ListOperation) (int)
+ * Return value: name of the function of "linkedlist.h" the operation stands for, or "?" if it is not an operation
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+const char *ListOperationName (ListOperation operation) {
+	if (operation < 0 || operation >= LIST_NUM_OPERATIONS) {
+		return "?";
+	}
+
+	return operationNames[operation];
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to print statistics: one line for each operation that was called, then the allocation counts
+ * Input: statsPtr (const ListStats *)
+ * Return value: none
+ * Time complexity: O(LIST_NUM_OPERATIONS * LIST_STATS_NUM_BUCKETS)
+ * Space complexity: O(1)
+ */
+void PrintListStats (const ListStats *statsPtr) {
+	const ListOperationStats *operationStatsPtr;
+	ListOperation operation;
+
+	if (statsPtr == NULL) {
+		printf ("Error: Argument 1 of PrintListStats (const ListStats *statsPtr) cannot be NULL\n");
+		return;
+	}
+
+	printf ("%-20s %12s %12s %12s %18s %10s %10s %10s %12s\n", "operation", "calls", "nodes/call", "max nodes",
+		"max nodes caller", "p50 ns", "p99 ns", "max ns", "mean ns");
+
+	for (operation = 0; operation < LIST_NUM_OPERATIONS; operation++) {
+		operationStatsPtr = &(statsPtr->operations[operation]);
+		if (operationStatsPtr->numCalls == 0) {
+			continue;
+		}
+
+		printf ("%-20s %12llu %12.1f %12llu %18p %10llu %10llu %10llu %12.1f\n", ListOperationName (operation),
+			(unsigned long long) operationStatsPtr->numCalls,
+			(double) operationStatsPtr->numNodesTraversed / operationStatsPtr->numCalls,
+			(unsigned long long) operationStatsPtr->maxNodesTraversed, operationStatsPtr->maxCallerPtr,
+			(unsigned long long) ListStatsPercentile (operationStatsPtr, 50),
+			(unsigned long long) ListStatsPercentile (operationStatsPtr, 99),
+			(unsigned long long) operationStatsPtr->maxNanoseconds,
+			(double) operationStatsPtr->totalNanoseconds / operationStatsPtr->numCalls);
+	}
+
+	printf ("nodes allocated: %llu, nodes freed: %llu\n", (unsigned long long) statsPtr->numNodesAllocated,
+		(unsigned long long) statsPtr->numNodesFreed);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to read the monotonic clock
+ * Return value: nanoseconds since an arbitrary start
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static uint64_t Nanoseconds (void) {
+	struct timespec now;
+
+	clock_gettime (CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to record the start of an operation (through LIST_STATS_BEGIN)
+ * An operation started while another is in progress (one operation calling another) is counted as part of that one.
+ * Inputs: statsPtr (ListStats *), operation (ListOperation) (int), callerPtr (const void *): return address of the
+ * operation, i.e. where its caller called it from
+ * Return value: none
+ * Assumptions: statsPtr != NULL, every ListStatsBegin is matched by one ListStatsEnd
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void ListStatsBegin (ListStats *statsPtr, ListOperation operation, const void *callerPtr) {
+	if ((statsPtr->callDepth)++ > 0) {
+		return;
+	}
+
+	statsPtr->callOperation = operation;
+	statsPtr->callerPtr = callerPtr;
+	statsPtr->callNodesTraversed = 0;
+	statsPtr->callStartNanoseconds = Nanoseconds ();
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to record the end of an operation (through LIST_STATS_END)
+ * Input: statsPtr (ListStats *)
+ * Return value: none
+ * Post-condition: if this ends the outermost operation in progress, its call, nodes walked and latency are counted
+ * Assumptions: statsPtr != NULL, an operation is in progress
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void ListStatsEnd (ListStats *statsPtr) {
+	ListOperationStats *operationStatsPtr;
+	uint64_t nanoseconds;
+
+	if (--(statsPtr->callDepth) > 0) {
+		return;
+	}
+
+	nanoseconds = Nanoseconds () - statsPtr->callStartNanoseconds;
+	operationStatsPtr = &(statsPtr->operations[statsPtr->callOperation]);
+
+	(operationStatsPtr->numCalls)++;
+	operationStatsPtr->numNodesTraversed += statsPtr->callNodesTraversed;
+	if (statsPtr->callNodesTraversed > operationStatsPtr->maxNodesTraversed || operationStatsPtr->maxCallerPtr == NULL) {
+		operationStatsPtr->maxNodesTraversed = statsPtr->callNodesTraversed;
+		operationStatsPtr->maxCallerPtr = statsPtr->callerPtr;
+	}
+
+	operationStatsPtr->totalNanoseconds += nanoseconds;
+	if (nanoseconds > operationStatsPtr->maxNanoseconds) {
+		operationStatsPtr->maxNanoseconds = nanoseconds;
+	}
+	(operationStatsPtr->latencyBuckets[LatencyBucket (nanoseconds)])++;
+}
@@ -0,0 +1,176 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the statistics of linked list operations.
+ * With LIST_STATS defined to 1 (for every file, e.g. -DLIST_STATS=1), a linked list can record into a ListStats:
+ * how often each operation of "linkedlist.h" is called, how many nodes each call walks over, the latency of each call
+ * (in a histogram), and how many nodes are allocated and freed. For each operation, the return address of the call that
+ * walked the most nodes is kept too, so that the callers hitting the O(n) paths (AddDataFromBeginning, RemoveData, ...)
+ * can be found (e.g. with addr2line).
+ * With LIST_STATS 0 (the default), linked lists have no statistics pointer and the operations contain no statistics
+ * code at all; the functions below still exist, but AttachListStats refuses and nothing is ever recorded.
+ *
+ * Latencies are counted in log-linear buckets (as in HDR histograms): values 0 to 3 ns have a bucket each, and every
+ * power of two above that is split into LIST_STATS_SUB_BUCKETS buckets, so each bucket is within 25% of its values.
+ * Calls made from inside another operation (AddDataAtEnd calling AddNode, ...) count as part of the outer call only.
+ * A ListStats may be shared by several lists, but, like the lists themselves, must be used by one thread at a time.
+ *
+ * The following types are declared in this file:
+ * a) ListOperation: For the operation a statistic is about. Another name for int, taking one of the values
+ *    LIST_OPERATION_ADD_NODE ... LIST_OPERATION_COUNT_DATA below
+ * b) struct listoperationstats (ListOperationStats): a structure representing the statistics of one operation.
+ *    Contains the number of calls, the nodes walked over, the caller that walked the most, and the latency histogram
+ * c) struct liststats (ListStats): a structure representing the statistics of a linked list (or several).
+ *    Contains the statistics of every operation, the numbers of nodes allocated and freed, and the state of the call
+ *    in progress
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to initialising and attaching statistics
+ * a) InitialiseListStats: Function to create empty statistics
+ * b) AttachListStats: Function to make a linked list record its operations into given statistics
+ *
+ * Related to reading statistics
+ * c) SnapshotListStats: Function to copy statistics, so that they can be read while the list carries on
+ * d) ResetListStats: Function to empty statistics
+ * e) ListStatsPercentile: Function to find a percentile of the latency of an operation
+ * f) ListOperationName: Function to find the name of an operation
+ * g) PrintListStats: Function to print statistics
+ *
+ * Related to recording statistics (used by "Linked List/linkedlist.c", through the LIST_STATS_ macros below)
+ * h) ListStatsBegin: Function to record the start of an operation
+ * i) ListStatsEnd: Function to record the end of an operation
+ *
+ * All of the above functions are defined in "Linked List/liststats.c". For more details, see there.
+ */
+
+#ifndef LISTSTATS_H
+#define LISTSTATS_H
+
+	#include <stdint.h>
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// For the operation a statistic is about
+	typedef int ListOperation;
+	#define LIST_OPERATION_ADD_NODE 0
+	#define LIST_OPERATION_ADD_DATA_AT_END 1
+	#define LIST_OPERATION_ADD_DATA_AT_BEGINNING 2
+	#define LIST_OPERATION_ADD_DATA_FROM_BEGINNING 3
+	#define LIST_OPERATION_ADD_DATA_FROM_END 4
+	#define LIST_OPERATION_ADD_ARRAY_AT_END 5
+	#define LIST_OPERATION_ADD_ARRAY_AT_BEGINNING 6
+	#define LIST_OPERATION_REMOVE_NODE 7
+	#define LIST_OPERATION_REMOVE_DATA 8
+	#define LIST_OPERATION_REMOVE_IF 9
+	#define LIST_OPERATION_REMOVE_DATA_SET 10
+	#define LIST_OPERATION_REMOVE_ALL_NODES 11
+	#define LIST_OPERATION_LIST_TO_ARRAY 12
+	#define LIST_OPERATION_GET_NODE_AT_POSITION 13
+	#define LIST_OPERATION_REVERSE 14
+	#define LIST_OPERATION_ROTATE 15
+	#define LIST_OPERATION_SORT 16
+	#define LIST_OPERATION_SORT_PARALLEL 17
+	#define LIST_OPERATION_ADD_DATA_IN_ORDER 18
+	#define LIST_OPERATION_MERGE 19
+	#define LIST_OPERATION_CURSOR_POSITION 20
+	#define LIST_OPERATION_CURSOR_SEEK 21
+	#define LIST_OPERATION_CURSOR_INSERT_BEFORE 22
+	#define LIST_OPERATION_CURSOR_INSERT_AFTER 23
+	#define LIST_OPERATION_CURSOR_REMOVE 24
+	#define LIST_OPERATION_COMPACT 25
+	#define LIST_OPERATION_FIND_DATA 26
+	#define LIST_OPERATION_CONTAINS_DATA 27
+	#define LIST_OPERATION_COUNT_DATA 28
+	#define LIST_OPERATION_CONCAT 29
+	#define LIST_OPERATION_SPLIT 30
+	#define LIST_OPERATION_SPLICE 31
+	#define LIST_NUM_OPERATIONS 32
+
+	// Latency histogram: 4 buckets per power of two, up to about 8.6 seconds (longer calls go in the last bucket)
+	#define LIST_STATS_SUB_BUCKETS 4
+	#define LIST_STATS_NUM_BUCKETS 128
+
+	// For the statistics of one operation
+	struct listoperationstats {
+		uint64_t numCalls;
+		uint64_t numNodesTraversed;
+		uint64_t maxNodesTraversed;
+		const void *maxCallerPtr;
+		uint64_t totalNanoseconds;
+		uint64_t maxNanoseconds;
+		uint64_t latencyBuckets[LIST_STATS_NUM_BUCKETS];
+	};
+	typedef struct listoperationstats ListOperationStats;
+
+	// For the statistics of a linked list. The call fields describe the (outermost) operation in progress.
+	struct liststats {
+		ListOperationStats operations[LIST_NUM_OPERATIONS];
+		uint64_t numNodesAllocated;
+		uint64_t numNodesFreed;
+		Length callDepth;
+		ListOperation callOperation;
+		const void *callerPtr;
+		uint64_t callStartNanoseconds;
+		uint64_t callNodesTraversed;
+	};
+	typedef struct liststats ListStats;
+
+	/*
+	 * Macros used by "Linked List/linkedlist.c" to record statistics. With LIST_STATS 0 they expand to nothing.
+	 * LIST_STATS_BEGIN and LIST_STATS_END bracket an operation (every return after LIST_STATS_BEGIN needs a
+	 * LIST_STATS_END); LIST_STATS_TRAVERSED adds to the nodes walked by the call in progress; LIST_STATS_ALLOCATED and
+	 * LIST_STATS_FREED count nodes allocated and freed.
+	 */
+	#if LIST_STATS
+		#if defined (__GNUC__)
+			#define LIST_STATS_CALLER() __builtin_return_address (0)
+		#else
+			#define LIST_STATS_CALLER() NULL
+		#endif
+
+		#define LIST_STATS_BEGIN(listPtr, operation) \
+			do { if ((listPtr)->statsPtr != NULL) ListStatsBegin ((listPtr)->statsPtr, (operation), LIST_STATS_CALLER ()); } while (0)
+		#define LIST_STATS_END(listPtr) \
+			do { if ((listPtr)->statsPtr != NULL) ListStatsEnd ((listPtr)->statsPtr); } while (0)
+		#define LIST_STATS_TRAVERSED(listPtr, numNodes) \
+			do { if ((listPtr)->statsPtr != NULL) (listPtr)->statsPtr->callNodesTraversed += (numNodes); } while (0)
+		#define LIST_STATS_ALLOCATED(listPtr, numNodes) \
+			do { if ((listPtr)->statsPtr != NULL) (listPtr)->statsPtr->numNodesAllocated += (numNodes); } while (0)
+		#define LIST_STATS_FREED(listPtr, numNodes) \
+			do { if ((listPtr)->statsPtr != NULL) (listPtr)->statsPtr->numNodesFreed += (numNodes); } while (0)
+	#else
+		#define LIST_STATS_BEGIN(listPtr, operation) ((void) 0)
+		#define LIST_STATS_END(listPtr) ((void) 0)
+		#define LIST_STATS_TRAVERSED(listPtr, numNodes) ((void) 0)
+		#define LIST_STATS_ALLOCATED(listPtr, numNodes) ((void) 0)
+		#define LIST_STATS_FREED(listPtr, numNodes) ((void) 0)
+	#endif
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/liststats.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to initialising and attaching statistics
+	void InitialiseListStats (ListStats *statsPtr);
+	bool AttachListStats (LinkedList *listPtr, ListStats *statsPtr);
+
+	// Related to reading statistics
+	void SnapshotListStats (const ListStats *statsPtr, ListStats *snapshotPtr);
+	void ResetListStats (ListStats *statsPtr);
+	uint64_t ListStatsPercentile (const ListOperationStats *operationStatsPtr, double percentile);
+	const char *ListOperationName (ListOperation operation);
+	void PrintListStats (const ListStats *statsPtr);
+
+	// Related to recording statistics
+	void ListStatsBegin (ListStats *statsPtr, ListOperation operation, const void *callerPtr);
+	void ListStatsEnd (ListStats *statsPtr);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
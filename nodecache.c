@@ -0,0 +1,511 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include "../nodecache.h"	// For type declarations and function declarations related to the node cache allocator
+
+#define SLOT_MASK 0xFFFFFFFFu	// Low 32 bits of a depot stack: 1 + the index of the top slot
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to push a magazine slot onto a stack of the depot
+ * Inputs: stackPtr (_Atomic uint64_t *): the stack, slots (NodeMagazine *): the slots of the depot, slot (Index) (int):
+ * index of the slot to push
+ * Return value: none
+ * Assumptions: the calling thread owns the slot (it popped it, and it is on neither stack)
+ * Time complexity: O(1) (lock-free: retried only when another thread changed the stack in between)
+ * Space complexity: O(1)
+ */
+static void PushSlot (_Atomic uint64_t *stackPtr, NodeMagazine *slots, Index slot) {
+	uint64_t top, newTop;
+
+	top = atomic_load_explicit (stackPtr, memory_order_relaxed);
+	do {
+		atomic_store_explicit (&(slots[slot].nextSlot), (uint32_t) (top & SLOT_MASK), memory_order_relaxed);
+		newTop = (((top >> 32) + 1) << 32) | (uint64_t) (slot + 1);
+	} while (!atomic_compare_exchange_weak_explicit (stackPtr, &top, newTop, memory_order_release, memory_order_relaxed));
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to pop a magazine slot off a stack of the depot
+ * The counter in the high bits changes on every push and pop, so if the top slot is popped and pushed back between
+ * this thread reading it and swapping it out, the swap fails rather than putting a stale slot on top.
+ * Inputs: stackPtr (_Atomic uint64_t *): the stack, slots (NodeMagazine *): the slots of the depot
+ * Return value: index of the slot popped (now owned by the calling thread), or -1 if the stack is empty
+ * Time complexity: O(1) (lock-free: retried only when another thread changed the stack in between)
+ * Space complexity: O(1)
+ */
+static Index PopSlot (_Atomic uint64_t *stackPtr, NodeMagazine *slots) {
+	uint64_t top, newTop;
+	Index slot;
+
+	top = atomic_load_explicit (stackPtr, memory_order_acquire);
+	while ((top & SLOT_MASK) != 0) {
+		slot = (Index) (top & SLOT_MASK) - 1;
+		newTop = (((top >> 32) + 1) << 32) | atomic_load_explicit (&(slots[slot].nextSlot), memory_order_relaxed);
+		if (atomic_compare_exchange_weak_explicit (stackPtr, &top, newTop, memory_order_acquire, memory_order_acquire)) {
+			return slot;
+		}
+	}
+	return -1;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to free a chain of nodes
+ * Inputs: firstNodePtr (ListNode *): first node of the chain, numNodes (Length) (int): number of nodes in the chain
+ * Return value: none
+ * Time complexity: O(numNodes)
+ * Space complexity: O(1)
+ */
+static void FreeNodes (ListNode *firstNodePtr, Length numNodes) {
+	ListNode *nextNodePtr;
+
+	while (numNodes > 0) {
+		nextNodePtr = firstNodePtr->nextNodePtr;
+		free (firstNodePtr);
+		firstNodePtr = nextNodePtr;
+		numNodes--;
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to hand a magazine over to the depot of a node cache, freeing its nodes if the depot is full
+ * Inputs: cachePtr (NodeCache *): pointer to node cache, firstNodePtr (ListNode *): first node of the magazine,
+ * numNodes (Length) (int): number of nodes in the magazine
+ * Return value: none
+ * Assumptions: cachePtr != NULL
+ * Time complexity: O(1), O(numNodes) if the depot is full
+ * Space complexity: O(1)
+ */
+static void PutMagazine (NodeCache *cachePtr, ListNode *firstNodePtr, Length numNodes) {
+	Index slot;
+
+	if (numNodes == 0) {
+		return;
+	}
+
+	slot = PopSlot (&(cachePtr->freeStack), cachePtr->slots);
+	if (slot < 0) {
+		FreeNodes (firstNodePtr, numNodes);
+		return;
+	}
+
+	cachePtr->slots[slot].firstNodePtr = firstNodePtr;
+	cachePtr->slots[slot].numNodes = numNodes;
+	PushSlot (&(cachePtr->fullStack), cachePtr->slots, slot);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to take a magazine from the depot of a node cache
+ * Inputs: cachePtr (NodeCache *): pointer to node cache, firstNodePtrPtr (ListNode **): receives the first node of
+ * the magazine
+ * Return value: number of nodes in the magazine (0 if the depot is empty)
+ * Assumptions: cachePtr != NULL, firstNodePtrPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static Length GetMagazine (NodeCache *cachePtr, ListNode **firstNodePtrPtr) {
+	Length numNodes;
+	Index slot;
+
+	slot = PopSlot (&(cachePtr->fullStack), cachePtr->slots);
+	if (slot < 0) {
+		return 0;
+	}
+
+	*firstNodePtrPtr = cachePtr->slots[slot].firstNodePtr;
+	numNodes = cachePtr->slots[slot].numNodes;
+	PushSlot (&(cachePtr->freeStack), cachePtr->slots, slot);
+	return numNodes;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to hand both magazines of a thread over to the depot of its node cache
+ * Input: threadCachePtr (ThreadNodeCache *): the magazines of the thread
+ * Return value: none
+ * Post-condition: both magazines are empty
+ * Assumptions: threadCachePtr != NULL
+ * Time complexity: O(1), O(magazineSize) if the depot is full
+ * Space complexity: O(1)
+ */
+static void FlushThreadNodeCache (ThreadNodeCache *threadCachePtr) {
+	PutMagazine (threadCachePtr->cachePtr, threadCachePtr->loadedNodePtr, threadCachePtr->numLoaded);
+	PutMagazine (threadCachePtr->cachePtr, threadCachePtr->previousNodePtr, threadCachePtr->numPrevious);
+	threadCachePtr->loadedNodePtr = NULL;
+	threadCachePtr->numLoaded = 0;
+	threadCachePtr->previousNodePtr = NULL;
+	threadCachePtr->numPrevious = 0;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function run when a thread that has used a node cache exits: hands its magazines over to the depot, and
+ * frees them
+ * Input: argPtr (void *): the ThreadNodeCache of the thread
+ * Return value: none
+ * Time complexity: O(1), O(magazineSize) if the depot is full
+ * Space complexity: O(1)
+ */
+static void ExitThreadNodeCache (void *argPtr) {
+	ThreadNodeCache *threadCachePtr = (ThreadNodeCache *) argPtr;
+	NodeCache *cachePtr = threadCachePtr->cachePtr;
+
+	FlushThreadNodeCache (threadCachePtr);
+
+	pthread_mutex_lock (&(cachePtr->threadListLock));
+	if (threadCachePtr->prevThreadCachePtr != NULL) {
+		threadCachePtr->prevThreadCachePtr->nextThreadCachePtr = threadCachePtr->nextThreadCachePtr;
+	}
+	else {
+		cachePtr->threadCacheListPtr = threadCachePtr->nextThreadCachePtr;
+	}
+	if (threadCachePtr->nextThreadCachePtr != NULL) {
+		threadCachePtr->nextThreadCachePtr->prevThreadCachePtr = threadCachePtr->prevThreadCachePtr;
+	}
+	pthread_mutex_unlock (&(cachePtr->threadListLock));
+
+	free (threadCachePtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to find the magazines of the calling thread, creating them on the thread's first use of the cache
+ * Input: cachePtr (NodeCache *): pointer to node cache
+ * Return value: the magazines of the calling thread, or NULL if they could not be allocated
+ * Assumptions: cachePtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static ThreadNodeCache *GetThreadNodeCache (NodeCache *cachePtr) {
+	ThreadNodeCache *threadCachePtr;
+
+	threadCachePtr = (ThreadNodeCache *) pthread_getspecific (cachePtr->threadKey);
+	if (threadCachePtr != NULL) {
+		return threadCachePtr;
+	}
+
+	threadCachePtr = (ThreadNodeCache *) malloc (sizeof (ThreadNodeCache));
+	if (threadCachePtr == NULL) {
+		return NULL;
+	}
+	threadCachePtr->cachePtr = cachePtr;
+	threadCachePtr->loadedNodePtr = NULL;
+	threadCachePtr->numLoaded = 0;
+	threadCachePtr->previousNodePtr = NULL;
+	threadCachePtr->numPrevious = 0;
+	threadCachePtr->prevThreadCachePtr = NULL;
+
+	if (pthread_setspecific (cachePtr->threadKey, threadCachePtr) != 0) {
+		free (threadCachePtr);
+		return NULL;
+	}
+
+	pthread_mutex_lock (&(cachePtr->threadListLock));
+	threadCachePtr->nextThreadCachePtr = cachePtr->threadCacheListPtr;
+	if (cachePtr->threadCacheListPtr != NULL) {
+		cachePtr->threadCacheListPtr->prevThreadCachePtr = threadCachePtr;
+	}
+	cachePtr->threadCacheListPtr = threadCachePtr;
+	pthread_mutex_unlock (&(cachePtr->threadListLock));
+
+	return threadCachePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to put a free node into the magazines of a thread
+ * If the loaded magazine is full, it becomes the previous magazine: swapped with it if that is empty, and otherwise
+ * after the (full) previous magazine goes to the depot.
+ * Inputs: threadCachePtr (ThreadNodeCache *): the magazines of the calling thread, nodePtr (ListNode *): node to free
+ * Return value: none
+ * Assumptions: threadCachePtr != NULL, nodePtr != NULL
+ * Time complexity: O(1), O(magazineSize) if the depot is full
+ * Space complexity: O(1)
+ */
+static void FreeIntoThreadNodeCache (ThreadNodeCache *threadCachePtr, ListNode *nodePtr) {
+	if (threadCachePtr->numLoaded == threadCachePtr->cachePtr->magazineSize) {
+		if (threadCachePtr->numPrevious != 0) {
+			PutMagazine (threadCachePtr->cachePtr, threadCachePtr->previousNodePtr, threadCachePtr->numPrevious);
+		}
+		threadCachePtr->previousNodePtr = threadCachePtr->loadedNodePtr;
+		threadCachePtr->numPrevious = threadCachePtr->numLoaded;
+		threadCachePtr->loadedNodePtr = NULL;
+		threadCachePtr->numLoaded = 0;
+	}
+
+	nodePtr->nextNodePtr = threadCachePtr->loadedNodePtr;
+	threadCachePtr->loadedNodePtr = nodePtr;
+	(threadCachePtr->numLoaded)++;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to create an empty node cache
+ * Inputs: cachePtr (NodeCache *): pointer to the node cache to initialise, magazineSize (Length) (int): number of nodes
+ * in a full magazine, depotSize (Length) (int): number of magazines the depot can hold (further magazines handed over
+ * to a full depot are freed). If not positive, NODE_CACHE_DEFAULT_MAGAZINE_SIZE and NODE_CACHE_DEFAULT_DEPOT_SIZE are used.
+ * Return value: TRUE if the cache was made, FALSE if it could not be allocated
+ * Post-condition: if TRUE, the cache holds no nodes, and must be let go of with DestroyNodeCache
+ * Assumptions: cachePtr != NULL
+ * Time complexity: O(depotSize)
+ * Space complexity: O(depotSize)
+ */
+bool InitialiseNodeCache (NodeCache *cachePtr, Length magazineSize, Length depotSize) {
+	Index i;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of InitialiseNodeCache (NodeCache *cachePtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	cachePtr->magazineSize = (magazineSize > 0) ? magazineSize : NODE_CACHE_DEFAULT_MAGAZINE_SIZE;
+	cachePtr->numSlots = (depotSize > 0) ? depotSize : NODE_CACHE_DEFAULT_DEPOT_SIZE;
+	cachePtr->threadCacheListPtr = NULL;
+
+	cachePtr->slots = (NodeMagazine *) malloc (cachePtr->numSlots * sizeof (NodeMagazine));
+	if (cachePtr->slots == NULL) {
+		printf ("Error: InitialiseNodeCache could not allocate a depot of %d magazines\n", cachePtr->numSlots);
+		return FALSE;
+	}
+	if (pthread_key_create (&(cachePtr->threadKey), ExitThreadNodeCache) != 0) {
+		printf ("Error: InitialiseNodeCache could not create a thread-specific key\n");
+		free (cachePtr->slots);
+		return FALSE;
+	}
+	pthread_mutex_init (&(cachePtr->threadListLock), NULL);
+
+	// every slot starts on the free stack, slot i on top of slot i-1
+	for (i = 0; i < cachePtr->numSlots; i++) {
+		cachePtr->slots[i].firstNodePtr = NULL;
+		cachePtr->slots[i].numNodes = 0;
+		atomic_init (&(cachePtr->slots[i].nextSlot), (uint32_t) i);
+	}
+	atomic_init (&(cachePtr->freeStack), (uint64_t) cachePtr->numSlots);
+	atomic_init (&(cachePtr->fullStack), 0);
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to free every node held by a node cache: those in the depot and those in the magazines of every thread
+ * Input: cachePtr (NodeCache *): pointer to node cache
+ * Return value: none
+ * Post-condition: the cache must be initialised again before it is used
+ * Assumptions: cachePtr != NULL, no thread is using the cache, and no linked list still takes its nodes from it
+ * Time complexity: O(number of nodes held + number of threads that have used the cache)
+ * Space complexity: O(1)
+ */
+void DestroyNodeCache (NodeCache *cachePtr) {
+	ThreadNodeCache *threadCachePtr, *nextThreadCachePtr;
+	ListNode *firstNodePtr;
+	Length numNodes;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of DestroyNodeCache (NodeCache *cachePtr) cannot be NULL\n");
+		return;
+	}
+
+	// threads still running will not run ExitThreadNodeCache once the key is gone, so their magazines are freed here
+	pthread_setspecific (cachePtr->threadKey, NULL);
+	pthread_key_delete (cachePtr->threadKey);
+	for (threadCachePtr = cachePtr->threadCacheListPtr; threadCachePtr != NULL; threadCachePtr = nextThreadCachePtr) {
+		nextThreadCachePtr = threadCachePtr->nextThreadCachePtr;
+		FreeNodes (threadCachePtr->loadedNodePtr, threadCachePtr->numLoaded);
+		FreeNodes (threadCachePtr->previousNodePtr, threadCachePtr->numPrevious);
+		free (threadCachePtr);
+	}
+	cachePtr->threadCacheListPtr = NULL;
+
+	while ((numNodes = GetMagazine (cachePtr, &firstNodePtr)) > 0) {
+		FreeNodes (firstNodePtr, numNodes);
+	}
+
+	pthread_mutex_destroy (&(cachePtr->threadListLock));
+	free (cachePtr->slots);
+	cachePtr->slots = NULL;
+	cachePtr->numSlots = 0;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to take one node from a node cache
+ * The node comes from the loaded magazine of the calling thread. If that is empty, the previous magazine takes its
+ * place if it is full, and otherwise a full magazine is taken from the depot. Only if the depot is empty too is the
+ * node malloc-ed.
+ * Input: cachePtr (NodeCache *): pointer to node cache
+ * Return value: pointer to an uninitialised node, or NULL if allocation failed
+ * Assumptions: cachePtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+ListNode *AllocateCachedNode (NodeCache *cachePtr) {
+	ThreadNodeCache *threadCachePtr;
+	ListNode *nodePtr;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of AllocateCachedNode (NodeCache *cachePtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	threadCachePtr = GetThreadNodeCache (cachePtr);
+	if (threadCachePtr == NULL) {
+		return (ListNode *) malloc (sizeof (ListNode));
+	}
+
+	if (threadCachePtr->numLoaded == 0) {
+		if (threadCachePtr->numPrevious != 0) {
+			threadCachePtr->loadedNodePtr = threadCachePtr->previousNodePtr;
+			threadCachePtr->numLoaded = threadCachePtr->numPrevious;
+			threadCachePtr->previousNodePtr = NULL;
+			threadCachePtr->numPrevious = 0;
+		}
+		else {
+			threadCachePtr->numLoaded = GetMagazine (cachePtr, &(threadCachePtr->loadedNodePtr));
+			if (threadCachePtr->numLoaded == 0) {
+				return (ListNode *) malloc (sizeof (ListNode));
+			}
+		}
+	}
+
+	nodePtr = threadCachePtr->loadedNodePtr;
+	threadCachePtr->loadedNodePtr = nodePtr->nextNodePtr;
+	(threadCachePtr->numLoaded)--;
+	return nodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to return one node to a node cache
+ * Inputs: cachePtr (NodeCache *): pointer to node cache, nodePtr (ListNode *): node to free
+ * Return value: none
+ * Post-condition: nodePtr is in the loaded magazine of the calling thread (or free-d, if the magazines of the thread
+ * could not be allocated)
+ * Assumptions: cachePtr != NULL, nodePtr was malloc-ed (by any node cache, or directly) and is not in use any more
+ * Time complexity: O(1), O(magazineSize) if a magazine is handed to a full depot
+ * Space complexity: O(1)
+ */
+void FreeCachedNode (NodeCache *cachePtr, ListNode *nodePtr) {
+	ThreadNodeCache *threadCachePtr;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of FreeCachedNode (NodeCache *cachePtr) cannot be NULL\n");
+		return;
+	}
+
+	if (nodePtr == NULL) {
+		return;
+	}
+
+	threadCachePtr = GetThreadNodeCache (cachePtr);
+	if (threadCachePtr == NULL) {
+		free (nodePtr);
+		return;
+	}
+
+	FreeIntoThreadNodeCache (threadCachePtr, nodePtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to return a chain of nodes to a node cache
+ * Inputs: cachePtr (NodeCache *): pointer to node cache, firstNodePtr (ListNode *): first node of a chain linked
+ * through nextNodePtr (the last node's nextNodePtr is ignored), numNodes (Length) (int): number of nodes in the chain
+ * Return value: none
+ * Assumptions: cachePtr != NULL, the nodes were malloc-ed (by any node cache, or directly) and are not in use any more
+ * Time complexity: O(numNodes)
+ * Space complexity: O(1)
+ */
+void FreeCachedNodeChain (NodeCache *cachePtr, ListNode *firstNodePtr, Length numNodes) {
+	ThreadNodeCache *threadCachePtr;
+	ListNode *nextNodePtr;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of FreeCachedNodeChain (NodeCache *cachePtr) cannot be NULL\n");
+		return;
+	}
+
+	threadCachePtr = GetThreadNodeCache (cachePtr);
+	if (threadCachePtr == NULL) {
+		FreeNodes (firstNodePtr, numNodes);
+		return;
+	}
+
+	while (numNodes > 0) {
+		nextNodePtr = firstNodePtr->nextNodePtr;
+		FreeIntoThreadNodeCache (threadCachePtr, firstNodePtr);
+		firstNodePtr = nextNodePtr;
+		numNodes--;
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to hand the magazines of the calling thread over to the depot, where other threads can take them
+ * Useful before a thread that freed many nodes goes idle. Threads hand their magazines over on exit anyway.
+ * Input: cachePtr (NodeCache *): pointer to node cache
+ * Return value: none
+ * Post-condition: the calling thread holds no nodes of the cache
+ * Assumptions: cachePtr != NULL
+ * Time complexity: O(1), O(magazineSize) if the depot is full
+ * Space complexity: O(1)
+ */
+void DrainNodeCache (NodeCache *cachePtr) {
+	ThreadNodeCache *threadCachePtr;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of DrainNodeCache (NodeCache *cachePtr) cannot be NULL\n");
+		return;
+	}
+
+	threadCachePtr = (ThreadNodeCache *) pthread_getspecific (cachePtr->threadKey);
+	if (threadCachePtr != NULL) {
+		FlushThreadNodeCache (threadCachePtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to free the nodes of the depot beyond a given number of magazines
+ * The magazines the depot holds are taken out all at once; numMagazinesToKeep of them are put back, and the nodes of the
+ * rest are free-d. Other threads may keep using the cache meanwhile. The magazines of the threads are not touched
+ * (see DrainNodeCache).
+ * Inputs: cachePtr (NodeCache *): pointer to node cache, numMagazinesToKeep (Length) (int): number of magazines to keep
+ * Return value: number of nodes free-d
+ * Assumptions: cachePtr != NULL
+ * Time complexity: O(number of magazines in the depot + number of nodes free-d)
+ * Space complexity: O(1)
+ */
+Length TrimNodeCache (NodeCache *cachePtr, Length numMagazinesToKeep) {
+	Length numFreed = 0;
+	Index slot, nextSlot = -1;
+
+	if (cachePtr == NULL) {
+		printf ("Error: Argument 1 of TrimNodeCache (NodeCache *cachePtr) cannot be NULL\n");
+		return 0;
+	}
+
+	// the slots taken out are chained through nextSlot, which is free to use while this thread owns them
+	while ((slot = PopSlot (&(cachePtr->fullStack), cachePtr->slots)) >= 0) {
+		atomic_store_explicit (&(cachePtr->slots[slot].nextSlot), (uint32_t) (nextSlot + 1), memory_order_relaxed);
+		nextSlot = slot;
+	}
+
+	for (slot = nextSlot; slot >= 0; slot = nextSlot) {
+		nextSlot = (Index) atomic_load_explicit (&(cachePtr->slots[slot].nextSlot), memory_order_relaxed) - 1;
+		if (numMagazinesToKeep > 0) {
+			PushSlot (&(cachePtr->fullStack), cachePtr->slots, slot);
+			numMagazinesToKeep--;
+		}
+		else {
+			FreeNodes (cachePtr->slots[slot].firstNodePtr, cachePtr->slots[slot].numNodes);
+			numFreed += cachePtr->slots[slot].numNodes;
+			PushSlot (&(cachePtr->freeStack), cachePtr->slots, slot);
+		}
+	}
+
+	return numFreed;
+}
@@ -0,0 +1,113 @@
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the node cache allocator.
+ * A node cache keeps freed linked list nodes for reuse, so that threads adding and removing nodes do not go to malloc
+ * and free (and contend on their locks) for every node. Each thread has two magazines of its own: chains of up to
+ * magazineSize free nodes, from which it allocates and into which it frees without any synchronisation. A thread whose
+ * magazines are both full hands one over to the depot, shared by all threads; a thread whose magazines are both empty
+ * takes a full one from the depot, and only mallocs a node when the depot is empty too. So a producer thread allocating
+ * nodes and a consumer thread freeing them trade whole magazines through the depot, one atomic operation per
+ * magazineSize nodes. The depot is two lock-free stacks of magazine slots (full ones and free ones), with a counter next
+ * to the top index so that a slot popped and pushed back in between cannot fool another thread's pop.
+ *
+ * The nodes of a node cache are malloc-ed one at a time, so a node from a cache may be free-d, and a malloc-ed node may
+ * be freed into a cache. Lists with and without a node cache can therefore exchange nodes (ConcatLists, SpliceRange,
+ * ...) like lists that all malloc their nodes.
+ *
+ * The following types are declared in this file:
+ * a) struct nodemagazine (NodeMagazine): a structure representing one magazine slot of the depot. Contains a chain of
+ *    free nodes, their number and the slot below it on its stack
+ * b) struct threadnodecache (ThreadNodeCache): a structure representing the magazines of one thread. Contains the
+ *    loaded magazine, the previous magazine (always either full or empty) and links to the other threads' magazines
+ * c) struct nodecache (NodeCache): a structure representing a node cache. Contains the magazine size, the depot, and
+ *    the key and list through which the magazines of each thread are found
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to initialising node caches
+ * a) InitialiseNodeCache: Function to create an empty node cache
+ * b) DestroyNodeCache: Function to free every node held by a node cache
+ *
+ * Related to allocating and freeing nodes
+ * c) AllocateCachedNode: Function to take one node from a node cache
+ * d) FreeCachedNode: Function to return one node to a node cache
+ * e) FreeCachedNodeChain: Function to return a chain of nodes to a node cache
+ *
+ * Related to the memory held by a node cache
+ * f) DrainNodeCache: Function to hand the magazines of the calling thread over to the depot
+ * g) TrimNodeCache: Function to free the nodes of the depot beyond a given number of magazines
+ *
+ * A node cache is attached to a linked list with AttachNodeCache (see "linkedlist.h").
+ * All of the above functions are defined in "Linked List/nodecache.c". For more details, see there.
+ */
+
+#ifndef NODECACHE_H
+#define NODECACHE_H
+
+	#include <stdint.h>
+	#include <stdatomic.h>
+	#include <pthread.h>
+	#include "linkedlist.h"
+
+	// Number of nodes in one magazine, when the caller does not ask for a particular size
+	#define NODE_CACHE_DEFAULT_MAGAZINE_SIZE 64
+
+	// Number of magazines the depot can hold, when the caller does not ask for a particular number
+	#define NODE_CACHE_DEFAULT_DEPOT_SIZE 1024
+
+	// Size of a cache line in bytes, to keep the two stacks of the depot apart
+	#define NODE_CACHE_LINE_SIZE 64
+
+	// For one magazine slot of the depot. nextSlot is 1 + the index of the slot below it on its stack (0 => bottom).
+	struct nodemagazine {
+		ListNode *firstNodePtr;
+		Length numNodes;
+		_Atomic uint32_t nextSlot;
+	};
+	typedef struct nodemagazine NodeMagazine;
+
+	// For the magazines of one thread, each a chain of free nodes linked through nextNodePtr
+	struct threadnodecache {
+		struct nodecache *cachePtr;
+		ListNode *loadedNodePtr;
+		Length numLoaded;
+		ListNode *previousNodePtr;
+		Length numPrevious;
+		struct threadnodecache *prevThreadCachePtr;
+		struct threadnodecache *nextThreadCachePtr;
+	};
+	typedef struct threadnodecache ThreadNodeCache;
+
+	// For a node cache. Each stack of the depot is one word: a counter in the high 32 bits, 1 + the index of the top
+	// slot in the low 32 bits (0 => empty). threadCacheListPtr lists the magazines of every thread that has used the cache.
+	struct nodecache {
+		_Alignas (NODE_CACHE_LINE_SIZE) _Atomic uint64_t fullStack;
+		_Alignas (NODE_CACHE_LINE_SIZE) _Atomic uint64_t freeStack;
+		_Alignas (NODE_CACHE_LINE_SIZE) NodeMagazine *slots;
+		Length numSlots;
+		Length magazineSize;
+		pthread_key_t threadKey;
+		pthread_mutex_t threadListLock;
+		ThreadNodeCache *threadCacheListPtr;
+	};
+	typedef struct nodecache NodeCache;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/nodecache.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to initialising node caches
+	bool InitialiseNodeCache (NodeCache *cachePtr, Length magazineSize, Length depotSize);
+	void DestroyNodeCache (NodeCache *cachePtr);
+
+	// Related to allocating and freeing nodes
+	ListNode *AllocateCachedNode (NodeCache *cachePtr);
+	void FreeCachedNode (NodeCache *cachePtr, ListNode *nodePtr);
+	void FreeCachedNodeChain (NodeCache *cachePtr, ListNode *firstNodePtr, Length numNodes);
+
+	// Related to the memory held by a node cache
+	void DrainNodeCache (NodeCache *cachePtr);
+	Length TrimNodeCache (NodeCache *cachePtr, Length numMagazinesToKeep);
+
+#endif
@@ -0,0 +1,282 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include "../nodepool.h"	// For type declarations and function declarations related to the node pool allocator
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an empty node pool
+ * Input: nodesPerSlab (Length) (int): number of nodes in each slab. If not positive, POOL_DEFAULT_NODES_PER_SLAB is used
+ * Return value: pool (NodePool) : node pool with no slabs, an empty free list and pool.numNodesInUse = 0
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+NodePool InitialisePool (Length nodesPerSlab) {
+	NodePool pool;
+	pool.slabListPtr = NULL;
+	pool.freeListPtr = NULL;
+	pool.nodesPerSlab = (nodesPerSlab > 0) ? nodesPerSlab : POOL_DEFAULT_NODES_PER_SLAB;
+	pool.numUnusedInSlab = 0;
+	pool.numNodesInUse = 0;
+	return pool;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to take one node from a node pool
+ * Nodes on the free list are reused first. Otherwise the next unused node of the newest slab is handed out,
+ * and a new slab is allocated only when the newest slab is used up.
+ * Input: poolPtr (NodePool *): pointer to node pool
+ * Return value: pointer to an uninitialised node, or NULL if a new slab could not be allocated
+ * Post-condition: poolPtr->numNodesInUse is incremented by 1 (if a node is returned)
+ * Assumptions: poolPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(poolPtr->nodesPerSlab) when a new slab is allocated, O(1) otherwise
+ */
+ListNode *AllocateNode (NodePool *poolPtr) {
+	ListNode *nodePtr;
+	NodeSlab *slabPtr;
+
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of AllocateNode (NodePool *poolPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	// reuse a freed node
+	if (poolPtr->freeListPtr != NULL) {
+		nodePtr = poolPtr->freeListPtr;
+		poolPtr->freeListPtr = nodePtr->nextNodePtr;
+	}
+
+	// carve a node out of the newest slab, allocating a new slab if necessary
+	else {
+		if (poolPtr->numUnusedInSlab == 0) {
+			slabPtr = (NodeSlab *) malloc (sizeof (NodeSlab) + (poolPtr->nodesPerSlab) * sizeof (ListNode));
+			if (slabPtr == NULL) {
+				printf ("Error: AllocateNode could not allocate a slab of %d nodes\n", poolPtr->nodesPerSlab);
+				return NULL;
+			}
+
+			slabPtr->numNodes = poolPtr->nodesPerSlab;
+			slabPtr->nextSlabPtr = poolPtr->slabListPtr;
+			poolPtr->slabListPtr = slabPtr;
+			poolPtr->numUnusedInSlab = slabPtr->numNodes;
+		}
+
+		slabPtr = poolPtr->slabListPtr;
+		nodePtr = &(slabPtr->nodes[slabPtr->numNodes - poolPtr->numUnusedInSlab]);
+		(poolPtr->numUnusedInSlab)--;
+	}
+
+	(poolPtr->numNodesInUse)++;
+	return nodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to take a contiguous block of nodes from a node pool
+ * The block is carved out of the newest slab if it has room. Otherwise the unused nodes of the newest slab are moved
+ * to the free list, and a new slab of max(poolPtr->nodesPerSlab, numNodes) nodes is allocated.
+ * Inputs: poolPtr (NodePool *): pointer to node pool, numNodes (Length) (int): number of nodes in the block
+ * Return value: pointer to the first of numNodes adjacent uninitialised nodes, or NULL if a new slab could not be allocated
+ * Post-condition: poolPtr->numNodesInUse is incremented by numNodes (if a block is returned). Each node of the block
+ * can later be returned to the pool on its own with FreeNode.
+ * Assumptions: poolPtr != NULL, numNodes > 0
+ * Time complexity: O(1) if the newest slab has room, O(unused nodes of the newest slab) otherwise
+ * Space complexity: O(max(poolPtr->nodesPerSlab, numNodes)) when a new slab is allocated, O(1) otherwise
+ */
+ListNode *AllocateNodeBlock (NodePool *poolPtr, Length numNodes) {
+	ListNode *blockPtr;
+	NodeSlab *slabPtr;
+	Length slabSize;
+
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of AllocateNodeBlock (NodePool *poolPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	if (numNodes <= 0) {
+		printf ("Error: Argument 2 of AllocateNodeBlock (Length numNodes) must be positive\n");
+		return NULL;
+	}
+
+	if (poolPtr->numUnusedInSlab < numNodes) {
+		slabSize = (numNodes > poolPtr->nodesPerSlab) ? numNodes : poolPtr->nodesPerSlab;
+		slabPtr = (NodeSlab *) malloc (sizeof (NodeSlab) + slabSize * sizeof (ListNode));
+		if (slabPtr == NULL) {
+			printf ("Error: AllocateNodeBlock could not allocate a slab of %d nodes\n", slabSize);
+			return NULL;
+		}
+
+		// the rest of the newest slab is not lost: its nodes go to the free list
+		while (poolPtr->numUnusedInSlab > 0) {
+			blockPtr = &(poolPtr->slabListPtr->nodes[poolPtr->slabListPtr->numNodes - poolPtr->numUnusedInSlab]);
+			blockPtr->nextNodePtr = poolPtr->freeListPtr;
+			poolPtr->freeListPtr = blockPtr;
+			(poolPtr->numUnusedInSlab)--;
+		}
+
+		slabPtr->numNodes = slabSize;
+		slabPtr->nextSlabPtr = poolPtr->slabListPtr;
+		poolPtr->slabListPtr = slabPtr;
+		poolPtr->numUnusedInSlab = slabSize;
+	}
+
+	slabPtr = poolPtr->slabListPtr;
+	blockPtr = &(slabPtr->nodes[slabPtr->numNodes - poolPtr->numUnusedInSlab]);
+	poolPtr->numUnusedInSlab -= numNodes;
+	poolPtr->numNodesInUse += numNodes;
+
+	return blockPtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to take a chain of nodes from a node pool
+ * Nodes on the free list are reused first, as for AllocateNode, so that a pool whose nodes are freed and taken again in
+ * bulk does not keep growing. Only the nodes the free list cannot supply are taken as one contiguous block
+ * (see AllocateNodeBlock).
+ * Inputs: poolPtr (NodePool *): pointer to node pool, numNodes (Length) (int): number of nodes in the chain,
+ * lastNodePtrPtr (ListNode **): receives the last node of the chain
+ * Return value: pointer to the first of numNodes nodes linked through nextNodePtr (the last node has nextNodePtr = NULL,
+ * the data is uninitialised), or NULL if a new slab could not be allocated (the pool is then unchanged)
+ * Post-condition: poolPtr->numNodesInUse is incremented by numNodes (if a chain is returned)
+ * Assumptions: poolPtr != NULL, numNodes > 0, lastNodePtrPtr != NULL
+ * Time complexity: O(numNodes)
+ * Space complexity: O(max(poolPtr->nodesPerSlab, numNodes)) when a new slab is allocated, O(1) otherwise
+ */
+ListNode *AllocateNodeChain (NodePool *poolPtr, Length numNodes, ListNode **lastNodePtrPtr) {
+	ListNode *firstNodePtr = NULL, *lastNodePtr = NULL, *blockPtr;
+	Length numReused = 0;
+	Index i;
+
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of AllocateNodeChain (NodePool *poolPtr) cannot be NULL\n");
+		return NULL;
+	}
+
+	if (numNodes <= 0) {
+		printf ("Error: Argument 2 of AllocateNodeChain (Length numNodes) must be positive\n");
+		return NULL;
+	}
+
+	// the reused nodes stay linked as they were on the free list
+	if (poolPtr->freeListPtr != NULL) {
+		firstNodePtr = poolPtr->freeListPtr;
+		lastNodePtr = firstNodePtr;
+		numReused = 1;
+		while (numReused < numNodes && lastNodePtr->nextNodePtr != NULL) {
+			lastNodePtr = lastNodePtr->nextNodePtr;
+			numReused++;
+		}
+		poolPtr->freeListPtr = lastNodePtr->nextNodePtr;
+	}
+
+	if (numReused < numNodes) {
+		blockPtr = AllocateNodeBlock (poolPtr, numNodes - numReused);
+
+		// put the reused nodes back, ahead of anything AllocateNodeBlock may have added to the free list
+		if (blockPtr == NULL) {
+			if (firstNodePtr != NULL) {
+				lastNodePtr->nextNodePtr = poolPtr->freeListPtr;
+				poolPtr->freeListPtr = firstNodePtr;
+			}
+			return NULL;
+		}
+
+		for (i = 0; i < numNodes - numReused - 1; i++) {
+			blockPtr[i].nextNodePtr = &(blockPtr[i+1]);
+		}
+		if (firstNodePtr == NULL) {
+			firstNodePtr = blockPtr;
+		}
+		else {
+			lastNodePtr->nextNodePtr = blockPtr;
+		}
+		lastNodePtr = &(blockPtr[numNodes - numReused - 1]);
+	}
+
+	lastNodePtr->nextNodePtr = NULL;
+	poolPtr->numNodesInUse += numReused;
+	*lastNodePtrPtr = lastNodePtr;
+	return firstNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to return one node to a node pool
+ * Inputs: poolPtr (NodePool *): pointer to node pool, nodePtr (ListNode *): node previously taken from the same pool
+ * Return value: none
+ * Post-condition: nodePtr is at the front of the free list, poolPtr->numNodesInUse is decremented by 1
+ * Assumptions: poolPtr != NULL, nodePtr was returned by AllocateNode on the same pool, and is not in use any more
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void FreeNode (NodePool *poolPtr, ListNode *nodePtr) {
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of FreeNode (NodePool *poolPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (nodePtr == NULL) {
+		return;
+	}
+
+	nodePtr->nextNodePtr = poolPtr->freeListPtr;
+	poolPtr->freeListPtr = nodePtr;
+	(poolPtr->numNodesInUse)--;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to return a chain of nodes to a node pool at once
+ * Inputs: poolPtr (NodePool *): pointer to node pool, firstNodePtr (ListNode *), lastNodePtr (ListNode *): first and last node
+ * of a chain linked through nextNodePtr, numNodes (Length) (int): number of nodes in the chain
+ * Return value: none
+ * Post-condition: the whole chain is at the front of the free list, poolPtr->numNodesInUse is decremented by numNodes
+ * Assumptions: poolPtr != NULL, every node of the chain was taken from the same pool, and is not in use any more
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void FreeNodeChain (NodePool *poolPtr, ListNode *firstNodePtr, ListNode *lastNodePtr, Length numNodes) {
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of FreeNodeChain (NodePool *poolPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (firstNodePtr == NULL) {
+		return;
+	}
+
+	lastNodePtr->nextNodePtr = poolPtr->freeListPtr;
+	poolPtr->freeListPtr = firstNodePtr;
+	poolPtr->numNodesInUse -= numNodes;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to free all slabs of a node pool at once
+ * Input: poolPtr (NodePool *): pointer to node pool
+ * Return value: none
+ * Post-condition: all slabs are freed, the free list is empty, poolPtr->numNodesInUse = 0. The pool can be used again.
+ * Assumptions: poolPtr != NULL, no list still refers to nodes taken from this pool
+ * Time complexity: O(number of slabs)
+ * Space complexity: O(1)
+ */
+void ReleaseAllSlabs (NodePool *poolPtr) {
+	NodeSlab *slabPtr;
+
+	if (poolPtr == NULL) {
+		printf ("Error: Argument 1 of ReleaseAllSlabs (NodePool *poolPtr) cannot be NULL\n");
+		return;
+	}
+
+	while (poolPtr->slabListPtr != NULL) {
+		slabPtr = poolPtr->slabListPtr;
+		poolPtr->slabListPtr = slabPtr->nextSlabPtr;
+		free (slabPtr);
+	}
+
+	poolPtr->freeListPtr = NULL;
+	poolPtr->numUnusedInSlab = 0;
+	poolPtr->numNodesInUse = 0;
+}
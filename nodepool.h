@@ -0,0 +1,74 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the node pool allocator.
+ * A node pool hands out linked list nodes carved out of large slabs instead of one malloc per node.
+ *
+ * The following types are declared in this file:
+ * a) struct nodeslab (NodeSlab): a structure representing one slab, a single block of many list nodes
+ * b) struct nodepool (NodePool): a structure representing a pool of list nodes. Contains the slabs allocated so far,
+ *    and a free list of nodes returned to the pool (linked through their own nextNodePtr)
+ *
+ * The following functions are declared in this file:
+ * a) InitialisePool: Function to create an empty node pool
+ * b) AllocateNode: Function to take one node from a node pool
+ * c) AllocateNodeBlock: Function to take a contiguous block of nodes from a node pool
+ * d) AllocateNodeChain: Function to take a chain of nodes from a node pool, reusing freed nodes first
+ * e) FreeNode: Function to return one node to a node pool
+ * f) FreeNodeChain: Function to return a chain of nodes to a node pool at once
+ * g) ReleaseAllSlabs: Function to free all slabs of a node pool at once
+ *
+ * A pool is attached to a linked list with AttachPool (see "linkedlist.h").
+ * All of the above functions are defined in "Linked List/nodepool.c". For more details, see there.
+ */
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// Number of nodes in one slab, when the caller does not ask for a particular slab size
+	#define POOL_DEFAULT_NODES_PER_SLAB 4096
+
+	// For one slab of nodes. The nodes follow the header in the same allocation.
+	struct nodeslab {
+		struct nodeslab *nextSlabPtr;
+		Length numNodes;
+		ListNode nodes[];
+	};
+	typedef struct nodeslab NodeSlab;
+
+	// For a pool of nodes
+	struct nodepool {
+		NodeSlab *slabListPtr;
+		ListNode *freeListPtr;
+		Length nodesPerSlab;
+		Length numUnusedInSlab;
+		Length numNodesInUse;
+	};
+	typedef struct nodepool NodePool;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/nodepool.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to initialising node pools
+	NodePool InitialisePool (Length nodesPerSlab);
+
+	// Related to allocating and freeing nodes
+	ListNode *AllocateNode (NodePool *poolPtr);
+	ListNode *AllocateNodeBlock (NodePool *poolPtr, Length numNodes);
+	ListNode *AllocateNodeChain (NodePool *poolPtr, Length numNodes, ListNode **lastNodePtrPtr);
+	void FreeNode (NodePool *poolPtr, ListNode *nodePtr);
+	void FreeNodeChain (NodePool *poolPtr, ListNode *firstNodePtr, ListNode *lastNodePtr, Length numNodes);
+	void ReleaseAllSlabs (NodePool *poolPtr);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
@@ -0,0 +1,434 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include "../persistentlist.h"	// For type declarations and function declarations related to the persistent linked list
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to allocate a new node for a persistent linked list, with given data
+ * Inputs: data (Data) (int), nextNodePtr (PersistentNode *): the node after it. The caller's reference to nextNodePtr
+ * passes to the new node.
+ * Return value: pointer to node with node->data = data, one reference, or NULL if allocation failed
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static PersistentNode *NewPersistentNode (Data data, PersistentNode *nextNodePtr) {
+	PersistentNode *newNodePtr;
+
+	newNodePtr = (PersistentNode *) malloc (sizeof (PersistentNode));
+	if (newNodePtr == NULL) {
+		printf ("Error: could not allocate a new persistent linked list node\n");
+		return NULL;
+	}
+
+	newNodePtr->data = data;
+	atomic_init (&(newNodePtr->refCount), 1);
+	newNodePtr->nextNodePtr = nextNodePtr;
+	return newNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to free a chain of persistent linked list nodes that no version can reach
+ * Input: firstNodePtr (PersistentNode *): first node of the chain, which ends at NULL (may be NULL)
+ * Return value: none
+ * Time complexity: O(length of the chain)
+ * Space complexity: O(1)
+ */
+static void FreePersistentNodeChain (PersistentNode *firstNodePtr) {
+	PersistentNode *nextNodePtr;
+
+	while (firstNodePtr != NULL) {
+		nextNodePtr = firstNodePtr->nextNodePtr;
+		free (firstNodePtr);
+		firstNodePtr = nextNodePtr;
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to allocate the nodes an operation will copy into, before it changes anything
+ * Input: numNodes (Length) (int): number of nodes
+ * Return value: pointer to the first of numNodes nodes chained through nextNodePtr (NULL if numNodes == 0, or if
+ * allocation failed, in which case nothing stays allocated)
+ * Time complexity: O(numNodes)
+ * Space complexity: O(numNodes)
+ */
+static PersistentNode *NewPersistentNodeChain (Length numNodes) {
+	PersistentNode *firstNodePtr = NULL, *newNodePtr;
+	Index i;
+
+	for (i = 0; i < numNodes; i++) {
+		newNodePtr = NewPersistentNode (0, firstNodePtr);
+		if (newNodePtr == NULL) {
+			FreePersistentNodeChain (firstNodePtr);
+			return NULL;
+		}
+		firstNodePtr = newNodePtr;
+	}
+
+	return firstNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to add a reference to a node of a persistent linked list
+ * Input: nodePtr (PersistentNode *) (may be NULL)
+ * Return value: none
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static void AddReference (PersistentNode *nodePtr) {
+	if (nodePtr != NULL) {
+		atomic_fetch_add_explicit (&(nodePtr->refCount), 1, memory_order_relaxed);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to drop a reference to a node of a persistent linked list
+ * A node whose last reference goes is freed, which drops its reference to the node after it, and so on.
+ * Input: nodePtr (PersistentNode *) (may be NULL)
+ * Return value: none
+ * Time complexity: O(number of nodes freed)
+ * Space complexity: O(1)
+ */
+static void DropReference (PersistentNode *nodePtr) {
+	PersistentNode *nextNodePtr;
+
+	// acquire as well as release: the thread freeing a node must see every other thread done with it
+	while (nodePtr != NULL && atomic_fetch_sub_explicit (&(nodePtr->refCount), 1, memory_order_acq_rel) == 1) {
+		nextNodePtr = nodePtr->nextNodePtr;
+		free (nodePtr);
+		nodePtr = nextNodePtr;
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to check whether anything besides the node (or version) before it points to a node
+ * Along a chain from the head of a version, the nodes before the first shared node can only be reached through that
+ * version, and may be changed in place.
+ * Input: nodePtr (PersistentNode *)
+ * Return value: TRUE if the node has more than one reference, FALSE otherwise
+ * Assumptions: nodePtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static bool IsShared (PersistentNode *nodePtr) {
+	return atomic_load_explicit (&(nodePtr->refCount), memory_order_acquire) > 1;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to print the contents of a version of a persistent linked list, in the same format as PrintList
+ * Input: list (PersistentList)
+ * Return value: none
+ * Time complexity: O(list.numNodes)
+ * Space complexity: O(1)
+ */
+void PrintPersistentList (PersistentList list) {
+	PersistentNode *currNodePtr;
+
+	for (currNodePtr = list.headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+		PrintData (currNodePtr->data);
+		printf (" -> ");
+	}
+	printf ("NULL\n");
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to create an empty persistent linked list
+ * Input: none
+ * Return value: list (PersistentList) : version with list.numNodes = 0, list.headPtr = NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+PersistentList InitialisePersistentList (void) {
+	PersistentList list;
+
+	list.headPtr = NULL;
+	list.numNodes = 0;
+	return list;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to take a new version of a persistent linked list, sharing all its nodes
+ * Input: listPtr (const PersistentList *): pointer to version
+ * Return value: a version holding the same data as *listPtr, unaffected by later changes to either version
+ * Post-condition: the new version must be let go of with PersistentRelease
+ * Assumptions: listPtr != NULL, no other thread is changing *listPtr
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+PersistentList PersistentSnapshot (const PersistentList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentSnapshot (const PersistentList *listPtr) cannot be NULL\n");
+		return InitialisePersistentList ();
+	}
+
+	AddReference (listPtr->headPtr);
+	return *listPtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to let go of a version of a persistent linked list
+ * Input: listPtr (PersistentList *): pointer to version
+ * Return value: none
+ * Post-condition: the nodes no other version can reach are freed, *listPtr is empty
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(number of nodes freed)
+ * Space complexity: O(1)
+ */
+void PersistentRelease (PersistentList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentRelease (PersistentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	DropReference (listPtr->headPtr);
+	listPtr->headPtr = NULL;
+	listPtr->numNodes = 0;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to add data at the beginning of a version of a persistent linked list
+ * The old list becomes the tail of the new one, shared with every other version of it.
+ * Inputs: listPtr (PersistentList *): pointer to version, data (Data) (int)
+ * Return value: none
+ * Post-condition: the version has a new head holding data, listPtr->numNodes is incremented by 1. Other versions are
+ * unchanged.
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void PersistentAddDataAtBeginning (PersistentList *listPtr, Data data) {
+	PersistentNode *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentAddDataAtBeginning (PersistentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	// the version's reference to the old head passes to the new node
+	newNodePtr = NewPersistentNode (data, listPtr->headPtr);
+	if (newNodePtr == NULL) {
+		return;
+	}
+
+	listPtr->headPtr = newNodePtr;
+	(listPtr->numNodes)++;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to remove the head of a version of a persistent linked list, returning its data
+ * Inputs: listPtr (PersistentList *): pointer to version, dataPtr (Data *): receives the data of the head
+ * (may be NULL if the data is not needed)
+ * Return value: TRUE if a node was removed, FALSE if the version was empty
+ * Post-condition: the version starts at the node after its old head, listPtr->numNodes is decremented by 1. The old
+ * head is freed unless another version can reach it. Other versions are unchanged.
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+bool PersistentRemoveDataAtBeginning (PersistentList *listPtr, Data *dataPtr) {
+	PersistentNode *headPtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentRemoveDataAtBeginning (PersistentList *listPtr) cannot be NULL\n");
+		return FALSE;
+	}
+
+	headPtr = listPtr->headPtr;
+	if (headPtr == NULL) {
+		return FALSE;
+	}
+
+	if (dataPtr != NULL) {
+		*dataPtr = headPtr->data;
+	}
+
+	listPtr->headPtr = headPtr->nextNodePtr;
+	(listPtr->numNodes)--;
+
+	// the head's reference to the node after it passes to the version
+	if (!IsShared (headPtr)) {
+		free (headPtr);
+	}
+	else {
+		AddReference (listPtr->headPtr);
+		DropReference (headPtr);
+	}
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to remove all occurrences of given data from a version of a persistent linked list
+ * The nodes only this version can reach are unlinked (and freed) in place. From the first node another version can
+ * reach, the nodes kept are copied up to the last occurrence of data; the nodes after it stay shared.
+ * Inputs: listPtr (PersistentList *): pointer to version, data (Data) (int)
+ * Return value: none
+ * Post-condition: All occurrences of data in the version are removed, listPtr->numNodes is reduced by number of nodes
+ * removed. Other versions are unchanged. If the copies cannot be allocated, the version is left unchanged.
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Space complexity: O(number of shared nodes before the last occurrence of data)
+ */
+void PersistentRemoveData (PersistentList *listPtr, Data data) {
+	PersistentNode *currNodePtr, *sharedNodePtr = NULL, *lastMatchPtr = NULL, *suffixPtr, *spareNodePtr, *nextNodePtr;
+	PersistentNode **linkPtrPtr;
+	Length numMatches = 0, numKeptShared = 0, numCopies = 0;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentRemoveData (PersistentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	// find the first shared node, the last occurrence, and the number of nodes to copy
+	for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+		if (sharedNodePtr == NULL && IsShared (currNodePtr)) {
+			sharedNodePtr = currNodePtr;
+		}
+
+		if (currNodePtr->data == data) {
+			lastMatchPtr = currNodePtr;
+			numMatches++;
+			numCopies = numKeptShared;
+		}
+		else if (sharedNodePtr != NULL) {
+			numKeptShared++;
+		}
+	}
+
+	if (lastMatchPtr == NULL) {
+		return;
+	}
+
+	spareNodePtr = NewPersistentNodeChain (numCopies);
+	if (numCopies > 0 && spareNodePtr == NULL) {
+		return;
+	}
+
+	suffixPtr = lastMatchPtr->nextNodePtr;
+	linkPtrPtr = &(listPtr->headPtr);
+	currNodePtr = listPtr->headPtr;
+
+	// nodes only this version can reach: unlink in place
+	while (currNodePtr != sharedNodePtr && currNodePtr != suffixPtr) {
+		if (currNodePtr->data == data) {
+			// its reference to the node after it passes to the link
+			*linkPtrPtr = currNodePtr->nextNodePtr;
+			free (currNodePtr);
+		}
+		else {
+			linkPtrPtr = &(currNodePtr->nextNodePtr);
+		}
+		currNodePtr = *linkPtrPtr;
+	}
+
+	// shared nodes up to the last occurrence: copy the ones kept, then let go of the old chain
+	if (currNodePtr != suffixPtr) {
+		for (; currNodePtr != suffixPtr; currNodePtr = currNodePtr->nextNodePtr) {
+			if (currNodePtr->data != data) {
+				nextNodePtr = spareNodePtr->nextNodePtr;
+				spareNodePtr->data = currNodePtr->data;
+				*linkPtrPtr = spareNodePtr;
+				linkPtrPtr = &(spareNodePtr->nextNodePtr);
+				spareNodePtr = nextNodePtr;
+			}
+		}
+
+		*linkPtrPtr = suffixPtr;
+		AddReference (suffixPtr);
+		DropReference (sharedNodePtr);
+	}
+
+	listPtr->numNodes -= numMatches;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to reverse a version of a persistent linked list
+ * The nodes only this version can reach are relinked in place; the shared ones are copied.
+ * Input: listPtr (PersistentList *): pointer to version
+ * Return value: none
+ * Pre-condition: version contains some nodes (n_1)->...(n_numNodes)
+ * Post-condition: version contains the nodes in order (n_numNodes)->...(n_1). Other versions are unchanged. If the
+ * copies cannot be allocated, the version is left unchanged.
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(number of shared nodes)
+ */
+void PersistentReverseList (PersistentList *listPtr) {
+	PersistentNode *currNodePtr, *nextNodePtr, *reversedHeadPtr = NULL, *sharedNodePtr, *spareNodePtr;
+	Length numExclusive = 0;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentReverseList (PersistentList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	for (sharedNodePtr = listPtr->headPtr; sharedNodePtr != NULL && !IsShared (sharedNodePtr);
+		sharedNodePtr = sharedNodePtr->nextNodePtr) {
+		numExclusive++;
+	}
+
+	spareNodePtr = NewPersistentNodeChain ((listPtr->numNodes) - numExclusive);
+	if (sharedNodePtr != NULL && spareNodePtr == NULL) {
+		return;
+	}
+
+	currNodePtr = listPtr->headPtr;
+	while (currNodePtr != sharedNodePtr) {
+		nextNodePtr = currNodePtr->nextNodePtr;
+		currNodePtr->nextNodePtr = reversedHeadPtr;
+		reversedHeadPtr = currNodePtr;
+		currNodePtr = nextNodePtr;
+	}
+
+	// the reference to the first shared node (from the version or the last node relinked) is let go of afterwards
+	for (; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+		nextNodePtr = spareNodePtr->nextNodePtr;
+		spareNodePtr->data = currNodePtr->data;
+		spareNodePtr->nextNodePtr = reversedHeadPtr;
+		reversedHeadPtr = spareNodePtr;
+		spareNodePtr = nextNodePtr;
+	}
+
+	listPtr->headPtr = reversedHeadPtr;
+	DropReference (sharedNodePtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to copy the contents of a version of a persistent linked list into an array
+ * Inputs: listPtr (PersistentList *): pointer to version, dataArray (Data *): array to copy into,
+ * arrayLength (Length) (int): number of elements dataArray can hold
+ * Return value: number of elements copied (Length) (int) = min(listPtr->numNodes, arrayLength)
+ * Post-condition: dataArray[i] holds the data of the i-th node (from the head), for each element copied. The version is unchanged.
+ * Assumptions: listPtr != NULL, dataArray != NULL (unless arrayLength == 0)
+ * Time complexity: O(min(listPtr->numNodes, arrayLength))
+ * Space complexity: O(1)
+ */
+Length PersistentListToArray (PersistentList *listPtr, Data *dataArray, Length arrayLength) {
+	PersistentNode *currNodePtr;
+	Index i;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of PersistentListToArray (PersistentList *listPtr) cannot be NULL\n");
+		return 0;
+	}
+
+	currNodePtr = listPtr->headPtr;
+	for (i = 0; i < arrayLength && currNodePtr != NULL; i++) {
+		dataArray[i] = currNodePtr->data;
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+
+	return i;
+}
@@ -0,0 +1,94 @@
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the persistent linked list.
+ * A persistent linked list is never changed where other versions can see it. Each PersistentList is one version: a
+ * head pointer and a length. Versions share nodes, and every node counts the versions and nodes pointing to it, so it
+ * is freed when the last of them lets go. Taking a snapshot of a version is O(1), and adding data at the beginning
+ * shares the whole old list as the tail of the new one. Removing and reversing copy only the nodes that other versions
+ * can also reach, up to the last node that changes; the nodes a version alone can reach (all of them, if it has never
+ * been snapshotted) are changed in place, as in a plain linked list.
+ *
+ * A version is used by one thread at a time, but versions sharing nodes may be used and released by different threads
+ * at once: the counts are atomic. A PersistentList copied by assignment is not a new version; use PersistentSnapshot.
+ *
+ * The following types are declared in this file:
+ * a) struct persistentnode (PersistentNode): a structure representing one persistent list node. Contains data,
+ *    a pointer to the next node (never changed once another version can reach the node) and the number of
+ *    versions and nodes pointing to it
+ * b) struct persistentlist (PersistentList): a structure representing one version of a persistent linked list.
+ *    Contains a head pointer and the number of nodes
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to printing contents of a persistent linked list
+ * a) PrintPersistentList: Function to print the contents of a version of a persistent linked list
+ *
+ * Related to versions of a persistent linked list
+ * b) InitialisePersistentList: Function to create an empty persistent linked list
+ * c) PersistentSnapshot: Function to take a new version of a persistent linked list, sharing all its nodes
+ * d) PersistentRelease: Function to let go of a version of a persistent linked list
+ *
+ * Related to adding data to a persistent linked list
+ * e) PersistentAddDataAtBeginning: Function to add data at the beginning of a version of a persistent linked list
+ *
+ * Related to removing data from a persistent linked list
+ * f) PersistentRemoveDataAtBeginning: Function to remove the head of a version of a persistent linked list
+ * g) PersistentRemoveData: Function to remove all occurrences of given data from a version of a persistent linked list
+ *
+ * Related to permutation of a persistent linked list
+ * h) PersistentReverseList: Function to reverse a version of a persistent linked list
+ *
+ * Related to bulk transfer of data from a persistent linked list
+ * i) PersistentListToArray: Function to copy the contents of a version of a persistent linked list into an array
+ *
+ * All of the above functions are defined in "Linked List/persistentlist.c". For more details, see there.
+ */
+
+#ifndef PERSISTENTLIST_H
+#define PERSISTENTLIST_H
+
+	#include <stdatomic.h>
+	#include "linkedlist.h"
+
+	// For one node in persistent linked list
+	struct persistentnode {
+		Data data;
+		_Atomic Length refCount;
+		struct persistentnode *nextNodePtr;
+	};
+	typedef struct persistentnode PersistentNode;
+
+	// For one version of a persistent linked list. It holds one reference to its head.
+	struct persistentlist {
+		PersistentNode *headPtr;
+		Length numNodes;
+	};
+	typedef struct persistentlist PersistentList;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/persistentlist.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to printing the contents of the persistent linked list
+	void PrintPersistentList (PersistentList list);
+
+	// Related to versions of a persistent linked list
+	PersistentList InitialisePersistentList (void);
+	PersistentList PersistentSnapshot (const PersistentList *listPtr);
+	void PersistentRelease (PersistentList *listPtr);
+
+	// Related to adding data to a persistent linked list
+	void PersistentAddDataAtBeginning (PersistentList *listPtr, Data data);
+
+	// Related to removing data from a persistent linked list
+	bool PersistentRemoveDataAtBeginning (PersistentList *listPtr, Data *dataPtr);
+	void PersistentRemoveData (PersistentList *listPtr, Data data);
+
+	// Related to permutation of a persistent linked list
+	void PersistentReverseList (PersistentList *listPtr);
+
+	// Related to bulk transfer of data from a persistent linked list
+	Length PersistentListToArray (PersistentList *listPtr, Data *dataArray, Length arrayLength);
+
+#endif
@@ -0,0 +1,488 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include "../positionindex.h"	// For type declarations and function declarations related to the positional index
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to free all entries of a positional index, leaving one empty level
+ * Input: indexPtr (PositionIndex *): pointer to positional index
+ * Return value: none
+ * Post-condition: every level is empty (head entry has nextEntryPtr = NULL and is its own tail), indexPtr->numLevels = 1.
+ * Widths of the head entries are left for the caller to set.
+ * Assumption: indexPtr != NULL
+ * Time complexity: O(number of entries)
+ * Space complexity: O(1)
+ */
+static void FreeIndexEntries (PositionIndex *indexPtr) {
+	IndexEntry *currEntryPtr, *tempEntryPtr;
+	Index level;
+
+	for (level = 0; level < POSITION_INDEX_MAX_LEVELS; level++) {
+		currEntryPtr = indexPtr->headEntries[level].nextEntryPtr;
+		while (currEntryPtr != NULL) {
+			tempEntryPtr = currEntryPtr;
+			currEntryPtr = currEntryPtr->nextEntryPtr;
+			free (tempEntryPtr);
+		}
+
+		indexPtr->headEntries[level].nextEntryPtr = NULL;
+		indexPtr->tailEntryPtrs[level] = &(indexPtr->headEntries[level]);
+	}
+
+	indexPtr->numLevels = 1;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to choose the number of index levels a new node appears in
+ * Each level is reached with probability 1/4 from the one below (xorshift pseudo-random numbers)
+ * Input: indexPtr (PositionIndex *): pointer to positional index
+ * Return value: height (Length) (int), in range [0, POSITION_INDEX_MAX_LEVELS]
+ * Assumption: indexPtr != NULL
+ * Time complexity: O(height)
+ * Space complexity: O(1)
+ */
+static Length RandomHeight (PositionIndex *indexPtr) {
+	unsigned int x;
+	Length height = 0;
+
+	x = indexPtr->randomState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	indexPtr->randomState = x;
+
+	while (height < POSITION_INDEX_MAX_LEVELS && (x & 3) == 0) {
+		height++;
+		x >>= 2;
+	}
+
+	return height;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to find, on each level of a positional index, the last entry at or before a given position
+ * Inputs: indexPtr (PositionIndex *): pointer to positional index, limit (Index) (int): position to search for (-1 => head),
+ * pathEntryPtrs (IndexEntry **): receives the entry found on each level,
+ * pathPositions (Index *): receives the position of the entry found on each level
+ * Return value: none
+ * Assumption: indexPtr != NULL, the index is valid, both arrays have room for indexPtr->numLevels elements
+ * Time complexity: O(log numNodes) expected
+ * Space complexity: O(1)
+ */
+static void SearchPath (PositionIndex *indexPtr, Index limit, IndexEntry **pathEntryPtrs, Index *pathPositions) {
+	IndexEntry *currEntryPtr;
+	Index level, position = -1;
+
+	currEntryPtr = &(indexPtr->headEntries[indexPtr->numLevels - 1]);
+
+	for (level = (indexPtr->numLevels)-1; level >= 0; level--) {
+		while (currEntryPtr->nextEntryPtr != NULL && position + currEntryPtr->width <= limit) {
+			position += currEntryPtr->width;
+			currEntryPtr = currEntryPtr->nextEntryPtr;
+		}
+
+		pathEntryPtrs[level] = currEntryPtr;
+		pathPositions[level] = position;
+
+		if (level > 0) {
+			currEntryPtr = currEntryPtr->downEntryPtr;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to walk forward along a linked list to a given position
+ * Inputs: listPtr (LinkedList *): pointer to linked list, nodePtr (ListNode *): node at nodePosition (NULL => position -1),
+ * nodePosition (Index) (int), position (Index) (int): position to walk to
+ * Return value: pointer to the node at position (NULL if position == -1)
+ * Assumption: listPtr != NULL, -1 <= nodePosition <= position <= listPtr->numNodes - 1
+ * Time complexity: O(position - nodePosition)
+ * Space complexity: O(1)
+ */
+static ListNode *WalkToPosition (LinkedList *listPtr, ListNode *nodePtr, Index nodePosition, Index position) {
+	while (nodePosition < position) {
+		nodePtr = (nodePtr == NULL) ? listPtr->headPtr : nodePtr->nextNodePtr;
+		nodePosition++;
+	}
+
+	return nodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to rebuild the positional index of a linked list from scratch
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Post-condition: the index describes the list and is valid, unless an entry could not be allocated
+ * (the index is then left empty and invalid)
+ * Assumption: listPtr != NULL, listPtr->indexPtr != NULL
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(listPtr->numNodes)
+ */
+static void RebuildPositionIndex (LinkedList *listPtr) {
+	PositionIndex *indexPtr = listPtr->indexPtr;
+	IndexEntry *lastEntryPtrs[POSITION_INDEX_MAX_LEVELS];
+	Index lastPositions[POSITION_INDEX_MAX_LEVELS];
+	IndexEntry *newEntryPtr, *belowEntryPtr;
+	ListNode *currNodePtr;
+	Index level, position;
+	Length height;
+
+	FreeIndexEntries (indexPtr);
+
+	for (level = 0; level < POSITION_INDEX_MAX_LEVELS; level++) {
+		lastEntryPtrs[level] = &(indexPtr->headEntries[level]);
+		lastPositions[level] = -1;
+	}
+
+	currNodePtr = listPtr->headPtr;
+	position = 0;
+
+	while (currNodePtr != NULL) {
+		height = RandomHeight (indexPtr);
+		if (height > indexPtr->numLevels) {
+			indexPtr->numLevels = height;
+		}
+
+		belowEntryPtr = NULL;
+		for (level = 0; level < height; level++) {
+			newEntryPtr = (IndexEntry *) malloc (sizeof (IndexEntry));
+			if (newEntryPtr == NULL) {
+				printf ("Error: could not allocate a positional index entry\n");
+				FreeIndexEntries (indexPtr);
+				indexPtr->isValid = FALSE;
+				return;
+			}
+
+			newEntryPtr->nodePtr = currNodePtr;
+			newEntryPtr->nextEntryPtr = NULL;
+			newEntryPtr->downEntryPtr = belowEntryPtr;
+
+			lastEntryPtrs[level]->nextEntryPtr = newEntryPtr;
+			lastEntryPtrs[level]->width = position - lastPositions[level];
+			lastEntryPtrs[level] = newEntryPtr;
+			lastPositions[level] = position;
+			belowEntryPtr = newEntryPtr;
+		}
+
+		currNodePtr = currNodePtr->nextNodePtr;
+		position++;
+	}
+
+	for (level = 0; level < POSITION_INDEX_MAX_LEVELS; level++) {
+		lastEntryPtrs[level]->width = (listPtr->numNodes) - lastPositions[level];
+		indexPtr->tailEntryPtrs[level] = lastEntryPtrs[level];
+	}
+
+	indexPtr->isValid = TRUE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to build a positional index for a linked list
+ * Once attached, AddDataFromBeginning, AddDataFromEnd, RotateList and GetNodeAtPosition find their position in
+ * expected O(log numNodes) steps. Operations that do not know the positions they change (AddNode and RemoveNode
+ * in the middle of the list, bulk adds, ReverseList) mark the index out of date; it is rebuilt when it is next used.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes, and has no positional index
+ * Post-condition: listPtr->indexPtr points to an index describing the list
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes)
+ * Space complexity: O(listPtr->numNodes)
+ */
+void AttachPositionIndex (LinkedList *listPtr) {
+	PositionIndex *indexPtr;
+	Index level;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachPositionIndex (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->indexPtr != NULL) {
+		return;
+	}
+
+	indexPtr = (PositionIndex *) malloc (sizeof (PositionIndex));
+	if (indexPtr == NULL) {
+		printf ("Error: could not allocate a positional index\n");
+		return;
+	}
+
+	for (level = 0; level < POSITION_INDEX_MAX_LEVELS; level++) {
+		indexPtr->headEntries[level].nodePtr = NULL;
+		indexPtr->headEntries[level].nextEntryPtr = NULL;
+		indexPtr->headEntries[level].downEntryPtr = (level > 0) ? &(indexPtr->headEntries[level-1]) : NULL;
+	}
+	indexPtr->randomState = 2463534242u;
+
+	listPtr->indexPtr = indexPtr;
+	RebuildPositionIndex (listPtr);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove (and free) the positional index of a linked list
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Post-condition: listPtr->indexPtr = NULL. The nodes of the list are not changed.
+ * Assumption: listPtr != NULL
+ * Time complexity: O(number of index entries)
+ * Space complexity: O(1)
+ */
+void DetachPositionIndex (LinkedList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DetachPositionIndex (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->indexPtr == NULL) {
+		return;
+	}
+
+	FreeIndexEntries (listPtr->indexPtr);
+	free (listPtr->indexPtr);
+	listPtr->indexPtr = NULL;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to find the node at a given position using the positional index
+ * The index is rebuilt first if it is out of date.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, position (Index) (int): position of the node (0 => head)
+ * Return value: pointer to the node at position, NULL if position == -1
+ * Assumptions: listPtr != NULL, listPtr->indexPtr != NULL, position is in range [-1, (listPtr->numNodes)-1]
+ * Time complexity: O(log listPtr->numNodes) expected, O(listPtr->numNodes) if the index has to be rebuilt
+ * Space complexity: O(1)
+ */
+ListNode *PositionIndexFind (LinkedList *listPtr, Index position) {
+	IndexEntry *pathEntryPtrs[POSITION_INDEX_MAX_LEVELS];
+	Index pathPositions[POSITION_INDEX_MAX_LEVELS];
+
+	if (!(listPtr->indexPtr->isValid)) {
+		RebuildPositionIndex (listPtr);
+
+		// fall back on walking the list
+		if (!(listPtr->indexPtr->isValid)) {
+			return WalkToPosition (listPtr, NULL, -1, position);
+		}
+	}
+
+	SearchPath (listPtr->indexPtr, position, pathEntryPtrs, pathPositions);
+
+	return WalkToPosition (listPtr, pathEntryPtrs[0]->nodePtr, pathPositions[0], position);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to record that a node has been inserted at a given position
+ * The new node is given a random height, and an entry is added for it on each of the lowest 'height' levels.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, newNodePtr (ListNode *): the new node,
+ * position (Index) (int): position of the new node
+ * Return value: none
+ * Pre-condition: the node has already been linked into the list, and listPtr->numNodes incremented
+ * Post-condition: the index describes the list (if it was valid before)
+ * Assumptions: listPtr != NULL, listPtr->indexPtr != NULL
+ * Time complexity: O(log listPtr->numNodes) expected
+ * Space complexity: O(1) expected
+ */
+void PositionIndexInsert (LinkedList *listPtr, ListNode *newNodePtr, Index position) {
+	PositionIndex *indexPtr = listPtr->indexPtr;
+	IndexEntry *pathEntryPtrs[POSITION_INDEX_MAX_LEVELS];
+	Index pathPositions[POSITION_INDEX_MAX_LEVELS];
+	IndexEntry *newEntryPtr, *belowEntryPtr;
+	Index level;
+	Length height;
+
+	if (!(indexPtr->isValid)) {
+		return;
+	}
+
+	// new levels start empty: their head spans the list as it was before the insertion
+	height = RandomHeight (indexPtr);
+	while (indexPtr->numLevels < height) {
+		indexPtr->headEntries[indexPtr->numLevels].nextEntryPtr = NULL;
+		indexPtr->headEntries[indexPtr->numLevels].width = listPtr->numNodes;
+		indexPtr->tailEntryPtrs[indexPtr->numLevels] = &(indexPtr->headEntries[indexPtr->numLevels]);
+		(indexPtr->numLevels)++;
+	}
+
+	SearchPath (indexPtr, position-1, pathEntryPtrs, pathPositions);
+
+	for (level = 0; level < indexPtr->numLevels; level++) {
+		(pathEntryPtrs[level]->width)++;
+	}
+
+	belowEntryPtr = NULL;
+	for (level = 0; level < height; level++) {
+		newEntryPtr = (IndexEntry *) malloc (sizeof (IndexEntry));
+
+		// the node simply gets a smaller height
+		if (newEntryPtr == NULL) {
+			break;
+		}
+
+		newEntryPtr->nodePtr = newNodePtr;
+		newEntryPtr->downEntryPtr = belowEntryPtr;
+		newEntryPtr->width = pathPositions[level] + pathEntryPtrs[level]->width - position;
+		pathEntryPtrs[level]->width = position - pathPositions[level];
+
+		newEntryPtr->nextEntryPtr = pathEntryPtrs[level]->nextEntryPtr;
+		pathEntryPtrs[level]->nextEntryPtr = newEntryPtr;
+		if (indexPtr->tailEntryPtrs[level] == pathEntryPtrs[level]) {
+			indexPtr->tailEntryPtrs[level] = newEntryPtr;
+		}
+
+		belowEntryPtr = newEntryPtr;
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to record that the node at a given position has been removed
+ * Inputs: listPtr (LinkedList *): pointer to linked list, position (Index) (int): position the removed node had
+ * Return value: none
+ * Pre-condition: the node has already been unlinked from the list, and listPtr->numNodes decremented
+ * Post-condition: the entries of the removed node are freed, the index describes the list (if it was valid before)
+ * Assumptions: listPtr != NULL, listPtr->indexPtr != NULL
+ * Time complexity: O(log listPtr->numNodes) expected
+ * Space complexity: O(1)
+ */
+void PositionIndexRemove (LinkedList *listPtr, Index position) {
+	PositionIndex *indexPtr = listPtr->indexPtr;
+	IndexEntry *pathEntryPtrs[POSITION_INDEX_MAX_LEVELS];
+	Index pathPositions[POSITION_INDEX_MAX_LEVELS];
+	IndexEntry *currEntryPtr, *victimEntryPtr;
+	Index level;
+
+	if (!(indexPtr->isValid)) {
+		return;
+	}
+
+	SearchPath (indexPtr, position-1, pathEntryPtrs, pathPositions);
+
+	for (level = 0; level < indexPtr->numLevels; level++) {
+		currEntryPtr = pathEntryPtrs[level];
+		victimEntryPtr = currEntryPtr->nextEntryPtr;
+
+		// the next entry on this level belongs to the removed node
+		if (victimEntryPtr != NULL && pathPositions[level] + currEntryPtr->width == position) {
+			currEntryPtr->width += (victimEntryPtr->width)-1;
+			currEntryPtr->nextEntryPtr = victimEntryPtr->nextEntryPtr;
+			if (indexPtr->tailEntryPtrs[level] == victimEntryPtr) {
+				indexPtr->tailEntryPtrs[level] = currEntryPtr;
+			}
+			free (victimEntryPtr);
+		}
+		else {
+			(currEntryPtr->width)--;
+		}
+	}
+
+	while (indexPtr->numLevels > 1 && indexPtr->headEntries[indexPtr->numLevels - 1].nextEntryPtr == NULL) {
+		(indexPtr->numLevels)--;
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to record that the list has been rotated
+ * On each level, the entries at or after newHeadPosition are moved in front of the others. Only the head entry,
+ * and the first and last entry of each of the two parts, change.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, newHeadPosition (Index) (int): position (before the rotation)
+ * of the node that is now the head
+ * Return value: none
+ * Pre-condition: the list has already been rotated
+ * Post-condition: the index describes the list (if it was valid before)
+ * Assumptions: listPtr != NULL, listPtr->indexPtr != NULL, 0 < newHeadPosition < listPtr->numNodes
+ * Time complexity: O(log listPtr->numNodes) expected
+ * Space complexity: O(1)
+ */
+void PositionIndexRotate (LinkedList *listPtr, Index newHeadPosition) {
+	PositionIndex *indexPtr = listPtr->indexPtr;
+	IndexEntry *pathEntryPtrs[POSITION_INDEX_MAX_LEVELS];
+	Index pathPositions[POSITION_INDEX_MAX_LEVELS];
+	IndexEntry *headEntryPtr, *firstAEntryPtr, *lastAEntryPtr, *firstBEntryPtr, *lastBEntryPtr;
+	Index level, firstAPosition, lastAPosition, firstBPosition, lastBPosition;
+	Length numNodes = listPtr->numNodes;
+
+	if (!(indexPtr->isValid)) {
+		return;
+	}
+
+	SearchPath (indexPtr, newHeadPosition-1, pathEntryPtrs, pathPositions);
+
+	// part A: entries before newHeadPosition, part B: entries from newHeadPosition onwards
+	for (level = 0; level < indexPtr->numLevels; level++) {
+		headEntryPtr = &(indexPtr->headEntries[level]);
+
+		lastAEntryPtr = (pathEntryPtrs[level] != headEntryPtr) ? pathEntryPtrs[level] : NULL;
+		lastAPosition = pathPositions[level];
+		firstAEntryPtr = (lastAEntryPtr != NULL) ? headEntryPtr->nextEntryPtr : NULL;
+		firstAPosition = (headEntryPtr->width)-1;
+
+		firstBEntryPtr = pathEntryPtrs[level]->nextEntryPtr;
+		firstBPosition = pathPositions[level] + pathEntryPtrs[level]->width;
+		lastBEntryPtr = (firstBEntryPtr != NULL) ? indexPtr->tailEntryPtrs[level] : NULL;
+		lastBPosition = (lastBEntryPtr != NULL) ? numNodes - lastBEntryPtr->width : 0;
+
+		if (firstAEntryPtr != NULL && firstBEntryPtr != NULL) {
+			headEntryPtr->nextEntryPtr = firstBEntryPtr;
+			headEntryPtr->width = firstBPosition - newHeadPosition + 1;
+			lastBEntryPtr->nextEntryPtr = firstAEntryPtr;
+			lastBEntryPtr->width = firstAPosition + numNodes - lastBPosition;
+			lastAEntryPtr->nextEntryPtr = NULL;
+			lastAEntryPtr->width = newHeadPosition - lastAPosition;
+			indexPtr->tailEntryPtrs[level] = lastAEntryPtr;
+		}
+		else if (firstBEntryPtr != NULL) {
+			headEntryPtr->width = firstBPosition - newHeadPosition + 1;
+			lastBEntryPtr->width += newHeadPosition;
+		}
+		else if (firstAEntryPtr != NULL) {
+			headEntryPtr->width = firstAPosition + numNodes - newHeadPosition + 1;
+			lastAEntryPtr->width = newHeadPosition - lastAPosition;
+		}
+	}
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to mark the positional index of a linked list as out of date
+ * Used after operations that change positions without knowing which. The index is rebuilt when it is next used.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Assumptions: listPtr != NULL, listPtr->indexPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void InvalidatePositionIndex (LinkedList *listPtr) {
+	listPtr->indexPtr->isValid = FALSE;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to empty the positional index of a linked list, when all nodes have been removed from the list
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Pre-condition: the list contains zero nodes
+ * Post-condition: the index has no entries, and is valid
+ * Assumptions: listPtr != NULL, listPtr->indexPtr != NULL
+ * Time complexity: O(number of index entries)
+ * Space complexity: O(1)
+ */
+void ClearPositionIndex (LinkedList *listPtr) {
+	Index level;
+
+	FreeIndexEntries (listPtr->indexPtr);
+
+	for (level = 0; level < POSITION_INDEX_MAX_LEVELS; level++) {
+		listPtr->indexPtr->headEntries[level].width = (listPtr->numNodes)+1;
+	}
+
+	listPtr->indexPtr->isValid = TRUE;
+}
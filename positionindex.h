@@ -0,0 +1,87 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the positional index of a linked list.
+ * The positional index is an indexable skip list kept alongside a linked list. Its bottom level is the list itself;
+ * each level above holds entries for a random subset of the nodes of the level below (about one in four), and
+ * each entry records how many list nodes it spans up to the next entry of its level. Looking up the node at a
+ * given position then takes expected O(log numNodes) steps instead of O(position).
+ *
+ * The following types are declared in this file:
+ * a) struct indexentry (IndexEntry): a structure representing one entry of one level of the index
+ * b) struct positionindex (PositionIndex): a structure representing the index. Contains the head entry
+ *    (at position -1, before the head of the list) and the last entry of each level
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to attaching an index to a linked list
+ * a) AttachPositionIndex: Function to build a positional index for a linked list
+ * b) DetachPositionIndex: Function to remove (and free) the positional index of a linked list
+ *
+ * Related to looking up positions (used by "Linked List/linkedlist.c")
+ * c) PositionIndexFind: Function to find the node at a given position using the positional index
+ *
+ * Related to keeping the index up to date (used by "Linked List/linkedlist.c")
+ * d) PositionIndexInsert: Function to record that a node has been inserted at a given position
+ * e) PositionIndexRemove: Function to record that the node at a given position has been removed
+ * f) PositionIndexRotate: Function to record that the list has been rotated
+ * g) InvalidatePositionIndex: Function to mark the index as out of date, to be rebuilt when it is next used
+ * h) ClearPositionIndex: Function to empty the index, when all nodes have been removed from the list
+ *
+ * All of the above functions are defined in "Linked List/positionindex.c". For more details, see there.
+ */
+
+#ifndef POSITIONINDEX_H
+#define POSITIONINDEX_H
+
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// Maximum number of levels of the index above the list itself
+	#define POSITION_INDEX_MAX_LEVELS 16
+
+	// For one entry of one level of the index
+	struct indexentry {
+		ListNode *nodePtr;
+		Length width;
+		struct indexentry *nextEntryPtr;
+		struct indexentry *downEntryPtr;
+	};
+	typedef struct indexentry IndexEntry;
+
+	// For the positional index of a linked list
+	struct positionindex {
+		IndexEntry headEntries[POSITION_INDEX_MAX_LEVELS];
+		IndexEntry *tailEntryPtrs[POSITION_INDEX_MAX_LEVELS];
+		Length numLevels;
+		bool isValid;
+		unsigned int randomState;
+	};
+	typedef struct positionindex PositionIndex;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/positionindex.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to attaching an index to a linked list
+	void AttachPositionIndex (LinkedList *listPtr);
+	void DetachPositionIndex (LinkedList *listPtr);
+
+	// Related to looking up positions
+	ListNode *PositionIndexFind (LinkedList *listPtr, Index position);
+
+	// Related to keeping the index up to date
+	void PositionIndexInsert (LinkedList *listPtr, ListNode *newNodePtr, Index position);
+	void PositionIndexRemove (LinkedList *listPtr, Index position);
+	void PositionIndexRotate (LinkedList *listPtr, Index newHeadPosition);
+	void InvalidatePositionIndex (LinkedList *listPtr);
+	void ClearPositionIndex (LinkedList *listPtr);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
@@ -0,0 +1,472 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <string.h> 		// For moving data within a node
+#include "../unrolledlist.h"	// For type declarations and function declarations related to the unrolled linked list data structure
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to print the contents of an unrolled linked list, in the same format as PrintList
+ * Input: list (UnrolledList)
+ * Return value: none
+ * Assumptions: list is terminated with a NULL, empty list has headPtr == NULL
+ * Time complexity: O(list.numData)
+ * Space complexity: O(1)
+ */
+void PrintUnrolledList (UnrolledList list) {
+	UnrolledNode *currNodePtr;
+	Index i;
+
+	currNodePtr = list.headPtr;
+
+	while (currNodePtr != NULL) {
+		for (i = 0; i < currNodePtr->numData; i++) {
+			PrintData (currNodePtr->data[i]);
+			printf (" -> ");
+		}
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+	printf ("NULL\n");
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to create an empty unrolled linked list
+ * Input: none
+ * Return value: list (UnrolledList) : unrolled linked list with no nodes and no data, list.headPtr = list.tailPtr = NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+UnrolledList InitialiseUnrolledList (void) {
+	UnrolledList list;
+	list.headPtr = NULL;
+	list.tailPtr = NULL;
+	list.numNodes = 0;
+	list.numData = 0;
+	return list;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to allocate an empty unrolled list node, aligned to a cache line
+ * Input: none
+ * Return value: pointer to node with node->numData = 0, node->nextNodePtr = NULL, or NULL if allocation failed
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static UnrolledNode *NewUnrolledNode (void) {
+	UnrolledNode *newNodePtr;
+
+	newNodePtr = (UnrolledNode *) aligned_alloc (UNROLLED_NODE_SIZE, sizeof (UnrolledNode));
+	if (newNodePtr == NULL) {
+		printf ("Error: could not allocate a new unrolled list node\n");
+		return NULL;
+	}
+
+	newNodePtr->nextNodePtr = NULL;
+	newNodePtr->numData = 0;
+	return newNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Helper function to split an unrolled list node in two
+ * Inputs: listPtr (UnrolledList *): pointer to unrolled linked list, nodePtr (UnrolledNode *): node to be split,
+ * offset (Index) (int): index of the first data value to be moved to the new node
+ * Return value: pointer to the new node, or NULL if allocation failed (the list is then unchanged)
+ * Post-condition: nodePtr keeps data[0 .. offset-1], the new node is inserted after nodePtr and holds the rest.
+ * listPtr->numNodes is incremented by 1, listPtr->tailPtr is updated if nodePtr was the tail.
+ * Assumptions: listPtr != NULL, nodePtr is in the list, 0 <= offset <= nodePtr->numData
+ * Time complexity: O(UNROLLED_NODE_CAPACITY)
+ * Space complexity: O(1)
+ */
+static UnrolledNode *SplitUnrolledNode (UnrolledList *listPtr, UnrolledNode *nodePtr, Index offset) {
+	UnrolledNode *newNodePtr;
+
+	newNodePtr = NewUnrolledNode ();
+	if (newNodePtr == NULL) {
+		return NULL;
+	}
+
+	newNodePtr->numData = (nodePtr->numData)-offset;
+	memcpy (newNodePtr->data, &(nodePtr->data[offset]), (newNodePtr->numData) * sizeof (Data));
+	nodePtr->numData = offset;
+
+	newNodePtr->nextNodePtr = nodePtr->nextNodePtr;
+	nodePtr->nextNodePtr = newNodePtr;
+	if (listPtr->tailPtr == nodePtr) {
+		listPtr->tailPtr = newNodePtr;
+	}
+
+	(listPtr->numNodes)++;
+	return newNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the end of an unrolled linked list
+ * A new node is appended only if the tail node is full.
+ * Inputs: listPtr (UnrolledList *), data (Data) (int)
+ * Return value: none
+ * Pre-condition: listPtr is an unrolled linked list, with some (or no) data
+ * Post-condition: data is the last value of the list, listPtr->numData is incremented by 1
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void UnrolledAddDataAtEnd (UnrolledList *listPtr, Data data) {
+	UnrolledNode *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledAddDataAtEnd (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->tailPtr == NULL || listPtr->tailPtr->numData == UNROLLED_NODE_CAPACITY) {
+		newNodePtr = NewUnrolledNode ();
+		if (newNodePtr == NULL) {
+			return;
+		}
+
+		if (listPtr->tailPtr == NULL) {
+			listPtr->headPtr = newNodePtr;
+		}
+		else {
+			listPtr->tailPtr->nextNodePtr = newNodePtr;
+		}
+		listPtr->tailPtr = newNodePtr;
+		(listPtr->numNodes)++;
+	}
+
+	listPtr->tailPtr->data[listPtr->tailPtr->numData] = data;
+	(listPtr->tailPtr->numData)++;
+	(listPtr->numData)++;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add data at the beginning of an unrolled linked list
+ * A new node is prepended only if the head node is full. Otherwise the data of the head node is moved up by one place.
+ * Inputs: listPtr (UnrolledList *), data (Data) (int)
+ * Return value: none
+ * Pre-condition: listPtr is an unrolled linked list, with some (or no) data
+ * Post-condition: data is the first value of the list, listPtr->numData is incremented by 1
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(UNROLLED_NODE_CAPACITY)
+ * Space complexity: O(1)
+ */
+void UnrolledAddDataAtBeginning (UnrolledList *listPtr, Data data) {
+	UnrolledNode *newNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledAddDataAtBeginning (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->headPtr == NULL || listPtr->headPtr->numData == UNROLLED_NODE_CAPACITY) {
+		newNodePtr = NewUnrolledNode ();
+		if (newNodePtr == NULL) {
+			return;
+		}
+
+		newNodePtr->nextNodePtr = listPtr->headPtr;
+		if (listPtr->headPtr == NULL) {
+			listPtr->tailPtr = newNodePtr;
+		}
+		listPtr->headPtr = newNodePtr;
+		(listPtr->numNodes)++;
+	}
+
+	memmove (&(listPtr->headPtr->data[1]), listPtr->headPtr->data, (listPtr->headPtr->numData) * sizeof (Data));
+	listPtr->headPtr->data[0] = data;
+	(listPtr->headPtr->numData)++;
+	(listPtr->numData)++;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to an unrolled linked list at a certain position w.r.t. the head of the list
+ * If the node holding that position is full, it is split in two halves first.
+ * Inputs: listPtr (UnrolledList *): pointer to unrolled linked list, data (Data) (int), position (Index) (int)
+ * position is like an array index: should range from 0 (head) to (listPtr->numData) (after tail)
+ * Return value: None
+ * Pre-condition: list contains some (or no) data
+ * Post-condition: data is inserted at offset 'position' from the beginning
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numData)]
+ * Time complexity: O(position / (average data per node) + UNROLLED_NODE_CAPACITY)
+ * Space complexity: O(1)
+ */
+void UnrolledAddDataFromBeginning (UnrolledList *listPtr, Data data, Index position) {
+	UnrolledNode *currNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledAddDataFromBeginning (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > (listPtr->numData)) {
+		printf ("Error:	Argument 3 of UnrolledAddDataFromBeginning (Index position) is out of bounds\n");
+		return;
+	}
+
+	if (position == (listPtr->numData)) {
+		UnrolledAddDataAtEnd (listPtr, data);
+		return;
+	}
+
+	currNodePtr = listPtr->headPtr;
+	while (position > currNodePtr->numData) {
+		position -= currNodePtr->numData;
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+
+	if (currNodePtr->numData == UNROLLED_NODE_CAPACITY) {
+		if (SplitUnrolledNode (listPtr, currNodePtr, UNROLLED_NODE_CAPACITY/2) == NULL) {
+			return;
+		}
+
+		if (position > currNodePtr->numData) {
+			position -= currNodePtr->numData;
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+	}
+
+	memmove (&(currNodePtr->data[position+1]), &(currNodePtr->data[position]),
+		((currNodePtr->numData)-position) * sizeof (Data));
+	currNodePtr->data[position] = data;
+	(currNodePtr->numData)++;
+	(listPtr->numData)++;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to add given data to an unrolled linked list at a certain position w.r.t. the tail of the list
+ * Inputs: listPtr (UnrolledList *): pointer to unrolled linked list, data (Data) (int), position (Index) (int).
+ * Position is like an array index: should range from 0 (tail) to (listPtr->numData) (before head)
+ * Return value: none
+ * Pre-condition: list contains some (or no) data
+ * Post-condition: data is inserted at offset 'position' from the end
+ * Assumptions: listPtr != NULL, position is in range [0, (listPtr->numData)]
+ * Time complexity: O(positionFromBeginning / (average data per node) + UNROLLED_NODE_CAPACITY)
+ * Space complexity: O(1)
+ */
+void UnrolledAddDataFromEnd (UnrolledList *listPtr, Data data, Index position) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledAddDataFromEnd (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (position < 0 || position > (listPtr->numData)) {
+		printf ("Error:	Argument 3 of UnrolledAddDataFromEnd (Index position) is out of bounds\n");
+		return;
+	}
+
+	UnrolledAddDataFromBeginning (listPtr, data, (listPtr->numData)-position);
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove given data from an unrolled linked list
+ * The data that is kept is packed towards the head as it is read, so every node but the last is full afterwards,
+ * and the nodes left over at the end are freed.
+ * Inputs: listPtr (UnrolledList *): pointer to unrolled linked list, data (Data) (int)
+ * Return value: none
+ * Pre-condition: list has some (or no) data
+ * Post-condition: All occurrences of data in list are removed, listPtr->numData is reduced by number of values removed
+ * Assumptions: listPtr != NULL
+ * Time complexity: O(listPtr->numData) [just before function is called]
+ * Space complexity: O(1)
+ */
+void UnrolledRemoveData (UnrolledList *listPtr, Data data) {
+	UnrolledNode *readNodePtr, *writeNodePtr, *prevWriteNodePtr, *lastNodePtr, *tempNodePtr;
+	Index i, writeIndex;
+	Length numDataInNode, numDataKept = 0;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledRemoveData (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	prevWriteNodePtr = NULL;
+	writeNodePtr = listPtr->headPtr;
+	writeIndex = 0;
+	readNodePtr = listPtr->headPtr;
+
+	// the write position never passes the read position, so values are never overwritten before they are read
+	while (readNodePtr != NULL) {
+		numDataInNode = readNodePtr->numData;
+
+		for (i = 0; i < numDataInNode; i++) {
+			if (readNodePtr->data[i] != data) {
+				writeNodePtr->data[writeIndex] = readNodePtr->data[i];
+				writeIndex++;
+				numDataKept++;
+
+				if (writeIndex == UNROLLED_NODE_CAPACITY) {
+					writeNodePtr->numData = UNROLLED_NODE_CAPACITY;
+					prevWriteNodePtr = writeNodePtr;
+					writeNodePtr = writeNodePtr->nextNodePtr;
+					writeIndex = 0;
+				}
+			}
+		}
+
+		readNodePtr = readNodePtr->nextNodePtr;
+	}
+
+	// last node still holding data
+	if (writeIndex > 0) {
+		writeNodePtr->numData = writeIndex;
+		lastNodePtr = writeNodePtr;
+		writeNodePtr = writeNodePtr->nextNodePtr;
+	}
+	else {
+		lastNodePtr = prevWriteNodePtr;
+	}
+
+	// free the nodes left over
+	while (writeNodePtr != NULL) {
+		tempNodePtr = writeNodePtr;
+		writeNodePtr = writeNodePtr->nextNodePtr;
+		free (tempNodePtr);
+		(listPtr->numNodes)--;
+	}
+
+	if (lastNodePtr == NULL) {
+		listPtr->headPtr = NULL;
+	}
+	else {
+		lastNodePtr->nextNodePtr = NULL;
+	}
+	listPtr->tailPtr = lastNodePtr;
+	listPtr->numData = numDataKept;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to remove (and free) all nodes in an unrolled linked list
+ * Input: listPtr (UnrolledList *): pointer to unrolled linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes
+ * Post-condition: list contains zero nodes, listPtr->headPtr = listPtr->tailPtr = NULL, listPtr->numNodes = listPtr->numData = 0
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes) [just before function is called]
+ * Space complexity: O(1)
+ */
+void UnrolledRemoveAllNodes (UnrolledList *listPtr) {
+	UnrolledNode *prevNodePtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledRemoveAllNodes (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	while (listPtr->headPtr != NULL) {
+		prevNodePtr = listPtr->headPtr;
+		listPtr->headPtr = listPtr->headPtr->nextNodePtr;
+		free (prevNodePtr);
+	}
+
+	listPtr->tailPtr = NULL;
+	listPtr->numNodes = 0;
+	listPtr->numData = 0;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to reverse an unrolled linked list
+ * The order of the nodes is reversed, and so is the order of the data within each node.
+ * Input: listPtr (UnrolledList *): pointer to unrolled linked list
+ * Return value: none
+ * Pre-condition: list contains some data d_1, ..., d_numData
+ * Post-condition: list contains the data in order d_numData, ..., d_1
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numData)
+ * Space complexity: O(1)
+ */
+void UnrolledReverseList (UnrolledList *listPtr) {
+	UnrolledNode *prevNodePtr, *currNodePtr, *nextNodePtr;
+	Index i, j;
+	Data tempData;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledReverseList (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	while (currNodePtr != NULL) {
+		for (i = 0, j = (currNodePtr->numData)-1; i < j; i++, j--) {
+			tempData = currNodePtr->data[i];
+			currNodePtr->data[i] = currNodePtr->data[j];
+			currNodePtr->data[j] = tempData;
+		}
+
+		nextNodePtr = currNodePtr->nextNodePtr;
+		currNodePtr->nextNodePtr = prevNodePtr;
+		prevNodePtr = currNodePtr;
+		currNodePtr = nextNodePtr;
+	}
+
+	listPtr->tailPtr = listPtr->headPtr;
+	listPtr->headPtr = prevNodePtr;
+}
+
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Function to rotate an unrolled linked list by a given amount
+ * If the rotation point falls inside a node, that node is split there first; the nodes are then relinked as in RotateList.
+ * Inputs: listPtr (UnrolledList *): pointer to unrolled linked list, rotation (Index) (int): amount by which to rotate
+ * rotation > 0 => right rotation, rotation < 0 => left rotation (same meaning as for RotateList)
+ * Return value: none
+ * Assumptions: listPtr != NULL, -numData+1 <= rotation <= numData-1
+ * Time complexity: O(listPtr->numNodes + UNROLLED_NODE_CAPACITY)
+ * Space complexity: O(1)
+ */
+void UnrolledRotateList (UnrolledList *listPtr, Index rotation) {
+	UnrolledNode *prevNodePtr, *currNodePtr;
+	Index index;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of UnrolledRotateList (UnrolledList *listPtr) cannot be NULL\n");
+		return;
+	}
+	if (rotation <= -(listPtr->numData) || rotation >= (listPtr->numData)) {
+		printf ("Error: Argument 2 of UnrolledRotateList (Index rotation) describes rotation that is not supported\n");
+		return;
+	}
+
+	if (rotation == 0) {
+		return;
+	}
+	else if (rotation < 0) {
+		index = -rotation;
+	}
+	else {
+		index = (listPtr->numData)-rotation;
+	}
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	while (index >= currNodePtr->numData) {
+		index -= currNodePtr->numData;
+		prevNodePtr = currNodePtr;
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+
+	// the new head is in the middle of currNodePtr
+	if (index > 0) {
+		prevNodePtr = currNodePtr;
+		currNodePtr = SplitUnrolledNode (listPtr, currNodePtr, index);
+		if (currNodePtr == NULL) {
+			return;
+		}
+	}
+
+	listPtr->tailPtr->nextNodePtr = listPtr->headPtr;
+	prevNodePtr->nextNodePtr = NULL;
+	listPtr->headPtr = currNodePtr;
+	listPtr->tailPtr = prevNodePtr;
+}
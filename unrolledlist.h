@@ -0,0 +1,98 @@
+/*
+ * G V Vishwanath, 17th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the unrolled linked list data structure.
+ * An unrolled linked list stores several data values per node, so that one node fills one cache line.
+ *
+ * The following types are declared in this file:
+ * a) struct unrollednode (UnrolledNode): a structure representing one unrolled list node. Contains a small array of data,
+ *    the number of data values in use, and a pointer to the next node
+ * b) struct unrolledlist (UnrolledList): a structure representing an unrolled linked list. Contains a head pointer,
+ *    a tail pointer, the number of nodes and the number of data values in the list
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to printing contents of an unrolled linked list
+ * a) PrintUnrolledList: Function to print the contents of an unrolled linked list
+ *
+ * Related to initialising an unrolled linked list
+ * b) InitialiseUnrolledList: Function to create an empty unrolled linked list
+ *
+ * Related to adding data to an unrolled linked list
+ * c) UnrolledAddDataAtEnd: Function to add data at the end of an unrolled linked list
+ * d) UnrolledAddDataAtBeginning: Function to add data at the beginning of an unrolled linked list
+ * e) UnrolledAddDataFromBeginning: Function to add data at a certain position w.r.t. the head of an unrolled linked list
+ * f) UnrolledAddDataFromEnd: Function to add data at a certain position w.r.t. the tail of an unrolled linked list
+ *
+ * Related to removing data from an unrolled linked list
+ * g) UnrolledRemoveData: Function to remove all occurrences of given data from an unrolled linked list
+ * h) UnrolledRemoveAllNodes: Function to remove (and free) all nodes in an unrolled linked list
+ *
+ * Related to permutation of an unrolled linked list
+ * i) UnrolledReverseList: Function to reverse an unrolled linked list
+ * j) UnrolledRotateList: Function to rotate an unrolled linked list by a given amount
+ *
+ * All of the above functions are defined in "Linked List/unrolledlist.c". For more details, see there.
+ */
+
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// Size of one unrolled list node in bytes (one cache line)
+	#define UNROLLED_NODE_SIZE 64
+
+	// Number of data values that fit in one unrolled list node, next to the pointer and the count
+	#define UNROLLED_NODE_CAPACITY ((Length) ((UNROLLED_NODE_SIZE - sizeof (void *) - sizeof (Length)) / sizeof (Data)))
+
+	// For one node in unrolled linked list
+	struct unrollednode {
+		struct unrollednode *nextNodePtr;
+		Length numData;
+		Data data[(UNROLLED_NODE_SIZE - sizeof (void *) - sizeof (Length)) / sizeof (Data)];
+	};
+	typedef struct unrollednode UnrolledNode;
+
+	// Wrapper for unrolled linked list node
+	struct unrolledlist {
+		UnrolledNode *headPtr;
+		UnrolledNode *tailPtr;
+		Length numNodes;
+		Length numData;
+	};
+	typedef struct unrolledlist UnrolledList;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/unrolledlist.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to printing the contents of the unrolled linked list
+	void PrintUnrolledList (UnrolledList list);
+
+	// Related to initialising unrolled linked lists
+	UnrolledList InitialiseUnrolledList (void);
+
+	// Related to adding data to an unrolled linked list
+	void UnrolledAddDataAtEnd (UnrolledList *listPtr, Data data);
+	void UnrolledAddDataAtBeginning (UnrolledList *listPtr, Data data);
+	void UnrolledAddDataFromBeginning (UnrolledList *listPtr, Data data, Index position);
+	void UnrolledAddDataFromEnd (UnrolledList *listPtr, Data data, Index position);
+
+	// Related to removing data from an unrolled linked list
+	void UnrolledRemoveData (UnrolledList *listPtr, Data data);
+	void UnrolledRemoveAllNodes (UnrolledList *listPtr);
+
+	// Related to permutation of an unrolled linked list
+	void UnrolledReverseList (UnrolledList *listPtr);
+	void UnrolledRotateList (UnrolledList *listPtr, Index rotation);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif
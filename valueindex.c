@@ -0,0 +1,548 @@
+#include <stdio.h>  		// For input/output
+#include <stdlib.h> 		// For dynamic memory allocation and de-allocation
+#include <stdint.h> 		// For hashing node addresses and data
+#include "../valueindex.h"	// For type declarations and function declarations related to the value index
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to find the bucket of a 64-bit key (Fibonacci hashing: the top bits of key * 2^64/phi)
+ * Inputs: key (uint64_t), numBuckets (Length) (int): number of buckets, a power of two
+ * Return value: bucket (Index) (int), in range [0, numBuckets-1]
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+static Index HashKey (uint64_t key, Length numBuckets) {
+	return (Index) (((key * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & (uint64_t) (numBuckets-1));
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to find the entry of a node
+ * Inputs: indexPtr (ValueIndex *): pointer to value index, nodePtr (ListNode *): the node
+ * Return value: pointer to the entry of the node, NULL if it has none
+ * Assumption: indexPtr != NULL
+ * Time complexity: O(1) expected
+ * Space complexity: O(1)
+ */
+static ValueEntry *FindEntry (ValueIndex *indexPtr, const ListNode *nodePtr) {
+	ValueEntry *entryPtr;
+
+	entryPtr = indexPtr->entryBuckets[HashKey ((uintptr_t) nodePtr, indexPtr->numBuckets)];
+	while (entryPtr != NULL && entryPtr->nodePtr != nodePtr) {
+		entryPtr = entryPtr->nextInBucketPtr;
+	}
+
+	return entryPtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to find the group of the entries holding given data
+ * Inputs: indexPtr (ValueIndex *): pointer to value index, data (Data) (int)
+ * Return value: pointer to the group, NULL if no node holds data
+ * Assumption: indexPtr != NULL
+ * Time complexity: O(1) expected
+ * Space complexity: O(1)
+ */
+static ValueGroup *FindGroup (ValueIndex *indexPtr, Data data) {
+	ValueGroup *groupPtr;
+
+	groupPtr = indexPtr->groupBuckets[HashKey ((uint64_t) data, indexPtr->numBuckets)];
+	while (groupPtr != NULL && groupPtr->data != data) {
+		groupPtr = groupPtr->nextInBucketPtr;
+	}
+
+	return groupPtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to free all entries and groups of a value index, keeping its buckets
+ * Input: indexPtr (ValueIndex *): pointer to value index
+ * Return value: none
+ * Post-condition: every bucket is empty, indexPtr->numEntries = indexPtr->numGroups = 0
+ * Assumption: indexPtr != NULL
+ * Time complexity: O(indexPtr->numBuckets + number of entries)
+ * Space complexity: O(1)
+ */
+static void FreeValueEntries (ValueIndex *indexPtr) {
+	ValueEntry *currEntryPtr, *tempEntryPtr;
+	ValueGroup *currGroupPtr, *tempGroupPtr;
+	Index bucket;
+
+	for (bucket = 0; bucket < indexPtr->numBuckets; bucket++) {
+		currEntryPtr = indexPtr->entryBuckets[bucket];
+		while (currEntryPtr != NULL) {
+			tempEntryPtr = currEntryPtr;
+			currEntryPtr = currEntryPtr->nextInBucketPtr;
+			free (tempEntryPtr);
+		}
+		indexPtr->entryBuckets[bucket] = NULL;
+
+		currGroupPtr = indexPtr->groupBuckets[bucket];
+		while (currGroupPtr != NULL) {
+			tempGroupPtr = currGroupPtr;
+			currGroupPtr = currGroupPtr->nextInBucketPtr;
+			free (tempGroupPtr);
+		}
+		indexPtr->groupBuckets[bucket] = NULL;
+	}
+
+	indexPtr->numEntries = 0;
+	indexPtr->numGroups = 0;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to double the number of buckets of a value index, moving every entry and group to its new bucket
+ * Input: indexPtr (ValueIndex *): pointer to value index
+ * Return value: TRUE if the buckets were doubled, FALSE if they could not be allocated (the index is then unchanged)
+ * Assumption: indexPtr != NULL
+ * Time complexity: O(indexPtr->numBuckets + number of entries)
+ * Space complexity: O(indexPtr->numBuckets)
+ */
+static bool GrowValueIndex (ValueIndex *indexPtr) {
+	ValueEntry **newEntryBuckets, *currEntryPtr, *nextEntryPtr;
+	ValueGroup **newGroupBuckets, *currGroupPtr, *nextGroupPtr;
+	Length newNumBuckets = 2 * indexPtr->numBuckets;
+	Index bucket, newBucket;
+
+	newEntryBuckets = (ValueEntry **) calloc (newNumBuckets, sizeof (ValueEntry *));
+	newGroupBuckets = (ValueGroup **) calloc (newNumBuckets, sizeof (ValueGroup *));
+	if (newEntryBuckets == NULL || newGroupBuckets == NULL) {
+		free (newEntryBuckets);
+		free (newGroupBuckets);
+		return FALSE;
+	}
+
+	for (bucket = 0; bucket < indexPtr->numBuckets; bucket++) {
+		for (currEntryPtr = indexPtr->entryBuckets[bucket]; currEntryPtr != NULL; currEntryPtr = nextEntryPtr) {
+			nextEntryPtr = currEntryPtr->nextInBucketPtr;
+			newBucket = HashKey ((uintptr_t) currEntryPtr->nodePtr, newNumBuckets);
+			currEntryPtr->nextInBucketPtr = newEntryBuckets[newBucket];
+			newEntryBuckets[newBucket] = currEntryPtr;
+		}
+
+		for (currGroupPtr = indexPtr->groupBuckets[bucket]; currGroupPtr != NULL; currGroupPtr = nextGroupPtr) {
+			nextGroupPtr = currGroupPtr->nextInBucketPtr;
+			newBucket = HashKey ((uint64_t) currGroupPtr->data, newNumBuckets);
+			currGroupPtr->nextInBucketPtr = newGroupBuckets[newBucket];
+			newGroupBuckets[newBucket] = currGroupPtr;
+		}
+	}
+
+	free (indexPtr->entryBuckets);
+	free (indexPtr->groupBuckets);
+	indexPtr->entryBuckets = newEntryBuckets;
+	indexPtr->groupBuckets = newGroupBuckets;
+	indexPtr->numBuckets = newNumBuckets;
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to add the entry of a node to a value index
+ * The buckets are doubled first if there are as many entries as buckets (if that fails, the buckets just get fuller).
+ * Inputs: indexPtr (ValueIndex *): pointer to value index, prevNodePtr (ListNode *): the node before the node
+ * (NULL => head), nodePtr (ListNode *): the node
+ * Return value: TRUE if the entry was added, FALSE if it could not be allocated (the index is then unchanged)
+ * Assumption: indexPtr != NULL, nodePtr != NULL, nodePtr has no entry
+ * Time complexity: O(1) amortised expected
+ * Space complexity: O(1) amortised
+ */
+static bool AddEntry (ValueIndex *indexPtr, ListNode *prevNodePtr, ListNode *nodePtr) {
+	ValueEntry *newEntryPtr;
+	ValueGroup *groupPtr;
+	Index bucket;
+
+	if (indexPtr->numEntries >= indexPtr->numBuckets) {
+		GrowValueIndex (indexPtr);
+	}
+
+	newEntryPtr = (ValueEntry *) malloc (sizeof (ValueEntry));
+	if (newEntryPtr == NULL) {
+		return FALSE;
+	}
+
+	groupPtr = FindGroup (indexPtr, nodePtr->data);
+	if (groupPtr == NULL) {
+		groupPtr = (ValueGroup *) malloc (sizeof (ValueGroup));
+		if (groupPtr == NULL) {
+			free (newEntryPtr);
+			return FALSE;
+		}
+
+		groupPtr->data = nodePtr->data;
+		groupPtr->numEntries = 0;
+		groupPtr->firstEntryPtr = NULL;
+		bucket = HashKey ((uint64_t) groupPtr->data, indexPtr->numBuckets);
+		groupPtr->nextInBucketPtr = indexPtr->groupBuckets[bucket];
+		indexPtr->groupBuckets[bucket] = groupPtr;
+		(indexPtr->numGroups)++;
+	}
+
+	newEntryPtr->nodePtr = nodePtr;
+	newEntryPtr->prevNodePtr = prevNodePtr;
+	newEntryPtr->groupPtr = groupPtr;
+
+	bucket = HashKey ((uintptr_t) nodePtr, indexPtr->numBuckets);
+	newEntryPtr->nextInBucketPtr = indexPtr->entryBuckets[bucket];
+	indexPtr->entryBuckets[bucket] = newEntryPtr;
+
+	newEntryPtr->prevInGroupPtr = NULL;
+	newEntryPtr->nextInGroupPtr = groupPtr->firstEntryPtr;
+	if (groupPtr->firstEntryPtr != NULL) {
+		groupPtr->firstEntryPtr->prevInGroupPtr = newEntryPtr;
+	}
+	groupPtr->firstEntryPtr = newEntryPtr;
+	(groupPtr->numEntries)++;
+	(indexPtr->numEntries)++;
+
+	return TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to remove (and free) the entry of a node from a value index, and its group if it was the last one
+ * Inputs: indexPtr (ValueIndex *): pointer to value index, entryPtr (ValueEntry *): the entry
+ * Return value: none
+ * Assumption: indexPtr != NULL, entryPtr is an entry of the index
+ * Time complexity: O(1) expected
+ * Space complexity: O(1)
+ */
+static void DeleteEntry (ValueIndex *indexPtr, ValueEntry *entryPtr) {
+	ValueEntry **entryLinkPtr;
+	ValueGroup **groupLinkPtr, *groupPtr = entryPtr->groupPtr;
+
+	entryLinkPtr = &(indexPtr->entryBuckets[HashKey ((uintptr_t) entryPtr->nodePtr, indexPtr->numBuckets)]);
+	while (*entryLinkPtr != entryPtr) {
+		entryLinkPtr = &((*entryLinkPtr)->nextInBucketPtr);
+	}
+	*entryLinkPtr = entryPtr->nextInBucketPtr;
+
+	if (entryPtr->prevInGroupPtr != NULL) {
+		entryPtr->prevInGroupPtr->nextInGroupPtr = entryPtr->nextInGroupPtr;
+	}
+	else {
+		groupPtr->firstEntryPtr = entryPtr->nextInGroupPtr;
+	}
+	if (entryPtr->nextInGroupPtr != NULL) {
+		entryPtr->nextInGroupPtr->prevInGroupPtr = entryPtr->prevInGroupPtr;
+	}
+	(groupPtr->numEntries)--;
+	(indexPtr->numEntries)--;
+	free (entryPtr);
+
+	if (groupPtr->numEntries == 0) {
+		groupLinkPtr = &(indexPtr->groupBuckets[HashKey ((uint64_t) groupPtr->data, indexPtr->numBuckets)]);
+		while (*groupLinkPtr != groupPtr) {
+			groupLinkPtr = &((*groupLinkPtr)->nextInBucketPtr);
+		}
+		*groupLinkPtr = groupPtr->nextInBucketPtr;
+		(indexPtr->numGroups)--;
+		free (groupPtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Helper function to rebuild the value index of a linked list from scratch
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Post-condition: the index describes the list and is valid, unless an entry could not be allocated
+ * (the index is then left empty and invalid)
+ * Assumption: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(listPtr->numNodes) expected
+ * Space complexity: O(listPtr->numNodes)
+ */
+static void RebuildValueIndex (LinkedList *listPtr) {
+	ValueIndex *indexPtr = listPtr->valueIndexPtr;
+	ListNode *prevNodePtr, *currNodePtr;
+
+	FreeValueEntries (indexPtr);
+
+	prevNodePtr = NULL;
+	currNodePtr = listPtr->headPtr;
+
+	while (currNodePtr != NULL) {
+		if (!AddEntry (indexPtr, prevNodePtr, currNodePtr)) {
+			printf ("Error: could not allocate a value index entry\n");
+			FreeValueEntries (indexPtr);
+			indexPtr->isValid = FALSE;
+			return;
+		}
+
+		prevNodePtr = currNodePtr;
+		currNodePtr = currNodePtr->nextNodePtr;
+	}
+
+	indexPtr->isValid = TRUE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to build a value index for a linked list
+ * Once attached, FindData, ContainsData and CountData take expected O(1) steps, and RemoveData expected O(1) steps
+ * per node removed. Adding and removing nodes keep the index up to date in expected O(1) steps; operations that
+ * reorder the whole list (ReverseList, SortList, MergeSortedLists, CompactList, ...) mark it out of date instead,
+ * and it is rebuilt when it is next used.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Pre-condition: list contains some (or no) nodes, and has no value index
+ * Post-condition: listPtr->valueIndexPtr points to an index describing the list
+ * Assumption: listPtr != NULL
+ * Time complexity: O(listPtr->numNodes) expected
+ * Space complexity: O(listPtr->numNodes)
+ */
+void AttachValueIndex (LinkedList *listPtr) {
+	ValueIndex *indexPtr;
+
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of AttachValueIndex (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->valueIndexPtr != NULL) {
+		return;
+	}
+
+	indexPtr = (ValueIndex *) malloc (sizeof (ValueIndex));
+	if (indexPtr != NULL) {
+		indexPtr->entryBuckets = (ValueEntry **) calloc (VALUE_INDEX_INITIAL_BUCKETS, sizeof (ValueEntry *));
+		indexPtr->groupBuckets = (ValueGroup **) calloc (VALUE_INDEX_INITIAL_BUCKETS, sizeof (ValueGroup *));
+	}
+	if (indexPtr == NULL || indexPtr->entryBuckets == NULL || indexPtr->groupBuckets == NULL) {
+		printf ("Error: could not allocate a value index\n");
+		if (indexPtr != NULL) {
+			free (indexPtr->entryBuckets);
+			free (indexPtr->groupBuckets);
+			free (indexPtr);
+		}
+		return;
+	}
+
+	indexPtr->numBuckets = VALUE_INDEX_INITIAL_BUCKETS;
+	indexPtr->numEntries = 0;
+	indexPtr->numGroups = 0;
+
+	listPtr->valueIndexPtr = indexPtr;
+	RebuildValueIndex (listPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to remove (and free) the value index of a linked list
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Post-condition: listPtr->valueIndexPtr = NULL. The nodes of the list are not changed.
+ * Assumption: listPtr != NULL
+ * Time complexity: O(number of buckets + number of index entries)
+ * Space complexity: O(1)
+ */
+void DetachValueIndex (LinkedList *listPtr) {
+	if (listPtr == NULL) {
+		printf ("Error: Argument 1 of DetachValueIndex (LinkedList *listPtr) cannot be NULL\n");
+		return;
+	}
+
+	if (listPtr->valueIndexPtr == NULL) {
+		return;
+	}
+
+	FreeValueEntries (listPtr->valueIndexPtr);
+	free (listPtr->valueIndexPtr->entryBuckets);
+	free (listPtr->valueIndexPtr->groupBuckets);
+	free (listPtr->valueIndexPtr);
+	listPtr->valueIndexPtr = NULL;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to find a node holding given data, and the node before it, using the value index
+ * The index is rebuilt first if it is out of date. Which of several nodes holding data is found is not specified
+ * (unless the index could not be rebuilt: the list is then walked, and the first one is found).
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int),
+ * prevNodePtrPtr (ListNode **): receives the node before the node found (NULL => head; may be NULL if not wanted)
+ * Return value: pointer to a node holding data, NULL if there is none
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(1) expected, O(listPtr->numNodes) if the index has to be rebuilt
+ * Space complexity: O(1)
+ */
+ListNode *ValueIndexFind (LinkedList *listPtr, Data data, ListNode **prevNodePtrPtr) {
+	ValueGroup *groupPtr;
+	ListNode *prevNodePtr = NULL, *currNodePtr;
+
+	if (!(listPtr->valueIndexPtr->isValid)) {
+		RebuildValueIndex (listPtr);
+	}
+
+	if (listPtr->valueIndexPtr->isValid) {
+		groupPtr = FindGroup (listPtr->valueIndexPtr, data);
+		if (groupPtr != NULL) {
+			prevNodePtr = groupPtr->firstEntryPtr->prevNodePtr;
+			currNodePtr = groupPtr->firstEntryPtr->nodePtr;
+		}
+		else {
+			currNodePtr = NULL;
+		}
+	}
+
+	// fall back on walking the list
+	else {
+		currNodePtr = listPtr->headPtr;
+		while (currNodePtr != NULL && currNodePtr->data != data) {
+			prevNodePtr = currNodePtr;
+			currNodePtr = currNodePtr->nextNodePtr;
+		}
+	}
+
+	if (prevNodePtrPtr != NULL) {
+		*prevNodePtrPtr = prevNodePtr;
+	}
+
+	return currNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to count the nodes of a linked list holding given data, using the value index
+ * The index is rebuilt first if it is out of date.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, data (Data) (int)
+ * Return value: number of nodes holding data (Length) (int)
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(1) expected, O(listPtr->numNodes) if the index has to be rebuilt
+ * Space complexity: O(1)
+ */
+Length ValueIndexCount (LinkedList *listPtr, Data data) {
+	ValueGroup *groupPtr;
+	ListNode *currNodePtr;
+	Length numNodesFound = 0;
+
+	if (!(listPtr->valueIndexPtr->isValid)) {
+		RebuildValueIndex (listPtr);
+	}
+
+	if (listPtr->valueIndexPtr->isValid) {
+		groupPtr = FindGroup (listPtr->valueIndexPtr, data);
+		return (groupPtr != NULL) ? groupPtr->numEntries : 0;
+	}
+
+	// fall back on walking the list
+	for (currNodePtr = listPtr->headPtr; currNodePtr != NULL; currNodePtr = currNodePtr->nextNodePtr) {
+		if (currNodePtr->data == data) {
+			numNodesFound++;
+		}
+	}
+
+	return numNodesFound;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to record that a node has been linked into a linked list after a given node
+ * The node after the new one now has a different node before it; that is recorded separately, with ValueIndexRelink.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, prevNodePtr (ListNode *): the node before the new node
+ * (NULL => head), newNodePtr (ListNode *): the new node
+ * Return value: none
+ * Pre-condition: the node has already been linked into the list
+ * Post-condition: the new node has an entry (if the index was valid before; if the entry could not be allocated,
+ * the index is marked out of date)
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(1) amortised expected
+ * Space complexity: O(1) amortised
+ */
+void ValueIndexInsert (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *newNodePtr) {
+	if (!(listPtr->valueIndexPtr->isValid)) {
+		return;
+	}
+
+	if (!AddEntry (listPtr->valueIndexPtr, prevNodePtr, newNodePtr)) {
+		InvalidateValueIndex (listPtr);
+	}
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to record that a node has been unlinked from a linked list
+ * The node after the removed one now has a different node before it; that is recorded separately, with ValueIndexRelink.
+ * Inputs: listPtr (LinkedList *): pointer to linked list, nodePtr (ListNode *): the removed node (not yet freed)
+ * Return value: none
+ * Pre-condition: the node has already been unlinked from the list
+ * Post-condition: the entry of the removed node is freed (if the index was valid before)
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(1) expected
+ * Space complexity: O(1)
+ */
+void ValueIndexRemove (LinkedList *listPtr, ListNode *nodePtr) {
+	ValueEntry *entryPtr;
+
+	if (!(listPtr->valueIndexPtr->isValid)) {
+		return;
+	}
+
+	entryPtr = FindEntry (listPtr->valueIndexPtr, nodePtr);
+	if (entryPtr == NULL) {
+		InvalidateValueIndex (listPtr);
+		return;
+	}
+
+	DeleteEntry (listPtr->valueIndexPtr, entryPtr);
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to record that the node before a node of a linked list has changed
+ * Inputs: listPtr (LinkedList *): pointer to linked list, nodePtr (ListNode *): the node,
+ * prevNodePtr (ListNode *): the node now before it (NULL => head)
+ * Return value: none
+ * Post-condition: the entry of the node records prevNodePtr (if the index was valid before)
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL, nodePtr != NULL
+ * Time complexity: O(1) expected
+ * Space complexity: O(1)
+ */
+void ValueIndexRelink (LinkedList *listPtr, ListNode *nodePtr, ListNode *prevNodePtr) {
+	ValueEntry *entryPtr;
+
+	if (!(listPtr->valueIndexPtr->isValid)) {
+		return;
+	}
+
+	entryPtr = FindEntry (listPtr->valueIndexPtr, nodePtr);
+	if (entryPtr == NULL) {
+		InvalidateValueIndex (listPtr);
+		return;
+	}
+
+	entryPtr->prevNodePtr = prevNodePtr;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to mark the value index of a linked list as out of date
+ * Used after operations that change the order or data of many nodes. The index is rebuilt when it is next used.
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(1)
+ * Space complexity: O(1)
+ */
+void InvalidateValueIndex (LinkedList *listPtr) {
+	listPtr->valueIndexPtr->isValid = FALSE;
+}
+
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Function to empty the value index of a linked list, when all nodes have been removed from the list
+ * Input: listPtr (LinkedList *): pointer to linked list
+ * Return value: none
+ * Pre-condition: the list contains zero nodes
+ * Post-condition: the index has no entries, and is valid
+ * Assumptions: listPtr != NULL, listPtr->valueIndexPtr != NULL
+ * Time complexity: O(number of buckets + number of index entries)
+ * Space complexity: O(1)
+ */
+void ClearValueIndex (LinkedList *listPtr) {
+	FreeValueEntries (listPtr->valueIndexPtr);
+	listPtr->valueIndexPtr->isValid = TRUE;
+}
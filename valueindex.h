@@ -0,0 +1,107 @@
+/*
+ * G V Vishwanath, 18th October 2026, v1.0
+ * Header file containing type declarations and function declarations related to the value index of a linked list.
+ * The value index is a hash table kept alongside a linked list, with one entry per node recording the node and the node
+ * before it. The entries are found both by the address of their node (to keep the recorded "node before" up to date as
+ * nodes are added and removed around them) and by their data, where the entries holding the same data are grouped
+ * together with their number. Looking up, counting and removing a given value then takes expected O(1) steps per
+ * occurrence instead of a walk of the whole list.
+ * The index only sees changes made through the functions of "linkedlist.h". Data changed directly through a node
+ * (e.g. through an iterator of "linkedlist.hpp") must be followed by InvalidateValueIndex.
+ *
+ * The following types are declared in this file:
+ * a) struct valueentry (ValueEntry): a structure representing the entry of one node. Contains the node, the node before
+ *    it, its group and its neighbours in the bucket of its node and in its group
+ * b) struct valuegroup (ValueGroup): a structure representing the entries holding one data value. Contains the value,
+ *    the number of entries, the first entry and the next group in the same bucket
+ * c) struct valueindex (ValueIndex): a structure representing the index. Contains the two bucket arrays, their size,
+ *    and the numbers of entries and groups
+ *
+ * The following functions are declared in this file:
+ *
+ * Related to attaching an index to a linked list
+ * a) AttachValueIndex: Function to build a value index for a linked list
+ * b) DetachValueIndex: Function to remove (and free) the value index of a linked list
+ *
+ * Related to looking up data (used by "Linked List/linkedlist.c")
+ * c) ValueIndexFind: Function to find a node holding given data, and the node before it, using the value index
+ * d) ValueIndexCount: Function to count the nodes holding given data using the value index
+ *
+ * Related to keeping the index up to date (used by "Linked List/linkedlist.c")
+ * e) ValueIndexInsert: Function to record that a node has been linked in after a given node
+ * f) ValueIndexRemove: Function to record that a node has been unlinked
+ * g) ValueIndexRelink: Function to record that the node before a node has changed
+ * h) InvalidateValueIndex: Function to mark the index as out of date, to be rebuilt when it is next used
+ * i) ClearValueIndex: Function to empty the index, when all nodes have been removed from the list
+ *
+ * All of the above functions are defined in "Linked List/valueindex.c". For more details, see there.
+ */
+
+#ifndef VALUEINDEX_H
+#define VALUEINDEX_H
+
+	#include "linkedlist.h"
+
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	// Number of buckets the index starts with; it doubles whenever there are more entries than buckets
+	#define VALUE_INDEX_INITIAL_BUCKETS 16
+
+	// For the entry of one node of the list
+	struct valueentry {
+		ListNode *nodePtr;
+		ListNode *prevNodePtr;
+		struct valuegroup *groupPtr;
+		struct valueentry *nextInBucketPtr;
+		struct valueentry *prevInGroupPtr;
+		struct valueentry *nextInGroupPtr;
+	};
+	typedef struct valueentry ValueEntry;
+
+	// For the entries of the nodes holding one data value
+	struct valuegroup {
+		Data data;
+		Length numEntries;
+		ValueEntry *firstEntryPtr;
+		struct valuegroup *nextInBucketPtr;
+	};
+	typedef struct valuegroup ValueGroup;
+
+	// For the value index of a linked list. Entries are bucketed by node address, groups by data.
+	struct valueindex {
+		ValueEntry **entryBuckets;
+		ValueGroup **groupBuckets;
+		Length numBuckets;
+		Length numEntries;
+		Length numGroups;
+		bool isValid;
+	};
+	typedef struct valueindex ValueIndex;
+
+	/*
+	 * Function declarations. The functions are defined in "Linked List/valueindex.c".
+	 * For more details, refer to this file.
+	 */
+
+	// Related to attaching an index to a linked list
+	void AttachValueIndex (LinkedList *listPtr);
+	void DetachValueIndex (LinkedList *listPtr);
+
+	// Related to looking up data
+	ListNode *ValueIndexFind (LinkedList *listPtr, Data data, ListNode **prevNodePtrPtr);
+	Length ValueIndexCount (LinkedList *listPtr, Data data);
+
+	// Related to keeping the index up to date
+	void ValueIndexInsert (LinkedList *listPtr, ListNode *prevNodePtr, ListNode *newNodePtr);
+	void ValueIndexRemove (LinkedList *listPtr, ListNode *nodePtr);
+	void ValueIndexRelink (LinkedList *listPtr, ListNode *nodePtr, ListNode *prevNodePtr);
+	void InvalidateValueIndex (LinkedList *listPtr);
+	void ClearValueIndex (LinkedList *listPtr);
+
+	#ifdef __cplusplus
+	}
+	#endif
+
+#endif